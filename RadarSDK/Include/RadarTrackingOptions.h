@@ -62,7 +62,7 @@ typedef NS_ENUM(NSInteger, RadarTrackingOptionsType) {
  An options class used to configure background tracking.
  @see https://radar.com/documentation/sdk/ios
  */
-@interface RadarTrackingOptions : NSObject
+@interface RadarTrackingOptions : NSObject <NSCopying>
 
 /**
  Determines the desired location update interval in seconds when stopped. Use 0 to shut down when stopped.
@@ -191,6 +191,11 @@ typedef NS_ENUM(NSInteger, RadarTrackingOptionsType) {
  */
 @property (nonatomic, assign) int batchSize;
 
+/**
+ Determines whether to batch with a size and interval chosen from the network type, recent request latency and failures, and whether the app is in the foreground. Fixes that change geofence or place state are sent immediately. Overrides `batchSize` and `batchInterval`.
+ */
+@property (nonatomic, assign) BOOL batchAdaptive;
+
 /**
  The type of tracking options.
  */
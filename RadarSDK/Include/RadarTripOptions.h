@@ -18,7 +18,7 @@ NS_ASSUME_NONNULL_BEGIN
 
  @see https://radar.com/documentation/sdk/ios
  */
-@interface RadarTripOptions : NSObject
+@interface RadarTripOptions : NSObject <NSCopying>
 
 - (instancetype)initWithExternalId:(NSString *_Nonnull)externalId
             destinationGeofenceTag:(NSString *_Nullable)destinationGeofenceTag
@@ -12,15 +12,20 @@
 #import "RadarConfig.h"
 #import "RadarCoordinate+Internal.h"
 #import "RadarDelegateHolder.h"
+#import "RadarEnumMapping.h"
 #import "RadarLocationManager.h"
 #import "RadarLogger.h"
 #import "RadarSettings.h"
 #import "RadarState.h"
+#import "RadarTrackResponse.h"
 #import "RadarUtils.h"
 #import "RadarVerificationManager.h"
 #import "RadarReplayBuffer.h"
 #import "RadarNotificationHelper.h"
 #import "RadarTripOptions.h"
+#import "RadarTrip+Internal.h"
+#import "RadarUser+Internal.h"
+#import "RadarURLSession.h"
 #import "RadarIndoorsProtocol.h"
 #import "RadarIndoors.h"
 #import "RadarInAppMessageDelegate.h"
@@ -177,10 +182,10 @@ BOOL _initialized = NO;
                                                 }
                                             }
                                             if (sdkConfiguration.startTrackingOnInitialize && ![RadarSettings tracking]) {
-                                                [Radar startTrackingWithOptions:[Radar getTrackingOptions]];
+                                                [Radar startTrackingWithOptions:[RadarSettings effectiveTrackingOptions]];
                                             }
                                             if (sdkConfiguration.trackOnceOnAppOpen) {
-                                                [Radar trackOnceWithDesiredAccuracy:RadarTrackingOptionsDesiredAccuracyMedium beacons:[Radar getTrackingOptions].beacons completionHandler:nil];
+                                                [Radar trackOnceWithDesiredAccuracy:RadarTrackingOptionsDesiredAccuracyMedium beacons:[RadarSettings effectiveTrackingOptions].beacons completionHandler:nil];
                                             }
 
                                             [self flushLogs];
@@ -328,7 +333,7 @@ BOOL _initialized = NO;
                                           replayed:NO
                                            beacons:beacons
                                     indoorLocation:indoorLocation
-                                 completionHandler:^(RadarStatus status, NSDictionary *_Nullable res, NSArray<RadarEvent *> *_Nullable events, RadarUser *_Nullable user,
+                                 completionHandler:^(RadarStatus status, NSDictionary *_Nullable res, NSArray<RadarEvent *> *_Nullable events, RadarTrackResponse *_Nullable response,
                                                      NSArray<RadarGeofence *> *_Nullable nearbyGeofences, RadarConfig *_Nullable config, RadarVerifiedLocationToken *_Nullable token) {
                                      if (status == RadarStatusSuccess) {
                                          [[RadarLocationManager sharedInstance] replaceSyncedGeofences:nearbyGeofences];
@@ -338,14 +343,14 @@ BOOL _initialized = NO;
                                          // Only start/refresh indoor scanning here when continuous tracking is
                                          // also active. Indoor scan with only trackOnce is not supported
                                          // This just updates the indoor scanning with the current geofences
-                                         if (user && [RadarSettings tracking]) {
-                                             [[RadarIndoors shared] updateTrackingWithGeofences:user.geofences completionHandler:^{}];
+                                         if (response.hasUser && [RadarSettings tracking]) {
+                                             [[RadarIndoors shared] updateTrackingWithGeofences:response.user.geofences completionHandler:^{}];
                                          }
                                      }
 
                                      if (completionHandler) {
                                          [RadarUtilsDeprecated runOnMainThread:^{
-                                             completionHandler(status, location, events, user);
+                                             completionHandler(status, location, events, response.user);
                                          }];
                                      }
                                  }];
@@ -414,7 +419,7 @@ BOOL _initialized = NO;
                                                   replayed:NO
                                                    beacons:nil
                                             indoorLocation:indoorLocation
-                                         completionHandler:^(RadarStatus status, NSDictionary *_Nullable res, NSArray<RadarEvent *> *_Nullable events, RadarUser *_Nullable user,
+                                         completionHandler:^(RadarStatus status, NSDictionary *_Nullable res, NSArray<RadarEvent *> *_Nullable events, RadarTrackResponse *_Nullable response,
                                                              NSArray<RadarGeofence *> *_Nullable nearbyGeofences, RadarConfig *_Nullable config, RadarVerifiedLocationToken *_Nullable token) {
                                             
                                             if (status == RadarStatusSuccess) {
@@ -424,13 +429,13 @@ BOOL _initialized = NO;
                                                 // Only start/refresh indoor scanning here when continuous tracking is
                                                 // also active. Indoor scan with only trackOnce is not supported
                                                 // This just updates the indoor scanning with the current geofences
-                                                if (user && [RadarSettings tracking]) {
-                                                    [[RadarIndoors shared] updateTrackingWithGeofences:user.geofences completionHandler:^{}];
+                                                if (response.hasUser && [RadarSettings tracking]) {
+                                                    [[RadarIndoors shared] updateTrackingWithGeofences:response.user.geofences completionHandler:^{}];
                                                 }
                                             }
                                             if (completionHandler) {
                                                 [RadarUtilsDeprecated runOnMainThread:^{
-                                                    completionHandler(status, location, events, user);
+                                                    completionHandler(status, location, events, response.user);
                                                 }];
                                             }
                                          }];
@@ -575,11 +580,11 @@ BOOL _initialized = NO;
                                  replayed:NO
                                   beacons:nil
                            indoorLocation:nil
-                        completionHandler:^(RadarStatus status, NSDictionary *_Nullable res, NSArray<RadarEvent *> *_Nullable events, RadarUser *_Nullable user,
+                        completionHandler:^(RadarStatus status, NSDictionary *_Nullable res, NSArray<RadarEvent *> *_Nullable events, RadarTrackResponse *_Nullable response,
                                             NSArray<RadarGeofence *> *_Nullable nearbyGeofences, RadarConfig *_Nullable config, RadarVerifiedLocationToken *_Nullable token) {
                             if (completionHandler) {
                                 [RadarUtilsDeprecated runOnMainThread:^{
-                                    completionHandler(status, location, events, user);
+                                    completionHandler(status, location, events, response.user);
                                 }];
                             }
 
@@ -605,8 +610,7 @@ BOOL _initialized = NO;
 }
 
 + (RadarTrackingOptions *)getTrackingOptions {
-    RadarTrackingOptions *remoteTrackingOptions = [RadarSettings remoteTrackingOptions];
-    return remoteTrackingOptions ? remoteTrackingOptions : [RadarSettings trackingOptions];
+    return [RadarSettings effectiveTrackingOptions];
 }
 
 + (BOOL)isUsingRemoteTrackingOptions {
@@ -1599,70 +1603,11 @@ BOOL _initialized = NO;
 }
 
 + (NSString *)stringForActivityType:(RadarActivityType)type {
-    NSString *str;
-    switch (type) {
-    case RadarActivityTypeUnknown:
-        str = @"unknown";
-        break;
-    case RadarActivityTypeStationary:
-        str = @"stationary";
-        break;
-    case RadarActivityTypeFoot:
-        str = @"foot";
-        break;
-    case RadarActivityTypeRun:
-        str = @"run";
-        break;
-    case RadarActivityTypeBike:
-        str = @"bike";
-        break;
-    case RadarActivityTypeCar:
-        str = @"car";
-        break;
-    }
-    return str;
+    return [[RadarUser activityTypeMapping] stringForValue:type] ?: @"unknown";
 }
 
 + (NSString *)stringForLocationSource:(RadarLocationSource)source {
-    NSString *str;
-    switch (source) {
-    case RadarLocationSourceForegroundLocation:
-        str = @"FOREGROUND_LOCATION";
-        break;
-    case RadarLocationSourceBackgroundLocation:
-        str = @"BACKGROUND_LOCATION";
-        break;
-    case RadarLocationSourceManualLocation:
-        str = @"MANUAL_LOCATION";
-        break;
-    case RadarLocationSourceVisitArrival:
-        str = @"VISIT_ARRIVAL";
-        break;
-    case RadarLocationSourceVisitDeparture:
-        str = @"VISIT_DEPARTURE";
-        break;
-    case RadarLocationSourceGeofenceEnter:
-        str = @"GEOFENCE_ENTER";
-        break;
-    case RadarLocationSourceGeofenceExit:
-        str = @"GEOFENCE_EXIT";
-        break;
-    case RadarLocationSourceMockLocation:
-        str = @"MOCK_LOCATION";
-        break;
-    case RadarLocationSourceBeaconEnter:
-        str = @"BEACON_ENTER";
-        break;
-    case RadarLocationSourceBeaconExit:
-        str = @"BEACON_EXIT";
-        break;
-    case RadarLocationSourceIndoors:
-        str = @"INDOORS";
-        break;
-    case RadarLocationSourceUnknown:
-        str = @"UNKNOWN";
-    }
-    return str;
+    return [[RadarUser sourceMapping] stringForValue:source] ?: @"UNKNOWN";
 }
 
 + (NSString *)stringForMode:(RadarRouteMode)mode {
@@ -1670,30 +1615,7 @@ BOOL _initialized = NO;
 }
 
 + (NSString *)stringForTripStatus:(RadarTripStatus)status {
-    NSString *str;
-    switch (status) {
-    case RadarTripStatusStarted:
-        str = @"started";
-        break;
-    case RadarTripStatusApproaching:
-        str = @"approaching";
-        break;
-    case RadarTripStatusArrived:
-        str = @"arrived";
-        break;
-    case RadarTripStatusExpired:
-        str = @"expired";
-        break;
-    case RadarTripStatusCompleted:
-        str = @"completed";
-        break;
-    case RadarTripStatusCanceled:
-        str = @"canceled";
-        break;
-    default:
-        str = @"unknown";
-    }
-    return str;
+    return [[RadarTrip statusMapping] stringForValue:status] ?: @"unknown";
 }
 
 + (NSDictionary *)dictionaryForLocation:(CLLocation *)location {
@@ -1727,6 +1649,8 @@ BOOL _initialized = NO;
 }
 
 - (void)applicationWillEnterForeground {
+    [[RadarURLSession shared] prewarm];
+
     BOOL updated = [RadarSettings updateSessionId];
     if (updated) {
         [[RadarAPIClient sharedInstance] getConfigForUsage:@"resume"
@@ -1750,7 +1674,7 @@ BOOL _initialized = NO;
 
     RadarSdkConfiguration *sdkConfiguration = [RadarSettings sdkConfiguration];
     if (sdkConfiguration.trackOnceOnAppOpen) {
-        [Radar trackOnceWithDesiredAccuracy:RadarTrackingOptionsDesiredAccuracyMedium beacons: [Radar getTrackingOptions].beacons completionHandler:nil];
+        [Radar trackOnceWithDesiredAccuracy:RadarTrackingOptionsDesiredAccuracyMedium beacons:[RadarSettings effectiveTrackingOptions].beacons completionHandler:nil];
     }
 }
 
@@ -21,12 +21,14 @@
 #import "RadarVerifiedLocationToken.h"
 #import "RadarTripLeg.h"
 
+@class RadarTrackResponse;
+
 NS_ASSUME_NONNULL_BEGIN
 
 typedef void (^_Nonnull RadarTrackAPICompletionHandler)(RadarStatus status,
                                                         NSDictionary *_Nullable res,
                                                         NSArray<RadarEvent *> *_Nullable events,
-                                                        RadarUser *_Nullable user,
+                                                        RadarTrackResponse *_Nullable response,
                                                         NSArray<RadarGeofence *> *_Nullable nearbyGeofences,
                                                         RadarConfig *_Nullable config,
                                                         RadarVerifiedLocationToken *_Nullable token);
@@ -64,9 +66,12 @@ typedef void (^_Nonnull RadarSendEventAPICompletionHandler)(RadarStatus status,
 
 typedef void (^_Nonnull RadarSyncLogsAPICompletionHandler)(RadarStatus status);
 
+@class RadarTrackCoalescer;
+
 @interface RadarAPIClient : NSObject
 
 @property (nonnull, strong, nonatomic) RadarAPIHelper *apiHelper;
+@property (nonnull, strong, nonatomic) RadarTrackCoalescer *trackCoalescer;
 
 + (instancetype)sharedInstance;
 
@@ -28,6 +28,8 @@
 #import "RadarSdkConfiguration.h"
 #import "RadarSettings.h"
 #import "RadarState.h"
+#import "RadarTrackCoalescer.h"
+#import "RadarTrackResponse.h"
 #import "RadarTrip+Internal.h"
 #import "RadarTripOptions.h"
 #import "RadarTripLeg.h"
@@ -61,6 +63,7 @@
     self = [super init];
     if (self) {
         _apiHelper = [RadarAPIHelper new];
+        _trackCoalescer = [[RadarTrackCoalescer alloc] initWithWindow:1];
     }
     return self;
 }
@@ -185,13 +188,14 @@
                            logPayload:NO
                       extendedTimeout:YES
                     completionHandler:^(RadarStatus status, NSDictionary *_Nullable res, NSError *_Nullable error) {
-                            id eventsObj = res[@"events"];
-                            id userObj = res[@"user"];
-
-                            NSArray<RadarEvent *> *events = [RadarEvent eventsFromObject:eventsObj];
-                            RadarUser *user = [[RadarUser alloc] initWithObject:userObj];
-                            if (events && events.count) {
-                                [[RadarDelegateHolder sharedInstance] didReceiveEvents:events user:user];
+                            // the user is only built when there are events to deliver with it
+                            RadarTrackResponse *response = [[RadarTrackResponse alloc] initWithResponse:res];
+                            if (response.eventCount) {
+                                NSArray<RadarEvent *> *events = [RadarEvent eventsFromObject:response.eventsObject];
+                                RadarUser *user = [[RadarUser alloc] initWithObject:response.userObject];
+                                if (events && events.count) {
+                                    [[RadarDelegateHolder sharedInstance] didReceiveEvents:events user:user];
+                                }
                             }
 
                         completionHandler(status, res);
@@ -272,6 +276,53 @@
              revealRiskId:(NSString * _Nullable)revealRiskId
  useSecondaryVerifiedHost:(BOOL)useSecondaryVerifiedHost
         completionHandler:(RadarTrackAPICompletionHandler _Nonnull)completionHandler {
+    // verified tracks carry a one-time fraud payload, so only unverified ones are shared
+    NSString *coalescingKey = verified ? nil
+                                       : [RadarTrackCoalescer keyForLocation:location
+                                                                      source:source
+                                                                     stopped:stopped
+                                                                  foreground:foreground
+                                                                    replayed:replayed
+                                                                     beacons:beacons
+                                                              indoorLocation:indoorLocation];
+    [self.trackCoalescer coalesceTrackWithKey:coalescingKey
+                                      request:^(RadarTrackAPICompletionHandler sharedCompletionHandler) {
+                                          [self sendTrackWithLocation:location
+                                                              stopped:stopped
+                                                           foreground:foreground
+                                                               source:source
+                                                             replayed:replayed
+                                                              beacons:beacons
+                                                       indoorLocation:indoorLocation
+                                                             verified:verified
+                                                         fraudPayload:fraudPayload
+                                                  expectedCountryCode:expectedCountryCode
+                                                    expectedStateCode:expectedStateCode
+                                                               reason:reason
+                                                        transactionId:transactionId
+                                                         revealRiskId:revealRiskId
+                                             useSecondaryVerifiedHost:useSecondaryVerifiedHost
+                                                    completionHandler:sharedCompletionHandler];
+                                      }
+                            completionHandler:completionHandler];
+}
+
+- (void)sendTrackWithLocation:(CLLocation *_Nonnull)location
+                      stopped:(BOOL)stopped
+                   foreground:(BOOL)foreground
+                       source:(RadarLocationSource)source
+                     replayed:(BOOL)replayed
+                      beacons:(NSArray<RadarBeacon *> *_Nullable)beacons
+               indoorLocation:(CLLocation *_Nullable)indoorLocation
+                     verified:(BOOL)verified
+                 fraudPayload:(NSString * _Nullable)fraudPayload
+          expectedCountryCode:(NSString * _Nullable)expectedCountryCode
+            expectedStateCode:(NSString * _Nullable)expectedStateCode
+                       reason:(NSString * _Nullable)reason
+                transactionId:(NSString * _Nullable)transactionId
+                 revealRiskId:(NSString * _Nullable)revealRiskId
+     useSecondaryVerifiedHost:(BOOL)useSecondaryVerifiedHost
+            completionHandler:(RadarTrackAPICompletionHandler _Nonnull)completionHandler {
     NSString *publishableKey = [RadarSettings publishableKey];
     if (!publishableKey) {
         return completionHandler(RadarStatusErrorPublishableKey, nil, nil, nil, nil, nil, nil);
@@ -359,7 +410,7 @@
         [tripParams setValue:[Radar stringForMode:tripOptions.mode] forKey:@"mode"];
         params[@"tripOptions"] = tripParams;
     }
-    RadarTrackingOptions *options = [Radar getTrackingOptions];
+    RadarTrackingOptions *options = [RadarSettings effectiveTrackingOptions];
     if (options.syncGeofences) {
         params[@"nearbyGeofences"] = @(YES);
     }
@@ -518,7 +569,7 @@
                 locationMetadata:(NSDictionary *)locationMetadata
             completionHandler:(RadarTrackAPICompletionHandler)completionHandler {
     
-    BOOL batchingEnabled = (options.batchSize > 0 || options.batchInterval > 0);
+    BOOL batchingEnabled = (options.batchSize > 0 || options.batchInterval > 0 || options.batchAdaptive);
 
     if (batchingEnabled && source != RadarLocationSourceManualLocation && source != RadarLocationSourceForegroundLocation) {
         NSMutableDictionary *batchParams = [params mutableCopy];
@@ -526,7 +577,11 @@
         RadarReplayBuffer *buffer = [RadarReplayBuffer sharedInstance];
         [buffer addToBatch:batchParams options:options];
 
-        if ([buffer shouldFlushBatchWithOptions:options]) {
+        if (options.batchAdaptive && [buffer consumeBatchEventForLocation:location]) {
+            [[RadarLogger sharedInstance] logWithLevel:RadarLogLevelDebug
+                                               message:@"Flushing batch: geofence or place state changed"];
+            [buffer flushBatch];
+        } else if ([buffer shouldFlushBatchWithOptions:options]) {
             [[RadarLogger sharedInstance] logWithLevel:RadarLogLevelDebug
                                                message:@"Flushing batch: size limit reached"];
             [buffer flushBatch];
@@ -546,7 +601,6 @@
     NSArray<RadarReplay *> *replays = [[RadarReplayBuffer sharedInstance] flushableReplays];
     NSUInteger replayCount = replays.count;
     [[RadarLogger sharedInstance] logWithLevel:RadarLogLevelDebug message:[NSString stringWithFormat:@"Checking replays in API client | replayCount = %lu", (unsigned long)replayCount]];
-    NSMutableDictionary *requestParams = [params mutableCopy];
 
     BOOL replaying = options.replay == RadarTrackingOptionsReplayAll && replayCount > 0 && !verified;
     if (replaying) {
@@ -579,7 +633,7 @@
         [self.apiHelper requestWithMethod:@"POST"
                                     url:url
                                 headers:headers
-                                params:requestParams
+                                params:params
                                     sleep:YES
                             logPayload:YES
                         extendedTimeout:NO
@@ -634,15 +688,11 @@
 
                             RadarConfig *config = [RadarConfig fromDictionary:res];
 
-                            id eventsObj = res[@"events"];
-                            id userObj = res[@"user"];
-                            if ([userObj isKindOfClass:[NSDictionary class]]) {
-                                NSMutableDictionary *mutableUserObj = [userObj mutableCopy];
-                                mutableUserObj[@"metadata"] = locationMetadata;
-                                userObj = mutableUserObj;
-                                
+                            RadarTrackResponse *response = [[RadarTrackResponse alloc] initWithResponse:res locationMetadata:locationMetadata];
+                            NSDictionary *userObj = response.userObject;
+                            if (userObj) {
                                 // Extract and store altitudeAdjustments from user object
-                                id altitudeAdjustmentsObj = mutableUserObj[@"altitudeAdjustments"];
+                                id altitudeAdjustmentsObj = userObj[@"altitudeAdjustments"];
                                 if ([altitudeAdjustmentsObj isKindOfClass:[NSArray class]]) {
                                     [RadarState setAltitudeAdjustments:(NSArray *)altitudeAdjustmentsObj];
                                     [[RadarLogger sharedInstance] logWithLevel:RadarLogLevelDebug message:[NSString stringWithFormat:@"Stored %lu altitude adjustments from track response", (unsigned long)[(NSArray *)altitudeAdjustmentsObj count]]];
@@ -650,72 +700,38 @@
                                     [RadarState setAltitudeAdjustments:nil];
                                 }
                             }
-                            id nearbyGeofencesObj = res[@"nearbyGeofences"];
                             id inAppMessagesObj = res[@"inAppMessages"];
-                            NSArray<RadarEvent *> *events = [RadarEvent eventsFromObject:eventsObj];
-                            RadarUser *user = [[RadarUser alloc] initWithObject:userObj];
-                            NSArray<RadarGeofence *> *nearbyGeofences = [RadarGeofence geofencesFromObject:nearbyGeofencesObj];
-                            RadarVerifiedLocationToken *token = [[RadarVerifiedLocationToken alloc] initWithObject:res];
+                            // model objects are only built when there is something to build; the token repeats the user and events, so
+                            // building it for a response without one would build them twice for nothing. The user is built by
+                            // response.user, only for a delegate or completion handler that reads it
+                            NSArray<RadarEvent *> *events = response.eventCount ? [RadarEvent eventsFromObject:response.eventsObject] : (response.eventsObject ? @[] : nil);
+                            NSArray<RadarGeofence *> *nearbyGeofences = response.nearbyGeofencesObject ? [RadarGeofence geofencesFromObject:response.nearbyGeofencesObject] : nil;
+                            RadarVerifiedLocationToken *token = response.hasToken ? [[RadarVerifiedLocationToken alloc] initWithObject:res] : nil;
 
                             NSArray<RadarInAppMessage *> *inAppMessages = [RadarInAppMessage fromArray:inAppMessagesObj];
                             if (inAppMessages) {
                                 [[RadarInAppMessageManager shared] onInAppMessageReceivedWithMessages:inAppMessages];
                             }
                                    
-                            if (user) {
-                                BOOL inGeofences = user.geofences && user.geofences.count;
-                                BOOL atPlace = user.place != nil;
-                                BOOL canExit = inGeofences || atPlace;
-                                [RadarState setCanExit:canExit];
-
-                                NSMutableArray *geofenceIds = [NSMutableArray new];
-                                if (user.geofences) {
-                                    for (RadarGeofence *geofence in user.geofences) {
-                                        [geofenceIds addObject:geofence._id];
-                                    }
-                                }
-                                [RadarState setGeofenceIds:geofenceIds];
-
-                                NSString *placeId = nil;
-                                if (user.place) {
-                                    placeId = user.place._id;
-                                }
-                                [RadarState setPlaceId:placeId];
-
-                                NSMutableArray *regionIds = [NSMutableArray new];
-                                if (user.country) {
-                                    [regionIds addObject:user.country._id];
-                                }
-                                if (user.state) {
-                                    [regionIds addObject:user.state._id];
-                                }
-                                if (user.dma) {
-                                    [regionIds addObject:user.dma._id];
-                                }
-                                if (user.postalCode) {
-                                    [regionIds addObject:user.postalCode._id];
-                                }
-                                [RadarState setRegionIds:regionIds];
-
-                                NSMutableArray *beaconIds = [NSMutableArray new];
-                                if (user.beacons) {
-                                    for (RadarBeacon *beacon in user.beacons) {
-                                        [beaconIds addObject:beacon._id];
-                                    }
-                                }
-                                [RadarState setBeaconIds:beaconIds];
+                            if (response.hasUser) {
+                                [RadarState setCanExit:response.canExit];
+                                [RadarState setGeofenceIds:response.geofenceIds];
+                                [RadarState setPlaceId:response.placeId];
+                                [RadarState setRegionIds:response.regionIds];
+                                [RadarState setBeaconIds:response.beaconIds];
                             }
             
                             [RadarOfflineEventManager reset];
 
-                            if (events && user) {
-                                [RadarSettings setId:user._id];
-                                [RadarState setRadarUser:user];
+                            if (events && response.hasUser) {
+                                [RadarSettings setId:response.userId];
+                                [RadarState setRadarUserObject:userObj];
 
                                 // Update local trip state from server response
-                                if (user.trip) {
+                                RadarTrip *trip = response.tripObject ? [[RadarTrip alloc] initWithObject:response.tripObject] : nil;
+                                if (trip) {
                                     // Update local trip with latest state (ETAs, leg statuses, etc.)
-                                    [RadarSettings setTrip:user.trip];
+                                    [RadarSettings setTrip:trip];
                                 } else if ([RadarSettings tripOptions]) {
                                     // Trip ended server-side - restore previous tracking options
                                     [[RadarLocationManager sharedInstance] restartPreviousTrackingOptions];
@@ -723,14 +739,14 @@
                                     [RadarSettings setTrip:nil];
                                 }
 
-                                [RadarSettings setUserDebug:user.debug];
+                                [RadarSettings setUserDebug:response.userDebug];
 
                                 if (location) {
-                                    [[RadarDelegateHolder sharedInstance] didUpdateLocation:location user:user];
+                                    [[RadarDelegateHolder sharedInstance] didUpdateLocation:location response:response];
                                 }
 
                                 if (events.count) {
-                                    [[RadarDelegateHolder sharedInstance] didReceiveEvents:events user:user];
+                                    [[RadarDelegateHolder sharedInstance] didReceiveEvents:events user:response.user];
                                 }
                                 
                                 if (token) {
@@ -743,7 +759,7 @@
                                     [[RadarBeaconManagerSwift shared] registerBeaconRegionNotificationsFromArray:beaconRegions];
                                 }
                                 
-                                return completionHandler(RadarStatusSuccess, res, events, user, nearbyGeofences, config, token);
+                                return completionHandler(RadarStatusSuccess, res, events, response, nearbyGeofences, config, token);
                             } else {
                                 [[RadarLogger sharedInstance] logWithLevel:RadarLogLevelInfo message:[NSString stringWithFormat:@"Setting %lu notifications remaining", (unsigned long)notificationsRemaining.count]];
                                 [RadarState setRegisteredNotifications:notificationsRemaining];
@@ -818,7 +834,7 @@
     params[@"mode"] = [Radar stringForMode:options.mode];
 
     if (options.scheduledArrivalAt) {
-        params[@"scheduledArrivalAt"] = [[RadarUtils isoDateFormatter] stringFromDate:options.scheduledArrivalAt];
+        params[@"scheduledArrivalAt"] = [RadarUtils isoStringFromDate:options.scheduledArrivalAt];
     }
 
     if (options.approachingThreshold > 0) {
@@ -893,7 +909,7 @@
     params[@"mode"] = [Radar stringForMode:options.mode];
 
     if (options.scheduledArrivalAt) {
-        params[@"scheduledArrivalAt"] = [[RadarUtils isoDateFormatter] stringFromDate:options.scheduledArrivalAt];
+        params[@"scheduledArrivalAt"] = [RadarUtils isoStringFromDate:options.scheduledArrivalAt];
     }
 
     if (options.approachingThreshold > 0) {
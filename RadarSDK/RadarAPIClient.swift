@@ -37,7 +37,9 @@ public final class RadarAPIClient: Sendable {
         return data
     }
 
-    func fetchSyncRegion(latitude: Double, longitude: Double) async throws -> SyncRegionResponse {
+    /// Fetches the sync region around a coordinate. When `version` is set the server may answer
+    /// `304 Not Modified` or with a delta against that version instead of the full region.
+    func fetchSyncRegion(latitude: Double, longitude: Double, version baseVersion: String? = nil) async throws -> SyncRegionResponse {
         var body: [String: Any?] = [
             "latitude": latitude,
             "longitude": longitude,
@@ -47,60 +49,69 @@ public final class RadarAPIClient: Sendable {
             body["userId"] = userId
         }
 
-        let (data, _) = try await apiHelper.radarRequest(
+        var headers = [String: String]()
+        if let baseVersion {
+            body["syncVersion"] = baseVersion
+            headers["If-None-Match"] = "\"\(baseVersion)\""
+        }
+
+        let (data, response) = try await apiHelper.radarRequest(
             method: "POST",
             url: "sync/region",
+            headers: headers,
             body: body
         )
 
-        guard let res = try JSONSerialization.jsonObject(with: data) as? [String: Any] else {
-            throw URLError(.cannotParseResponse)
+        if response.statusCode == 304, let baseVersion {
+            return SyncRegionResponse(geofences: nil, places: nil, beacons: nil, regionCenter: nil, regionRadius: nil, version: baseVersion, notModified: true)
         }
 
-        let decoder = JSONDecoder()
-
-        var geofences: [RadarGeofenceSwift]?
-        if let arr = res["geofences"] as? [[String: Any]],
-            let jsonData = try? JSONSerialization.data(withJSONObject: arr)
-        {
-            geofences = try? decoder.decode([RadarGeofenceSwift].self, from: jsonData)
-        }
-
-        var places: [RadarPlaceSwift]?
-        if let arr = res["places"] as? [[String: Any]],
-            let jsonData = try? JSONSerialization.data(withJSONObject: arr)
-        {
-            places = try? decoder.decode([RadarPlaceSwift].self, from: jsonData)
-        }
-
-        var beacons: [RadarBeaconSwift]?
-        if let arr = res["beacons"] as? [[String: Any]],
-            let jsonData = try? JSONSerialization.data(withJSONObject: arr)
-        {
-            beacons = try? decoder.decode([RadarBeaconSwift].self, from: jsonData)
+        let envelope: SyncRegionEnvelope
+        do {
+            envelope = try JSONDecoder().decode(SyncRegionEnvelope.self, from: data)
+        } catch {
+            throw URLError(.cannotParseResponse)
         }
 
-        var regionCenter: RadarCoordinateSwift?
-        var regionRadius: Double?
-        if let regionDict = res["region"] as? [String: Any],
-            let lat = regionDict["latitude"] as? Double,
-            let lng = regionDict["longitude"] as? Double,
-            let radius = regionDict["radius"] as? Double,
-            radius > 0
-        {
-            regionCenter = RadarCoordinateSwift(latitude: lat, longitude: lng)
-            regionRadius = radius
+        let version = envelope.version ?? Self.entityTag(response.value(forHTTPHeaderField: "ETag"))
+
+        // a delta is only meaningful against the version we sent
+        if baseVersion != nil, let delta = envelope.syncDelta {
+            return SyncRegionResponse(
+                geofences: nil,
+                places: nil,
+                beacons: nil,
+                regionCenter: envelope.regionCenter,
+                regionRadius: envelope.regionRadius,
+                version: version,
+                delta: delta
+            )
         }
 
         return SyncRegionResponse(
-            geofences: geofences,
-            places: places,
-            beacons: beacons,
-            regionCenter: regionCenter,
-            regionRadius: regionRadius
+            geofences: envelope.geofences,
+            places: envelope.places,
+            beacons: envelope.beacons,
+            regionCenter: envelope.regionCenter,
+            regionRadius: envelope.regionRadius,
+            version: version
         )
     }
 
+    /// Strips the weak prefix and quotes from an `ETag` header value.
+    static func entityTag(_ header: String?) -> String? {
+        guard var tag = header?.trimmingCharacters(in: .whitespaces), !tag.isEmpty else { return nil }
+        if tag.hasPrefix("W/") {
+            tag.removeFirst(2)
+        }
+        if tag.count >= 2 && tag.hasPrefix("\"") && tag.hasSuffix("\"") {
+            tag = String(tag.dropFirst().dropLast())
+        }
+        return tag
+    }
+
+    /// Sends one chunk of logs; `RadarLogBuffer.flush()` splits the buffer into chunks so a
+    /// failure only resends the logs that weren't acknowledged.
     func sendLogs(logs: [RadarLog]) async throws {
         let body: [String: Any?] = [
             "id": RadarSettings.id ?? "",
@@ -110,7 +121,7 @@ public final class RadarAPIClient: Sendable {
             "logs": logs.map(\.dict),
         ]
 
-        let (data, response) = try await apiHelper.radarRequest(method: "POST", url: "logs", body: body)
+        let (data, response) = try await apiHelper.radarRequest(method: "POST", url: "logs", body: body, compressBody: true)
 
         if response.statusCode >= 200 && response.statusCode < 300 {
             return
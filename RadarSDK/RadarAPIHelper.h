@@ -15,6 +15,13 @@ typedef void (^_Nullable RadarAPICompletionHandler)(RadarStatus status, NSDictio
 
 @interface RadarAPIHelper : NSObject
 
+/**
+ Minimum seconds between the starts of requests made with `sleep:YES`. Defaults to 1.
+ */
+@property (assign, nonatomic) NSTimeInterval requestSpacing;
+
+- (instancetype)initWithSession:(NSURLSession *)session;
+
 - (void)requestWithMethod:(NSString *)method
                       url:(NSString *)url
                   headers:(NSDictionary *_Nullable)headers
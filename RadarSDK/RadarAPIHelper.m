@@ -7,8 +7,11 @@
 
 #import "RadarAPIHelper.h"
 
+#import "RadarJSONWriter.h"
 #import "RadarLogger.h"
+#import "RadarRequestScheduler.h"
 #import "RadarSettings.h"
+#import "RadarURLSession.h"
 #import "RadarUtils.h"
 
 #import <math.h>
@@ -37,37 +40,40 @@ static NSTimeInterval RadarAPIHelperExtendedNetworkTimeoutInterval(NSTimeInterva
 @interface RadarAPIHelper ()
 
 @property (strong, nonatomic) dispatch_queue_t queue;
-@property (strong, nonatomic) dispatch_semaphore_t semaphore;
-@property (assign, nonatomic) BOOL wait;
-@property (strong, nonatomic) NSURLSession *standardSession;
-@property (strong, nonatomic) NSURLSession *extendedTimeoutSession;
+@property (strong, nonatomic) RadarRequestScheduler *scheduler;
+@property (strong, nonatomic) NSURLSession *session;
+@property (assign, nonatomic) NSTimeInterval standardTimeout;
+@property (assign, nonatomic) NSTimeInterval extendedTimeout;
 
 @end
 
 @implementation RadarAPIHelper
 
 - (instancetype)init {
+    // one shared session keeps a single pooled connection to the API; timeouts are set per request
+    return [self initWithSession:[RadarURLSession shared].session];
+}
+
+- (instancetype)initWithSession:(NSURLSession *)session {
     self = [super init];
     if (self) {
         _queue = dispatch_queue_create("io.radar.api", DISPATCH_QUEUE_SERIAL);
-        _semaphore = dispatch_semaphore_create(1);
-
-        NSTimeInterval standardTimeout = RadarAPIHelperStandardNetworkTimeoutInterval();
-        NSTimeInterval extendedTimeout = RadarAPIHelperExtendedNetworkTimeoutInterval(standardTimeout);
-
-        NSURLSessionConfiguration *standardConfig = [NSURLSessionConfiguration ephemeralSessionConfiguration];
-        standardConfig.timeoutIntervalForRequest = standardTimeout;
-        standardConfig.timeoutIntervalForResource = standardTimeout;
-        _standardSession = [NSURLSession sessionWithConfiguration:standardConfig];
-
-        NSURLSessionConfiguration *extendedConfig = [NSURLSessionConfiguration defaultSessionConfiguration];
-        extendedConfig.timeoutIntervalForRequest = extendedTimeout;
-        extendedConfig.timeoutIntervalForResource = extendedTimeout;
-        _extendedTimeoutSession = [NSURLSession sessionWithConfiguration:extendedConfig];
+        _scheduler = [[RadarRequestScheduler alloc] initWithQueue:_queue spacing:1];
+        _session = session;
+        _standardTimeout = RadarAPIHelperStandardNetworkTimeoutInterval();
+        _extendedTimeout = RadarAPIHelperExtendedNetworkTimeoutInterval(_standardTimeout);
     }
     return self;
 }
 
+- (NSTimeInterval)requestSpacing {
+    return self.scheduler.spacing;
+}
+
+- (void)setRequestSpacing:(NSTimeInterval)requestSpacing {
+    self.scheduler.spacing = requestSpacing;
+}
+
 - (void)requestWithMethod:(NSString *)method
                       url:(NSString *)url
                   headers:(NSDictionary *)headers
@@ -76,25 +82,24 @@ static NSTimeInterval RadarAPIHelperExtendedNetworkTimeoutInterval(NSTimeInterva
                logPayload:(BOOL)logPayload
           extendedTimeout:(BOOL)extendedTimeout
         completionHandler:(RadarAPICompletionHandler)completionHandler {
-    dispatch_async(self.queue, ^{
-        if (sleep) {
-            dispatch_semaphore_wait(self.semaphore, DISPATCH_TIME_FOREVER);
-        }
-
+    // completions run on the main queue; scheduled requests deliver theirs in the order they were sent, so a slow
+    // response can't be applied after a newer one
+    void (^performRequest)(NSTimeInterval, RadarScheduledDelivery) = ^(NSTimeInterval queueLatency, RadarScheduledDelivery deliver) {
         NSMutableURLRequest *req = [[NSMutableURLRequest alloc] initWithURL:[NSURL URLWithString:url]];
         req.HTTPMethod = method;
-
-        NSString *paramJsonStr = [RadarUtils dictionaryToJson:params];
-        NSString *headersJsonStr = [RadarUtils dictionaryToJson:headers];
-
-        if (logPayload) {
-            [[RadarLogger sharedInstance]
-                logWithLevel:RadarLogLevelDebug
-                     message:[NSString stringWithFormat:@"📍 Radar API request | method = %@; url = %@; headers = %@; params = %@", method, url, headersJsonStr, paramJsonStr]];
-        } else {
-            [[RadarLogger sharedInstance] logWithLevel:RadarLogLevelDebug
-                                               message:[NSString stringWithFormat:@"📍 Radar API request | method = %@; url = %@; headers = %@", method, url, headersJsonStr]];
-        }
+        req.timeoutInterval = extendedTimeout ? self.extendedTimeout : self.standardTimeout;
+
+        // headers and params are only serialized for the log when debug logging is on
+        [[RadarLogger sharedInstance] logWithLevel:RadarLogLevelDebug
+                                      messageBlock:^NSString * {
+                                          NSString *headersJsonStr = [RadarUtils dictionaryToJson:headers];
+                                          if (logPayload) {
+                                              return [NSString stringWithFormat:@"📍 Radar API request | method = %@; url = %@; queueLatency = %f; headers = %@; params = %@", method, url,
+                                                                                queueLatency, headersJsonStr, [RadarUtils dictionaryToJson:params]];
+                                          }
+                                          return [NSString stringWithFormat:@"📍 Radar API request | method = %@; url = %@; queueLatency = %f; headers = %@", method, url, queueLatency,
+                                                                            headersJsonStr];
+                                      }];
 
         @try {
             if (headers) {
@@ -104,39 +109,12 @@ static NSTimeInterval RadarAPIHelperExtendedNetworkTimeoutInterval(NSTimeInterva
             }
 
             if (params) {
-                NSNumber *prevUpdatedAtMsDiff = params[@"updatedAtMsDiff"];
-                NSArray *replays = params[@"replays"];
-                if (prevUpdatedAtMsDiff || replays) {
-                    NSMutableDictionary *requestParams = [params mutableCopy];
-                    long nowMs = (long)([NSDate date].timeIntervalSince1970 * 1000);
-                    NSNumber *locationMs = params[@"locationMs"];
-
-                    if (locationMs != nil && prevUpdatedAtMsDiff != nil) {
-                        long updatedAtMsDiff = nowMs - [locationMs longValue];
-                        requestParams[@"updatedAtMsDiff"] = @(updatedAtMsDiff);
-                    }
-
-                    if (replays) {
-                        NSMutableArray *updatedReplays = [NSMutableArray arrayWithCapacity:replays.count];
-                        for (NSDictionary *replay in replays) {
-                            NSMutableDictionary *updatedReplay = [replay mutableCopy];
-                            NSNumber *replayLocationMs = replay[@"locationMs"];
-                            if (replayLocationMs != nil) {
-                                long replayUpdatedAtMsDiff = nowMs - [replayLocationMs longValue];
-                                updatedReplay[@"updatedAtMsDiff"] = @(replayUpdatedAtMsDiff);
-                            }
-                            [updatedReplays addObject:updatedReplay];
-                        }
-                        requestParams[@"replays"] = updatedReplays;
-                    }
-
-                    [req setHTTPBody:[RadarUtils jsonData:requestParams]];
-                } else {
-                    [req setHTTPBody:[RadarUtils jsonData:params]];
-                }
+                // updatedAtMsDiff for the request and its replays is stamped while the body is written
+                long long nowMs = (long long)([NSDate date].timeIntervalSince1970 * 1000);
+                [req setHTTPBody:[RadarJSONWriter requestBodyWithParams:params nowMs:nowMs]];
             }
 
-            NSURLSession *session = extendedTimeout ? self.extendedTimeoutSession : self.standardSession;
+            NSURLSession *session = self.session;
             NSDate *requestStart = [NSDate date];
 
             void (^dataTaskCompletionHandler)(NSData *, NSURLResponse *, NSError *) = ^(NSData *data, NSURLResponse *response, NSError *error) {
@@ -145,7 +123,7 @@ static NSTimeInterval RadarAPIHelperExtendedNetworkTimeoutInterval(NSTimeInterva
                 if (error) {
                     long elapsedMs = (long)(latency * 1000);
                     NSString *host = req.URL.host ?: @"unknown";
-                    dispatch_async(dispatch_get_main_queue(), ^{
+                    deliver(^{
                         [[RadarLogger sharedInstance]
                             logWithLevel:RadarLogLevelError
                                     type:RadarLogTypeSDKError
@@ -154,26 +132,16 @@ static NSTimeInterval RadarAPIHelperExtendedNetworkTimeoutInterval(NSTimeInterva
                         completionHandler(RadarStatusErrorNetwork, nil, error);
                     });
 
-                    if (sleep) {
-                        [NSThread sleepForTimeInterval:1];
-                        dispatch_semaphore_signal(self.semaphore);
-                    }
-
                     return;
                 }
 
                 NSError *deserializationError = nil;
                 id resObj = [NSJSONSerialization JSONObjectWithData:data options:0 error:&deserializationError];
                 if (deserializationError || ![resObj isKindOfClass:[NSDictionary class]]) {
-                    dispatch_async(dispatch_get_main_queue(), ^{
+                    deliver(^{
                         completionHandler(RadarStatusErrorServer, nil, deserializationError);
                     });
 
-                    if (sleep) {
-                        [NSThread sleepForTimeInterval:1];
-                        dispatch_semaphore_signal(self.semaphore);
-                    }
-
                     return;
                 }
 
@@ -201,37 +169,36 @@ static NSTimeInterval RadarAPIHelperExtendedNetworkTimeoutInterval(NSTimeInterva
                     }
 
                     res = (NSDictionary *)resObj;
-                    NSString *resJsonStr = [RadarUtils dictionaryToJson:res];
 
-                    if (params && [params objectForKey:@"replays"]) {
-                        NSArray *replays = [params objectForKey:@"replays"];
-                        [[RadarLogger sharedInstance]
-                            logWithLevel:RadarLogLevelDebug
-                                 message:[NSString stringWithFormat:@"📍 Radar API response | method = %@; url = %@; statusCode = %ld; latency = %f; replays = %lu; res = %@",
-                                                                    method, url, (long)statusCode, latency, (unsigned long)replays.count, resJsonStr]];
-                    } else {
-                        [[RadarLogger sharedInstance]
-                            logWithLevel:RadarLogLevelDebug
-                                 message:[NSString stringWithFormat:@"📍 Radar API response | method = %@; url = %@; statusCode = %ld; latency = %f; res = %@", method, url,
-                                                                    (long)statusCode, latency, resJsonStr]];
-                    }
+                    [[RadarLogger sharedInstance] logWithLevel:RadarLogLevelDebug
+                                                  messageBlock:^NSString * {
+                                                      NSString *resJsonStr = [RadarUtils dictionaryToJson:res];
+                                                      if (params && [params objectForKey:@"replays"]) {
+                                                          NSArray *replays = [params objectForKey:@"replays"];
+                                                          return [NSString stringWithFormat:@"📍 Radar API response | method = %@; url = %@; statusCode = %ld; latency = %f; replays = %lu; res = %@",
+                                                                                            method, url, (long)statusCode, latency, (unsigned long)replays.count, resJsonStr];
+                                                      }
+                                                      return [NSString stringWithFormat:@"📍 Radar API response | method = %@; url = %@; statusCode = %ld; latency = %f; res = %@", method, url,
+                                                                                        (long)statusCode, latency, resJsonStr];
+                                                  }];
                 }
 
-                dispatch_async(dispatch_get_main_queue(), ^{
+                deliver(^{
                     completionHandler(status, res, nil);
                 });
-
-                if (sleep) {
-                    [NSThread sleepForTimeInterval:1];
-                    dispatch_semaphore_signal(self.semaphore);
-                }
             };
 
+            // timeoutInterval only bounds idle time, so the request and its retry are cancelled once it has passed overall
+            NSMutableArray<NSURLSessionDataTask *> *tasks = [NSMutableArray new];
+
             void (^dataTaskRetryHandler)(NSData *, NSURLResponse *, NSError *) = ^(NSData *data, NSURLResponse *response, NSError *error) {
                 if (error && [error.domain isEqualToString:NSURLErrorDomain] && error.code == NSURLErrorNetworkConnectionLost) {
                     [[RadarLogger sharedInstance] logWithLevel:RadarLogLevelDebug
                                                        message:[NSString stringWithFormat:@"📍 Radar API retrying after lost connection | url = %@", url]];
                     NSURLSessionDataTask *retryTask = [session dataTaskWithRequest:req completionHandler:dataTaskCompletionHandler];
+                    @synchronized(tasks) {
+                        [tasks addObject:retryTask];
+                    }
                     [retryTask resume];
                 } else {
                     dataTaskCompletionHandler(data, response, error);
@@ -239,23 +206,43 @@ static NSTimeInterval RadarAPIHelperExtendedNetworkTimeoutInterval(NSTimeInterva
             };
 
             NSURLSessionDataTask *task = [session dataTaskWithRequest:req completionHandler:dataTaskRetryHandler];
+            @synchronized(tasks) {
+                [tasks addObject:task];
+            }
             [task resume];
+            dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(req.timeoutInterval * NSEC_PER_SEC)), self.queue, ^{
+                @synchronized(tasks) {
+                    for (NSURLSessionDataTask *runningTask in tasks) {
+                        [runningTask cancel];
+                    }
+                }
+            });
         } @catch (NSException *exception) {
-            if (sleep) {
-                dispatch_semaphore_signal(self.semaphore);
-            }
             NSError *exceptionError = [NSError errorWithDomain:@"RadarSDK"
                                                           code:0
                                                       userInfo:@{
                                                           NSLocalizedDescriptionKey: exception.reason ?: exception.name ?: @"NSException",
                                                           @"NSException": exception
                                                       }];
-            dispatch_async(dispatch_get_main_queue(), ^{
+            deliver(^{
                 completionHandler(RadarStatusErrorBadRequest, nil, exceptionError);
             });
             return;
         }
-    });
+    };
+
+    // rate-limited requests are spaced out on a timer rather than waiting for each other's responses
+    if (sleep) {
+        [self.scheduler scheduleBlock:^(NSTimeInterval queueLatency, RadarScheduledDelivery deliver) {
+            performRequest(queueLatency, deliver);
+        }];
+    } else {
+        dispatch_async(self.queue, ^{
+            performRequest(0, ^(dispatch_block_t completion) {
+                dispatch_async(dispatch_get_main_queue(), completion);
+            });
+        });
+    }
 }
 
 @end
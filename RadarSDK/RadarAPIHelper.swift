@@ -15,35 +15,55 @@ extension URLSession: RadarURLSessionProtocol {}
 final class RadarAPIHelper: Sendable {
 
     let session: RadarURLSessionProtocol
+    let timeoutInterval: TimeInterval
 
-    init(session: RadarURLSessionProtocol? = nil) {
-        if let session {
-            self.session = session
-        } else {
-            let config = URLSessionConfiguration.default
-            config.timeoutIntervalForRequest = 10
-            config.timeoutIntervalForResource = 10
-            self.session = URLSession(configuration: config)
-        }
+    init(session: RadarURLSessionProtocol? = nil, timeoutInterval: TimeInterval = 10) {
+        self.session = session ?? RadarURLSession.shared.session
+        self.timeoutInterval = timeoutInterval
     }
 
     func retryingRequest(for request: URLRequest) async throws -> (Data, URLResponse) {
-        do {
-            let (data, response) = try await session.data(for: request)
-            return (data, response)
-        } catch {
-            if let error = error as? URLError,
-                error.code == .networkConnectionLost
-            {
+        // the request's timeoutInterval only bounds idle time, so the whole request, retry included, is also cut off after it
+        try await Self.withDeadline(request.timeoutInterval) { [session] in
+            do {
                 let (data, response) = try await session.data(for: request)
                 return (data, response)
+            } catch {
+                if let error = error as? URLError,
+                    error.code == .networkConnectionLost
+                {
+                    let (data, response) = try await session.data(for: request)
+                    return (data, response)
+                }
+
+                throw error
             }
+        }
+    }
 
-            throw error
+    /// Runs `operation`, cancelling it and throwing `URLError(.timedOut)` if it hasn't finished after `timeout` seconds.
+    static func withDeadline<T: Sendable>(_ timeout: TimeInterval, _ operation: @escaping @Sendable () async throws -> T) async throws -> T {
+        try await withThrowingTaskGroup(of: T.self) { group in
+            group.addTask {
+                try await operation()
+            }
+            group.addTask {
+                try await Task.sleep(nanoseconds: UInt64(max(timeout, 0) * 1_000_000_000))
+                throw URLError(.timedOut)
+            }
+            defer { group.cancelAll() }
+            guard let result = try await group.next() else {
+                throw URLError(.timedOut)
+            }
+            return result
         }
     }
 
-    func request(method: String, url: String, query: [String: String] = [:], headers: [String: String] = [:], body: [String: Any?] = [:]) async throws -> (Data, HTTPURLResponse) {
+    /// With `compressBody`, a body of at least `RadarGzip.minimumLength` bytes is sent gzip
+    /// encoded with `Content-Encoding: gzip` when that makes it smaller.
+    func request(
+        method: String, url: String, query: [String: String] = [:], headers: [String: String] = [:], body: [String: Any?] = [:], compressBody: Bool = false
+    ) async throws -> (Data, HTTPURLResponse) {
         let queryString =
             query.isEmpty
             ? ""
@@ -56,7 +76,7 @@ final class RadarAPIHelper: Sendable {
             throw URLError(.badURL)
         }
 
-        var request = URLRequest(url: urlObject)
+        var request = URLRequest(url: urlObject, timeoutInterval: timeoutInterval)
         request.httpMethod = method
 
         headers.forEach { key, value in
@@ -64,7 +84,13 @@ final class RadarAPIHelper: Sendable {
         }
 
         if !body.isEmpty && (method == "POST" || method == "PUT" || method == "PATCH") {
-            request.httpBody = try JSONSerialization.data(withJSONObject: body, options: [])
+            let json = try JSONSerialization.data(withJSONObject: body, options: [])
+            if compressBody, json.count >= RadarGzip.minimumLength, let gzip = RadarGzip.compress(json) {
+                request.httpBody = gzip
+                request.setValue("gzip", forHTTPHeaderField: "Content-Encoding")
+            } else {
+                request.httpBody = json
+            }
         }
 
         let startTime = Date()
@@ -113,12 +139,14 @@ final class RadarAPIHelper: Sendable {
         return headers
     }
 
-    func radarRequest(method: String, url: String, query: [String: String] = [:], headers: [String: String] = [:], body: [String: Any?] = [:]) async throws -> (Data, HTTPURLResponse) {
+    func radarRequest(
+        method: String, url: String, query: [String: String] = [:], headers: [String: String] = [:], body: [String: Any?] = [:], compressBody: Bool = false
+    ) async throws -> (Data, HTTPURLResponse) {
 
         let headers = try await addRadarHeaders(headers)
         let url = "\(RadarSettings.host)/v1/\(url)"
 
-        let (data, response) = try await request(method: method, url: url, query: query, headers: headers, body: body)
+        let (data, response) = try await request(method: method, url: url, query: query, headers: headers, body: body, compressBody: compressBody)
 
         return (data, response)
     }
@@ -0,0 +1,108 @@
+//
+//  RadarAdaptiveBatchPolicy.swift
+//  RadarSDK
+//
+//  Copyright © 2026 Radar Labs, Inc. All rights reserved.
+//
+
+import Foundation
+
+/// Batch size and flush interval for `RadarTrackingOptions.batchAdaptive`.
+///
+/// Routine fixes are held longer on cellular, where each flush wakes the radio, than on
+/// wifi, and shorter while the app is in the foreground. Slow or failing flushes stretch the
+/// interval so a bad network isn't retried at full rate. Fixes that change geofence or place
+/// state are marked with `markEvent(at:)` and flush the batch right away.
+final class RadarAdaptiveBatchPolicy: @unchecked Sendable {
+
+    struct Limits: Equatable {
+        let size: Int
+        let interval: TimeInterval
+    }
+
+    /// Flushes slower than this, on average, double the interval.
+    static let slowLatency: TimeInterval = 2
+    static let maxInterval: TimeInterval = 900
+    // weight of the newest flush in the latency average
+    static let latencyWeight = 0.3
+    static let maxEventMarks = 8
+
+    private let lock = NSLock()
+    private var averageLatency: TimeInterval?
+    private var consecutiveFailures = 0
+    private var eventTimestamps = Set<Date>()
+
+    static func baseLimits(network: RadarConnectionType) -> Limits {
+        switch network {
+        case .wifi:
+            return Limits(size: 5, interval: 60)
+        case .cellular5g, .cellularLte, .cellular:
+            return Limits(size: 10, interval: 300)
+        case .cellular3g, .cellular2g:
+            return Limits(size: 20, interval: 600)
+        case .unknown:
+            // likely offline; hold fixes until a flush can get through
+            return Limits(size: 30, interval: maxInterval)
+        }
+    }
+
+    func limits(network: RadarConnectionType, foreground: Bool) -> Limits {
+        let base = Self.baseLimits(network: network)
+        var size = base.size
+        var interval = base.interval
+        if foreground {
+            size = max(size / 2, 1)
+            interval /= 2
+        }
+
+        lock.lock()
+        let latency = averageLatency
+        let failures = consecutiveFailures
+        lock.unlock()
+
+        if let latency, latency > Self.slowLatency {
+            interval *= 2
+        }
+        if failures > 0 {
+            interval *= TimeInterval(1 << min(failures, 3))
+        }
+        return Limits(size: size, interval: min(interval, Self.maxInterval))
+    }
+
+    func recordFlush(latency: TimeInterval, success: Bool) {
+        lock.lock()
+        defer { lock.unlock() }
+        if success {
+            consecutiveFailures = 0
+            averageLatency = averageLatency.map { $0 + Self.latencyWeight * (latency - $0) } ?? latency
+        } else {
+            consecutiveFailures += 1
+        }
+    }
+
+    /// Marks the fix taken at `timestamp` as changing geofence or place state.
+    func markEvent(at timestamp: Date) {
+        lock.lock()
+        // marks for fixes that never reached a batch, e.g. ones that failed before sending, are dropped
+        if eventTimestamps.count >= Self.maxEventMarks {
+            eventTimestamps.removeAll()
+        }
+        eventTimestamps.insert(timestamp)
+        lock.unlock()
+    }
+
+    /// Whether the fix taken at `timestamp` was marked by `markEvent(at:)`, clearing the mark.
+    func consumeEvent(at timestamp: Date) -> Bool {
+        lock.lock()
+        defer { lock.unlock() }
+        return eventTimestamps.remove(timestamp) != nil
+    }
+
+    func reset() {
+        lock.lock()
+        averageLatency = nil
+        consecutiveFailures = 0
+        eventTimestamps.removeAll()
+        lock.unlock()
+    }
+}
@@ -7,6 +7,7 @@
 
 #import "RadarAddress+Internal.h"
 #import "RadarCoordinate+Internal.h"
+#import "RadarEnumMapping.h"
 #import "RadarTimeZone+Internal.h"
 
 @implementation RadarAddress
@@ -268,15 +269,7 @@
 
     id confidenceObj = dict[@"confidence"];
     if (confidenceObj && [confidenceObj isKindOfClass:[NSString class]]) {
-        NSString *confidenceStr = (NSString *)confidenceObj;
-
-        if ([confidenceStr isEqualToString:@"exact"]) {
-            confidence = RadarAddressConfidenceExact;
-        } else if ([confidenceStr isEqualToString:@"interpolated"]) {
-            confidence = RadarAddressConfidenceInterpolated;
-        } else if ([confidenceStr isEqualToString:@"fallback"]) {
-            confidence = RadarAddressConfidenceFallback;
-        }
+        confidence = [[RadarAddress confidenceMapping] valueForString:confidenceObj defaultValue:RadarAddressConfidenceNone];
     }
     
     id timeZoneObj = dict[@"timeZone"];
@@ -336,31 +329,41 @@
     return arr;
 }
 
++ (RadarEnumMapping *)confidenceMapping {
+    static RadarEnumMapping *mapping;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        RadarEnumMappingEntry entries[] = {
+            {RadarAddressConfidenceExact, @"exact"},
+            {RadarAddressConfidenceInterpolated, @"interpolated"},
+            {RadarAddressConfidenceFallback, @"fallback"},
+        };
+        mapping = RadarEnumMappingMake(entries);
+    });
+    return mapping;
+}
+
 + (NSString *)stringForConfidence:(RadarAddressConfidence)confidence {
-    switch (confidence) {
-    case RadarAddressConfidenceExact:
-        return @"exact";
-    case RadarAddressConfidenceInterpolated:
-        return @"interpolated";
-    case RadarAddressConfidenceFallback:
-        return @"fallback";
-    default:
-        return @"none";
-    }
+    return [[RadarAddress confidenceMapping] stringForValue:confidence] ?: @"none";
+}
+
++ (RadarEnumMapping *)verificationStatusMapping {
+    static RadarEnumMapping *mapping;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        RadarEnumMappingEntry entries[] = {
+            {RadarAddressVerificationStatusVerified, @"verified"},
+            {RadarAddressVerificationStatusPartiallyVerified, @"partially verified"},
+            {RadarAddressVerificationStatusAmbiguous, @"ambiguous"},
+            {RadarAddressVerificationStatusUnverified, @"unverified"},
+        };
+        mapping = RadarEnumMappingMake(entries);
+    });
+    return mapping;
 }
 
 + (RadarAddressVerificationStatus)addressVerificationStatusForString:(NSString *)string {
-    if ([string isEqualToString:@"verified"]) {
-        return RadarAddressVerificationStatusVerified;
-    } else if ([string isEqualToString:@"partially verified"]) {
-        return RadarAddressVerificationStatusPartiallyVerified;
-    } else if ([string isEqualToString:@"ambiguous"]) {
-        return RadarAddressVerificationStatusAmbiguous;
-    } else if ([string isEqualToString:@"unverified"]) {
-        return RadarAddressVerificationStatusUnverified;
-    } else {
-        return RadarAddressVerificationStatusNone;
-    }
+    return [[RadarAddress verificationStatusMapping] valueForString:string defaultValue:RadarAddressVerificationStatusNone];
 }
 
 - (NSDictionary *)dictionaryValue {
@@ -0,0 +1,283 @@
+//
+//  RadarCompiledPolygon.swift
+//  RadarSDK
+//
+//  Copyright © 2026 Radar Labs, Inc. All rights reserved.
+//
+
+import CoreLocation
+import Foundation
+
+/// Polygon geofence geometry prepared for repeated containment queries.
+///
+/// Vertices are projected once onto a local equirectangular plane (meters) centered on the
+/// vertex centroid, using the WGS84 meters-per-degree series at the centroid latitude. The
+/// projection is affine in lat/lng, so ray-cast containment matches the lat/lng test, and
+/// edge distances become planar point-to-segment math with no per-edge allocation or trig.
+/// For geofence-sized polygons the planar distances stay within a fraction of a percent of
+/// the great-circle distances.
+struct RadarCompiledPolygon: Sendable, Equatable {
+    let originLatitude: Double
+    let originLongitude: Double
+    let metersPerDegreeLatitude: Double
+    let metersPerDegreeLongitude: Double
+
+    /// Projected vertex coordinates in meters east (`xs`) and north (`ys`) of the origin.
+    let xs: [Double]
+    let ys: [Double]
+
+    /// Bounding box of the projected vertices, in meters.
+    let minX: Double
+    let minY: Double
+    let maxX: Double
+    let maxY: Double
+
+    var vertexCount: Int { xs.count }
+
+    init?(coordinates: [RadarCoordinateSwift]) {
+        guard coordinates.count >= 3 else { return nil }
+
+        var latitudeSum = 0.0
+        var longitudeSum = 0.0
+        for coordinate in coordinates {
+            latitudeSum += coordinate.latitude
+            longitudeSum += coordinate.longitude
+        }
+        let originLatitude = latitudeSum / Double(coordinates.count)
+        let originLongitude = longitudeSum / Double(coordinates.count)
+        let (metersPerDegreeLatitude, metersPerDegreeLongitude) = Self.metersPerDegree(atLatitude: originLatitude)
+
+        var xs = [Double]()
+        var ys = [Double]()
+        xs.reserveCapacity(coordinates.count)
+        ys.reserveCapacity(coordinates.count)
+        var minX = Double.greatestFiniteMagnitude
+        var minY = Double.greatestFiniteMagnitude
+        var maxX = -Double.greatestFiniteMagnitude
+        var maxY = -Double.greatestFiniteMagnitude
+        for coordinate in coordinates {
+            let x = (coordinate.longitude - originLongitude) * metersPerDegreeLongitude
+            let y = (coordinate.latitude - originLatitude) * metersPerDegreeLatitude
+            xs.append(x)
+            ys.append(y)
+            minX = min(minX, x)
+            minY = min(minY, y)
+            maxX = max(maxX, x)
+            maxY = max(maxY, y)
+        }
+
+        self.originLatitude = originLatitude
+        self.originLongitude = originLongitude
+        self.metersPerDegreeLatitude = metersPerDegreeLatitude
+        self.metersPerDegreeLongitude = metersPerDegreeLongitude
+        self.xs = xs
+        self.ys = ys
+        self.minX = minX
+        self.minY = minY
+        self.maxX = maxX
+        self.maxY = maxY
+    }
+
+    // MARK: - Queries
+
+    func project(_ coordinate: CLLocationCoordinate2D) -> (x: Double, y: Double) {
+        ((coordinate.longitude - originLongitude) * metersPerDegreeLongitude, (coordinate.latitude - originLatitude) * metersPerDegreeLatitude)
+    }
+
+    /// Whether a projected point is within `margin` meters of the polygon's bounding box.
+    func boundingBoxContains(x: Double, y: Double, margin: Double = 0) -> Bool {
+        x >= minX - margin && x <= maxX + margin && y >= minY - margin && y <= maxY + margin
+    }
+
+    func contains(_ coordinate: CLLocationCoordinate2D) -> Bool {
+        let (x, y) = project(coordinate)
+        return contains(x: x, y: y)
+    }
+
+    /// Even-odd ray cast against the projected vertices.
+    func contains(x: Double, y: Double) -> Bool {
+        guard boundingBoxContains(x: x, y: y) else { return false }
+        return vertexCount >= Self.vectorThreshold ? containsVectorized(x: x, y: y) : containsScalar(x: x, y: y)
+    }
+
+    func containsScalar(x: Double, y: Double) -> Bool {
+        xs.withUnsafeBufferPointer { xs in
+            ys.withUnsafeBufferPointer { ys in
+                var inside = false
+                var previous = xs.count - 1
+                for current in 0..<xs.count {
+                    let currentAbove = ys[current] > y
+                    let previousAbove = ys[previous] > y
+                    if currentAbove != previousAbove {
+                        let edgeX = xs[previous] + (y - ys[previous]) / (ys[current] - ys[previous]) * (xs[current] - xs[previous])
+                        if x < edgeX {
+                            inside = !inside
+                        }
+                    }
+                    previous = current
+                }
+                return inside
+            }
+        }
+    }
+
+    func distanceToEdge(from coordinate: CLLocationCoordinate2D) -> Double {
+        let (x, y) = project(coordinate)
+        return distanceToEdge(x: x, y: y)
+    }
+
+    /// Planar distance in meters from a projected point to the nearest polygon edge.
+    func distanceToEdge(x: Double, y: Double) -> Double {
+        vertexCount >= Self.vectorThreshold ? distanceToEdgeVectorized(x: x, y: y) : distanceToEdgeScalar(x: x, y: y)
+    }
+
+    func distanceToEdgeScalar(x: Double, y: Double) -> Double {
+        xs.withUnsafeBufferPointer { xs in
+            ys.withUnsafeBufferPointer { ys in
+                var minimumSquared = Double.greatestFiniteMagnitude
+                var previous = xs.count - 1
+                for current in 0..<xs.count {
+                    let squared = Self.squaredDistance(
+                        x: x, y: y,
+                        fromX: xs[previous], fromY: ys[previous],
+                        toX: xs[current], toY: ys[current]
+                    )
+                    minimumSquared = min(minimumSquared, squared)
+                    previous = current
+                }
+                return minimumSquared.squareRoot()
+            }
+        }
+    }
+
+    @inline(__always)
+    static func squaredDistance(x: Double, y: Double, fromX: Double, fromY: Double, toX: Double, toY: Double) -> Double {
+        let dx = toX - fromX
+        let dy = toY - fromY
+        let lengthSquared = dx * dx + dy * dy
+        var t = 0.0
+        if lengthSquared > 0 {
+            t = max(0, min(1, ((x - fromX) * dx + (y - fromY) * dy) / lengthSquared))
+        }
+        let px = fromX + t * dx - x
+        let py = fromY + t * dy - y
+        return px * px + py * py
+    }
+
+    // MARK: - Vectorized kernels
+
+    // Below this many vertices the scalar loops are as fast as the SIMD ones.
+    static let vectorThreshold = 16
+
+    // Edge i runs from vertex i - 1 to vertex i, with edge 0 closing the ring from the last
+    // vertex. Edge 0 is handled on its own so edges 1... can load their start and end
+    // vertices as two overlapping contiguous SIMD4 loads. Each lane does the same IEEE
+    // operations in the same order as the scalar loops, so results are bit-identical.
+
+    func containsVectorized(x: Double, y: Double) -> Bool {
+        xs.withUnsafeBufferPointer { xs in
+            ys.withUnsafeBufferPointer { ys in
+                let count = xs.count
+                var crossings = 0
+
+                if (ys[0] > y) != (ys[count - 1] > y) {
+                    let edgeX = xs[count - 1] + (y - ys[count - 1]) / (ys[0] - ys[count - 1]) * (xs[0] - xs[count - 1])
+                    if x < edgeX { crossings += 1 }
+                }
+
+                let px = SIMD4<Double>(repeating: x)
+                let py = SIMD4<Double>(repeating: y)
+                var laneCrossings = SIMD4<Int64>(repeating: 0)
+                var current = 1
+                while current + 4 <= count {
+                    let x1 = Self.load(xs, current)
+                    let y1 = Self.load(ys, current)
+                    let x0 = Self.load(xs, current - 1)
+                    let y0 = Self.load(ys, current - 1)
+
+                    let crosses = (y1 .> py) .^ (y0 .> py)
+                    // non-crossing lanes may divide by zero; they are masked out below
+                    let edgeX = x0 + (py - y0) / (y1 - y0) * (x1 - x0)
+                    let hits = crosses .& (px .< edgeX)
+                    laneCrossings &+= SIMD4<Int64>(repeating: 0).replacing(with: 1, where: hits)
+                    current += 4
+                }
+                crossings += Int(laneCrossings.wrappedSum())
+
+                while current < count {
+                    if (ys[current] > y) != (ys[current - 1] > y) {
+                        let edgeX = xs[current - 1] + (y - ys[current - 1]) / (ys[current] - ys[current - 1]) * (xs[current] - xs[current - 1])
+                        if x < edgeX { crossings += 1 }
+                    }
+                    current += 1
+                }
+
+                return crossings % 2 == 1
+            }
+        }
+    }
+
+    func distanceToEdgeVectorized(x: Double, y: Double) -> Double {
+        xs.withUnsafeBufferPointer { xs in
+            ys.withUnsafeBufferPointer { ys in
+                let count = xs.count
+                var minimumSquared = Self.squaredDistance(
+                    x: x, y: y,
+                    fromX: xs[count - 1], fromY: ys[count - 1],
+                    toX: xs[0], toY: ys[0]
+                )
+
+                let px = SIMD4<Double>(repeating: x)
+                let py = SIMD4<Double>(repeating: y)
+                let zero = SIMD4<Double>(repeating: 0)
+                let one = SIMD4<Double>(repeating: 1)
+                var laneMinimum = SIMD4<Double>(repeating: .greatestFiniteMagnitude)
+                var current = 1
+                while current + 4 <= count {
+                    let x0 = Self.load(xs, current - 1)
+                    let y0 = Self.load(ys, current - 1)
+                    let dx = Self.load(xs, current) - x0
+                    let dy = Self.load(ys, current) - y0
+
+                    let lengthSquared = dx * dx + dy * dy
+                    let degenerate = lengthSquared .<= zero
+                    let projection = ((px - x0) * dx + (py - y0) * dy) / lengthSquared
+                    let t = pointwiseMax(zero, pointwiseMin(one, projection)).replacing(with: 0, where: degenerate)
+
+                    let ex = x0 + t * dx - px
+                    let ey = y0 + t * dy - py
+                    laneMinimum = pointwiseMin(laneMinimum, ex * ex + ey * ey)
+                    current += 4
+                }
+                minimumSquared = min(minimumSquared, laneMinimum.min())
+
+                while current < count {
+                    let squared = Self.squaredDistance(
+                        x: x, y: y,
+                        fromX: xs[current - 1], fromY: ys[current - 1],
+                        toX: xs[current], toY: ys[current]
+                    )
+                    minimumSquared = min(minimumSquared, squared)
+                    current += 1
+                }
+
+                return minimumSquared.squareRoot()
+            }
+        }
+    }
+
+    @inline(__always)
+    private static func load(_ buffer: UnsafeBufferPointer<Double>, _ offset: Int) -> SIMD4<Double> {
+        SIMD4(buffer[offset], buffer[offset + 1], buffer[offset + 2], buffer[offset + 3])
+    }
+
+    // MARK: - Projection
+
+    /// WGS84 meters per degree of latitude and longitude at `latitude`.
+    static func metersPerDegree(atLatitude latitude: Double) -> (latitude: Double, longitude: Double) {
+        let phi = latitude * .pi / 180.0
+        let metersPerDegreeLatitude = 111_132.92 - 559.82 * cos(2 * phi) + 1.175 * cos(4 * phi) - 0.0023 * cos(6 * phi)
+        let metersPerDegreeLongitude = 111_412.84 * cos(phi) - 93.5 * cos(3 * phi) + 0.118 * cos(5 * phi)
+        return (metersPerDegreeLatitude, metersPerDegreeLongitude)
+    }
+}
@@ -13,6 +13,8 @@
 
 NS_ASSUME_NONNULL_BEGIN
 
+@class RadarTrackResponse;
+
 @interface RadarDelegateHolder : NSObject<RadarDelegate, RadarVerifiedDelegate>
 
 @property (nullable, weak, nonatomic) id<RadarDelegate> delegate;
@@ -20,6 +22,8 @@ NS_ASSUME_NONNULL_BEGIN
 
 + (instancetype)sharedInstance;
 - (void)didFailWithStatus:(RadarStatus)status;
+// like didUpdateLocation:user:, but builds the user only when the delegate receives it
+- (void)didUpdateLocation:(CLLocation *)location response:(RadarTrackResponse *)response;
 
 @end
 
@@ -7,6 +7,7 @@
 
 #import "RadarDelegateHolder.h"
 #import "RadarLogger.h"
+#import "RadarTrackResponse.h"
 #import "RadarUtils.h"
 #if __has_include(<RadarSDK/RadarSDK-Swift.h>)
 #import <RadarSDK/RadarSDK-Swift.h>
@@ -58,6 +59,24 @@
                                                 user.location.coordinate.latitude, user.location.coordinate.longitude, user.location.horizontalAccuracy, user._id]];
 }
 
+- (void)didUpdateLocation:(CLLocation *)location response:(RadarTrackResponse *)response {
+    if (!location || !response.hasUser) {
+        return;
+    }
+
+    if (self.delegate && [self.delegate respondsToSelector:@selector(didUpdateLocation:user:)]) {
+        RadarUser *user = response.user;
+        if (user) {
+            [self.delegate didUpdateLocation:location user:user];
+        }
+    }
+
+    [[RadarLogger sharedInstance]
+        logWithLevel:RadarLogLevelInfo
+             message:[NSString stringWithFormat:@"📍 Radar location updated | coordinates = (%f, %f); accuracy = %f; link = https://radar.com/dashboard/users/%@",
+                                                location.coordinate.latitude, location.coordinate.longitude, location.horizontalAccuracy, response.userId]];
+}
+
 - (void)didUpdateClientLocation:(CLLocation *)location stopped:(BOOL)stopped source:(RadarLocationSource)source {
     if (!location) {
         return;
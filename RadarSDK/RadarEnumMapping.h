@@ -0,0 +1,38 @@
+//
+//  RadarEnumMapping.h
+//  RadarSDK
+//
+//  Copyright © 2026 Radar Labs, Inc. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+typedef struct {
+    NSInteger value;
+    __unsafe_unretained NSString *string;
+} RadarEnumMappingEntry;
+
+/**
+ Maps an enum to and from its API strings, both directions built from one table of entries so they can't drift apart.
+
+ Lookups are a dictionary hit instead of a chain of string comparisons. If a value is listed more than once, it is written as its first string, and every
+ listed string parses.
+ */
+@interface RadarEnumMapping : NSObject
+
+- (instancetype)initWithEntries:(const RadarEnumMappingEntry *)entries count:(NSUInteger)count NS_DESIGNATED_INITIALIZER;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+// defaultValue if string is nil, not a string, or not in the table
+- (NSInteger)valueForString:(id _Nullable)string defaultValue:(NSInteger)defaultValue NS_SWIFT_NAME(value(for:defaultValue:));
+
+- (NSString *_Nullable)stringForValue:(NSInteger)value NS_SWIFT_NAME(string(for:));
+
+@end
+
+#define RadarEnumMappingMake(entries) [[RadarEnumMapping alloc] initWithEntries:(entries) count:sizeof(entries) / sizeof((entries)[0])]
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,49 @@
+//
+//  RadarEnumMapping.m
+//  RadarSDK
+//
+//  Copyright © 2026 Radar Labs, Inc. All rights reserved.
+//
+
+#import "RadarEnumMapping.h"
+
+@implementation RadarEnumMapping {
+    NSDictionary<NSString *, NSNumber *> *_valuesByString;
+    NSDictionary<NSNumber *, NSString *> *_stringsByValue;
+}
+
+- (instancetype)initWithEntries:(const RadarEnumMappingEntry *)entries count:(NSUInteger)count {
+    self = [super init];
+    if (self) {
+        NSMutableDictionary<NSString *, NSNumber *> *valuesByString = [NSMutableDictionary dictionaryWithCapacity:count];
+        NSMutableDictionary<NSNumber *, NSString *> *stringsByValue = [NSMutableDictionary dictionaryWithCapacity:count];
+        for (NSUInteger i = 0; i < count; i++) {
+            NSNumber *value = @(entries[i].value);
+            NSString *string = entries[i].string;
+            if (!valuesByString[string]) {
+                valuesByString[string] = value;
+            }
+            if (!stringsByValue[value]) {
+                stringsByValue[value] = string;
+            }
+        }
+        _valuesByString = [valuesByString copy];
+        _stringsByValue = [stringsByValue copy];
+    }
+    return self;
+}
+
+- (NSInteger)valueForString:(id)string defaultValue:(NSInteger)defaultValue {
+    if (!string || ![string isKindOfClass:[NSString class]]) {
+        return defaultValue;
+    }
+
+    NSNumber *value = _valuesByString[(NSString *)string];
+    return value ? value.integerValue : defaultValue;
+}
+
+- (NSString *)stringForValue:(NSInteger)value {
+    return _stringsByValue[@(value)];
+}
+
+@end
@@ -14,9 +14,12 @@
 #import <CoreLocation/CoreLocation.h>
 #import <Foundation/Foundation.h>
 
+@class RadarEnumMapping;
+
 @interface RadarEvent ()
 
 + (NSArray<RadarEvent *> *_Nullable)eventsFromObject:(id _Nonnull)object;
++ (RadarEnumMapping *_Nonnull)typeMapping;
 - (instancetype _Nullable)initWithId:(NSString *_Nonnull)_id
                            createdAt:(NSDate *_Nonnull)createdAt
                      actualCreatedAt:(NSDate *_Nonnull)actualCreatedAt
@@ -7,6 +7,7 @@
 
 #import "RadarEvent.h"
 #import "RadarBeacon+Internal.h"
+#import "RadarEnumMapping.h"
 #import "RadarEvent+Internal.h"
 #import "RadarFraud+Internal.h"
 #import "RadarGeofence+Internal.h"
@@ -121,87 +122,21 @@
     id createdAtObj = dict[@"createdAt"];
     if (createdAtObj && [createdAtObj isKindOfClass:[NSString class]]) {
         NSString *createdAtStr = (NSString *)createdAtObj;
-        createdAt = [RadarUtils.isoDateFormatter dateFromString:createdAtStr];
+        createdAt = [RadarUtils dateFromISOString:createdAtStr];
     }
 
     id actualCreatedAtObj = dict[@"actualCreatedAt"];
     if ([actualCreatedAtObj isKindOfClass:[NSString class]]) {
         NSString *actualCreatedAtStr = (NSString *)actualCreatedAtObj;
-        actualCreatedAt = [RadarUtils.isoDateFormatter dateFromString:actualCreatedAtStr];
+        actualCreatedAt = [RadarUtils dateFromISOString:actualCreatedAtStr];
     }
 
     id typeObj = dict[@"type"];
     if (typeObj && [typeObj isKindOfClass:[NSString class]]) {
         NSString *typeStr = (NSString *)typeObj;
 
-        // These strings should match the values (and order) of the server's event
-        // constants.
-        if ([typeStr isEqualToString:@"user.entered_geofence"]) {
-            type = RadarEventTypeUserEnteredGeofence;
-        } else if ([typeStr isEqualToString:@"user.exited_geofence"]) {
-            type = RadarEventTypeUserExitedGeofence;
-        } else if ([typeStr isEqualToString:@"user.dwelled_in_geofence"]) {
-            type = RadarEventTypeUserDwelledInGeofence;
-        } else if ([typeStr isEqualToString:@"user.entered_place"]) {
-            type = RadarEventTypeUserEnteredPlace;
-        } else if ([typeStr isEqualToString:@"user.exited_place"]) {
-            type = RadarEventTypeUserExitedPlace;
-        } else if ([typeStr isEqualToString:@"user.entered_region_country"]) {
-            type = RadarEventTypeUserEnteredRegionCountry;
-        } else if ([typeStr isEqualToString:@"user.exited_region_country"]) {
-            type = RadarEventTypeUserExitedRegionCountry;
-        } else if ([typeStr isEqualToString:@"user.entered_region_dma"]) {
-            type = RadarEventTypeUserEnteredRegionDMA;
-        } else if ([typeStr isEqualToString:@"user.exited_region_dma"]) {
-            type = RadarEventTypeUserExitedRegionDMA;
-        } else if ([typeStr isEqualToString:@"user.entered_region_state"]) {
-            type = RadarEventTypeUserEnteredRegionState;
-        } else if ([typeStr isEqualToString:@"user.exited_region_state"]) {
-            type = RadarEventTypeUserExitedRegionState;
-        } else if ([typeStr isEqualToString:@"user.entered_region_postal_code"]) {
-            type = RadarEventTypeUserEnteredRegionPostalCode;
-        } else if ([typeStr isEqualToString:@"user.exited_region_postal_code"]) {
-            type = RadarEventTypeUserExitedRegionPostalCode;
-        } else if ([typeStr isEqualToString:@"user.nearby_place_chain"]) {
-            type = RadarEventTypeUserNearbyPlaceChain;
-        } else if ([typeStr isEqualToString:@"user.entered_beacon"]) {
-            type = RadarEventTypeUserEnteredBeacon;
-        } else if ([typeStr isEqualToString:@"user.exited_beacon"]) {
-            type = RadarEventTypeUserExitedBeacon;
-        } else if ([typeStr isEqualToString:@"user.started_trip"]) {
-            type = RadarEventTypeUserStartedTrip;
-        } else if ([typeStr isEqualToString:@"user.updated_trip"]) {
-            type = RadarEventTypeUserUpdatedTrip;
-        } else if ([typeStr isEqualToString:@"user.stopped_trip"]) {
-            type = RadarEventTypeUserStoppedTrip;
-        } else if ([typeStr isEqualToString:@"user.approaching_trip_destination"]) {
-            type = RadarEventTypeUserApproachingTripDestination;
-        } else if ([typeStr isEqualToString:@"user.arrived_at_trip_destination"]) {
-            type = RadarEventTypeUserArrivedAtTripDestination;
-        } else if ([typeStr isEqualToString:@"user.arrived_at_wrong_trip_destination"]){
-            type = RadarEventTypeUserArrivedAtWrongTripDestination;
-        } else if ([typeStr isEqualToString:@"user.failed_fraud"]) {
-            type = RadarEventTypeUserFailedFraud;
-        } else if ([typeStr isEqualToString:@"user.fired_trip_orders"]) {
-            type = RadarEventTypeUserFiredTripOrders;
-        } else if ([typeStr isEqualToString:@"user.entered_home"]) {
-            type = RadarEventTypeUserEnteredHome;
-        } else if ([typeStr isEqualToString:@"user.exited_home"]) {
-            type = RadarEventTypeUserExitedHome;
-        } else if ([typeStr isEqualToString:@"user.entered_work"]) {
-            type = RadarEventTypeUserEnteredWork;
-        } else if ([typeStr isEqualToString:@"user.exited_work"]) {
-            type = RadarEventTypeUserExitedWork;
-        } else if ([typeStr isEqualToString:@"user.started_traveling"]) {
-            type = RadarEventTypeUserStartedTraveling;
-        } else if ([typeStr isEqualToString:@"user.stopped_traveling"]) {
-            type = RadarEventTypeUserStoppedTraveling;
-        } else if ([typeStr isEqualToString:@"user.started_commuting"]) {
-            type = RadarEventTypeUserStartedCommuting;
-        } else if ([typeStr isEqualToString:@"user.stopped_commuting"]) {
-            type = RadarEventTypeUserStoppedCommuting;
-        } else {
-            type = RadarEventTypeConversion;
+        type = [[RadarEvent typeMapping] valueForString:typeStr defaultValue:RadarEventTypeConversion];
+        if (type == RadarEventTypeConversion) {
             conversionName = typeStr;
         }
     }
@@ -381,77 +316,57 @@
     return nil;
 }
 
++ (RadarEnumMapping *)typeMapping {
+    static RadarEnumMapping *mapping;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        // These strings should match the values (and order) of the server's event
+        // constants.
+        RadarEnumMappingEntry entries[] = {
+            {RadarEventTypeUserEnteredGeofence, @"user.entered_geofence"},
+            {RadarEventTypeUserExitedGeofence, @"user.exited_geofence"},
+            {RadarEventTypeUserDwelledInGeofence, @"user.dwelled_in_geofence"},
+            {RadarEventTypeUserEnteredPlace, @"user.entered_place"},
+            {RadarEventTypeUserExitedPlace, @"user.exited_place"},
+            {RadarEventTypeUserEnteredRegionCountry, @"user.entered_region_country"},
+            {RadarEventTypeUserExitedRegionCountry, @"user.exited_region_country"},
+            {RadarEventTypeUserEnteredRegionDMA, @"user.entered_region_dma"},
+            {RadarEventTypeUserExitedRegionDMA, @"user.exited_region_dma"},
+            {RadarEventTypeUserEnteredRegionState, @"user.entered_region_state"},
+            {RadarEventTypeUserExitedRegionState, @"user.exited_region_state"},
+            {RadarEventTypeUserEnteredRegionPostalCode, @"user.entered_region_postal_code"},
+            {RadarEventTypeUserExitedRegionPostalCode, @"user.exited_region_postal_code"},
+            {RadarEventTypeUserNearbyPlaceChain, @"user.nearby_place_chain"},
+            {RadarEventTypeUserEnteredBeacon, @"user.entered_beacon"},
+            {RadarEventTypeUserExitedBeacon, @"user.exited_beacon"},
+            {RadarEventTypeUserStartedTrip, @"user.started_trip"},
+            {RadarEventTypeUserUpdatedTrip, @"user.updated_trip"},
+            {RadarEventTypeUserStoppedTrip, @"user.stopped_trip"},
+            {RadarEventTypeUserApproachingTripDestination, @"user.approaching_trip_destination"},
+            {RadarEventTypeUserArrivedAtTripDestination, @"user.arrived_at_trip_destination"},
+            {RadarEventTypeUserArrivedAtWrongTripDestination, @"user.arrived_at_wrong_trip_destination"},
+            {RadarEventTypeUserFailedFraud, @"user.failed_fraud"},
+            {RadarEventTypeUserFiredTripOrders, @"user.fired_trip_orders"},
+            {RadarEventTypeUserEnteredHome, @"user.entered_home"},
+            {RadarEventTypeUserExitedHome, @"user.exited_home"},
+            {RadarEventTypeUserEnteredWork, @"user.entered_work"},
+            {RadarEventTypeUserExitedWork, @"user.exited_work"},
+            {RadarEventTypeUserStartedTraveling, @"user.started_traveling"},
+            {RadarEventTypeUserStoppedTraveling, @"user.stopped_traveling"},
+            {RadarEventTypeUserStartedCommuting, @"user.started_commuting"},
+            {RadarEventTypeUserStoppedCommuting, @"user.stopped_commuting"},
+        };
+        mapping = RadarEnumMappingMake(entries);
+    });
+    return mapping;
+}
+
 + (NSString *)stringForType:(RadarEventType)type {
-    switch (type) {
-    case RadarEventTypeUserEnteredGeofence:
-        return @"user.entered_geofence";
-    case RadarEventTypeUserExitedGeofence:
-        return @"user.exited_geofence";
-    case RadarEventTypeUserDwelledInGeofence:
-        return @"user.dwelled_in_geofence";
-    case RadarEventTypeUserEnteredPlace:
-        return @"user.entered_place";
-    case RadarEventTypeUserExitedPlace:
-        return @"user.exited_place";
-    case RadarEventTypeUserEnteredRegionCountry:
-        return @"user.entered_region_country";
-    case RadarEventTypeUserExitedRegionCountry:
-        return @"user.exited_region_country";
-    case RadarEventTypeUserEnteredRegionDMA:
-        return @"user.entered_region_dma";
-    case RadarEventTypeUserExitedRegionDMA:
-        return @"user.exited_region_dma";
-    case RadarEventTypeUserEnteredRegionState:
-        return @"user.entered_region_state";
-    case RadarEventTypeUserExitedRegionState:
-        return @"user.exited_region_state";
-    case RadarEventTypeUserEnteredRegionPostalCode:
-        return @"user.entered_region_postal_code";
-    case RadarEventTypeUserExitedRegionPostalCode:
-        return @"user.exited_region_postal_code";
-    case RadarEventTypeUserNearbyPlaceChain:
-        return @"user.nearby_place_chain";
-    case RadarEventTypeUserEnteredBeacon:
-        return @"user.entered_beacon";
-    case RadarEventTypeUserExitedBeacon:
-        return @"user.exited_beacon";
-    case RadarEventTypeUserStartedTrip:
-        return @"user.started_trip";
-    case RadarEventTypeUserUpdatedTrip:
-        return @"user.updated_trip";
-    case RadarEventTypeUserStoppedTrip:
-        return @"user.stopped_trip";
-    case RadarEventTypeUserApproachingTripDestination:
-        return @"user.approaching_trip_destination";
-    case RadarEventTypeUserArrivedAtTripDestination:
-        return @"user.arrived_at_trip_destination";
-    case RadarEventTypeUserArrivedAtWrongTripDestination:
-        return @"user.arrived_at_wrong_trip_destination";
-    case RadarEventTypeUserFailedFraud:
-        return @"user.failed_fraud";
-    case RadarEventTypeUserFiredTripOrders:
-        return @"user.fired_trip_orders";
-    case RadarEventTypeUserEnteredHome:
-        return @"user.entered_home";
-    case RadarEventTypeUserExitedHome:
-        return @"user.exited_home";
-    case RadarEventTypeUserEnteredWork:
-        return @"user.entered_work";
-    case RadarEventTypeUserExitedWork:
-        return @"user.exited_work";
-    case RadarEventTypeUserStartedTraveling:
-        return @"user.started_traveling";
-    case RadarEventTypeUserStoppedTraveling:
-        return @"user.stopped_traveling";
-    case RadarEventTypeUserStartedCommuting:
-        return @"user.started_commuting";
-    case RadarEventTypeUserStoppedCommuting:
-        return @"user.stopped_commuting";
-    case RadarEventTypeConversion:
-        return @"custom";
-    default:
-        return @"unknown";
+    NSString *str = [[RadarEvent typeMapping] stringForValue:type];
+    if (str) {
+        return str;
     }
+    return type == RadarEventTypeConversion ? @"custom" : @"unknown";
 }
 
 + (NSArray<NSDictionary *> *)arrayForEvents:(NSArray<RadarEvent *> *)events {
@@ -519,9 +434,9 @@
     [dict setValue:locationDict forKey:@"location"];
     [dict setValue:@(self.replayed) forKey:@"replayed"];
     [dict setValue:self.metadata forKey:@"metadata"];
-    NSString *createdAtString = [RadarUtils.isoDateFormatter stringFromDate:self.createdAt];
+    NSString *createdAtString = [RadarUtils isoStringFromDate:self.createdAt];
     [dict setValue:createdAtString forKey:@"createdAt"];
-    NSString *actualCreatedAtString = [RadarUtils.isoDateFormatter stringFromDate:self.actualCreatedAt];
+    NSString *actualCreatedAtString = [RadarUtils isoStringFromDate:self.actualCreatedAt];
     [dict setValue:actualCreatedAtString forKey:@"actualCreatedAt"];
     return dict;
 }
@@ -7,6 +7,7 @@
 //
 
 import Foundation
+import UIKit
 
 class RadarFileStorage {
     let file: URL
@@ -71,14 +72,41 @@ class RadarFileStorage {
     }
 }
 
+/// Codable value persisted as a JSON file, with an in-memory cache that is authoritative
+/// for reads.
+///
+/// By default every mutation re-encodes the value and atomically rewrites the file on the
+/// caller's thread. With `journaling` enabled, mutations only update the cache; the change is
+/// appended in the background to a `<fileName>.journal` log as one JSON record per line, and
+/// the log is folded back into the snapshot once it grows past `journalCompactionBytes`.
+/// Records for top-level JSON objects hold only the changed keys. On load the snapshot is
+/// replayed with the journal, and a torn record from an interrupted append ends the replay.
+///
+/// With a `coalescingInterval`, the first mutation schedules a write that many seconds later
+/// and any further mutations before it fire are folded into that one write of the latest
+/// value. Pending writes are flushed when the app enters the background or terminates, or
+/// on `flush()`.
 final class RadarFileStorageObject<T: Codable & Sendable>: @unchecked Sendable {
 
+    static var journalCompactionBytes: Int { 64 * 1024 }
+
     private let fileURL: URL
     private let queue: DispatchQueue
     private var cache: T?
     private var cacheLoaded = false
+    // bumped on every mutation so callers can cache values derived from the stored object
+    private var generation: UInt64 = 0
+
+    private let journal: Journal?
+
+    private let coalescingInterval: TimeInterval
+    private var hasPendingWrite = false
+    private var pendingValue: T?
+    private var writesRequested = 0
+    private var writesPerformed = 0
+    private var lifecycleObservers = [NSObjectProtocol]()
 
-    init(fileName: String) {
+    init(fileName: String, journaling: Bool = false, coalescingInterval: TimeInterval = 0) {
         self.queue = DispatchQueue(label: "io.radar.filestorage.\(fileName)", qos: .utility)
 
         let appSupport = FileManager.default.urls(
@@ -96,24 +124,58 @@ final class RadarFileStorageObject<T: Codable & Sendable>: @unchecked Sendable {
         try? dirURL.setResourceValues(values)
 
         self.fileURL = dir.appendingPathComponent(fileName)
+        self.journal = journaling ? Journal(snapshotURL: fileURL, journalURL: dir.appendingPathComponent("\(fileName).journal"), label: fileName) : nil
+        self.coalescingInterval = coalescingInterval
+
+        if coalescingInterval > 0 {
+            lifecycleObservers = [UIApplication.didEnterBackgroundNotification, UIApplication.willTerminateNotification].map { name in
+                NotificationCenter.default.addObserver(forName: name, object: nil, queue: nil) { [weak self] _ in
+                    self?.flush()
+                }
+            }
+        }
+    }
+
+    deinit {
+        for observer in lifecycleObservers {
+            NotificationCenter.default.removeObserver(observer)
+        }
+    }
+
+    /// Mutations persisted so far, and the writes actually issued for them.
+    var writeStats: (requested: Int, performed: Int) {
+        queue.sync { (writesRequested, writesPerformed) }
     }
 
     func read() -> T? {
-        queue.sync {
-            if cacheLoaded { return cache }
-            cacheLoaded = true
-            guard let data = try? Data(contentsOf: fileURL) else { return nil }
+        queue.sync { loadCache() }
+    }
+
+    /// Reads the value together with the generation it was read at; the generation changes
+    /// whenever the stored value is written, modified or cleared.
+    func readVersioned() -> (value: T?, generation: UInt64) {
+        queue.sync { (loadCache(), generation) }
+    }
+
+    private func loadCache() -> T? {
+        if cacheLoaded { return cache }
+        cacheLoaded = true
+        if let journal {
+            guard let data = journal.load() else { return nil }
             cache = try? JSONDecoder().decode(T.self, from: data)
             return cache
         }
+        guard let data = try? Data(contentsOf: fileURL) else { return nil }
+        cache = try? JSONDecoder().decode(T.self, from: data)
+        return cache
     }
 
     func write(_ value: T) {
         queue.sync {
             cache = value
             cacheLoaded = true
-            guard let data = try? JSONEncoder().encode(value) else { return }
-            try? data.write(to: fileURL, options: .atomic)
+            generation &+= 1
+            persist(value)
         }
     }
 
@@ -121,25 +183,17 @@ final class RadarFileStorageObject<T: Codable & Sendable>: @unchecked Sendable {
         queue.async { [self] in
             cache = value
             cacheLoaded = true
-            guard let data = try? JSONEncoder().encode(value) else { return }
-            try? data.write(to: fileURL, options: .atomic)
+            generation &+= 1
+            persist(value)
         }
     }
 
     func modify(_ transform: (inout T?) -> Void) {
         queue.sync {
-            if !cacheLoaded {
-                cacheLoaded = true
-                if let data = try? Data(contentsOf: fileURL) {
-                    cache = try? JSONDecoder().decode(T.self, from: data)
-                }
-            }
+            _ = loadCache()
             transform(&cache)
-            if let cache = cache, let data = try? JSONEncoder().encode(cache) {
-                try? data.write(to: fileURL, options: .atomic)
-            } else if cache == nil {
-                try? FileManager.default.removeItem(at: fileURL)
-            }
+            generation &+= 1
+            persist(cache)
         }
     }
 
@@ -147,7 +201,195 @@ final class RadarFileStorageObject<T: Codable & Sendable>: @unchecked Sendable {
         queue.sync {
             cache = nil
             cacheLoaded = true
+            generation &+= 1
+            persist(nil)
+        }
+    }
+
+    /// Blocks until every mutation made so far is on disk, writing any coalesced value now.
+    func flush() {
+        queue.sync { writePending() }
+        journal?.flush()
+    }
+
+    private func persist(_ value: T?) {
+        writesRequested += 1
+        guard coalescingInterval > 0 else {
+            performWrite(value)
+            return
+        }
+        pendingValue = value
+        guard !hasPendingWrite else { return }
+        hasPendingWrite = true
+        queue.asyncAfter(deadline: .now() + coalescingInterval) { [weak self] in
+            self?.writePending()
+        }
+    }
+
+    private func writePending() {
+        guard hasPendingWrite else { return }
+        hasPendingWrite = false
+        let value = pendingValue
+        pendingValue = nil
+        performWrite(value)
+    }
+
+    private func performWrite(_ value: T?) {
+        writesPerformed += 1
+        if let journal {
+            journal.record(value)
+            return
+        }
+        if let value {
+            guard let data = try? JSONEncoder().encode(value) else { return }
+            try? data.write(to: fileURL, options: .atomic)
+        } else {
             try? FileManager.default.removeItem(at: fileURL)
         }
     }
+
+    // MARK: - Journal
+
+    private final class Journal: @unchecked Sendable {
+        let snapshotURL: URL
+        let journalURL: URL
+        // all file access and the state below are confined to this queue
+        private let queue: DispatchQueue
+        // JSON object as of the last record, what a replay of the files produces
+        private var persisted: Any?
+        private var journalBytes = 0
+        // whether journalBytes reflects the journal on disk and its tail is a complete line
+        private var scanned = false
+
+        init(snapshotURL: URL, journalURL: URL, label: String) {
+            self.snapshotURL = snapshotURL
+            self.journalURL = journalURL
+            self.queue = DispatchQueue(label: "io.radar.filestorage.journal.\(label)", qos: .utility)
+        }
+
+        /// Snapshot with the journal replayed on top, as JSON data.
+        func load() -> Data? {
+            queue.sync {
+                var object = (try? Data(contentsOf: snapshotURL)).flatMap { try? JSONSerialization.jsonObject(with: $0, options: .fragmentsAllowed) }
+                let journal = (try? Data(contentsOf: journalURL)) ?? Data()
+                journalBytes = journal.count
+                scanned = true
+                for line in journal.split(separator: UInt8(ascii: "\n")) {
+                    guard let record = try? JSONSerialization.jsonObject(with: Data(line)) as? [String: Any] else {
+                        // torn append from an interrupted write, everything after it is lost too
+                        break
+                    }
+                    object = Self.apply(record, to: object)
+                }
+                persisted = object
+                if journalBytes > 0 {
+                    queue.async { self.compact() }
+                }
+                return object.flatMap { try? JSONSerialization.data(withJSONObject: $0, options: .fragmentsAllowed) }
+            }
+        }
+
+        func record(_ value: T?) {
+            queue.async { [self] in
+                guard let value else {
+                    persisted = nil
+                    journalBytes = 0
+                    scanned = true
+                    try? FileManager.default.removeItem(at: snapshotURL)
+                    try? FileManager.default.removeItem(at: journalURL)
+                    return
+                }
+                guard let data = try? JSONEncoder().encode(value),
+                    let object = try? JSONSerialization.jsonObject(with: data, options: .fragmentsAllowed)
+                else {
+                    return
+                }
+                guard let record = Self.record(from: persisted, to: object) else { return }
+                persisted = object
+                append(record)
+            }
+        }
+
+        func flush() {
+            queue.sync {}
+        }
+
+        private func append(_ record: [String: Any]) {
+            guard var line = try? JSONSerialization.data(withJSONObject: record, options: .fragmentsAllowed) else { return }
+            line.append(UInt8(ascii: "\n"))
+
+            if !scanned {
+                scan()
+            }
+            if !FileManager.default.fileExists(atPath: journalURL.path) {
+                FileManager.default.createFile(atPath: journalURL.path, contents: nil)
+            }
+            guard let handle = try? FileHandle(forWritingTo: journalURL) else { return }
+            handle.seekToEndOfFile()
+            handle.write(line)
+            handle.closeFile()
+
+            journalBytes += line.count
+            if journalBytes > RadarFileStorageObject.journalCompactionBytes {
+                compact()
+            }
+        }
+
+        /// Drops a torn tail left by an interrupted append when the first record is written
+        /// before the journal was loaded, so replay doesn't stop short of the new records.
+        private func scan() {
+            scanned = true
+            guard let journal = try? Data(contentsOf: journalURL) else { return }
+            let complete = journal.lastIndex(of: UInt8(ascii: "\n")).map { $0 + 1 } ?? 0
+            if complete < journal.count, let handle = try? FileHandle(forWritingTo: journalURL) {
+                handle.truncateFile(atOffset: UInt64(complete))
+                handle.closeFile()
+            }
+            journalBytes = complete
+        }
+
+        /// Folds the journal into the snapshot. The snapshot is replaced atomically before the
+        /// journal is removed, and replaying records already in the snapshot is a no-op, so a
+        /// crash at any point leaves a consistent pair of files.
+        private func compact() {
+            if let persisted {
+                guard let data = try? JSONSerialization.data(withJSONObject: persisted, options: .fragmentsAllowed) else { return }
+                try? data.write(to: snapshotURL, options: .atomic)
+            } else {
+                try? FileManager.default.removeItem(at: snapshotURL)
+            }
+            try? FileManager.default.removeItem(at: journalURL)
+            journalBytes = 0
+        }
+
+        /// Smallest record taking `old` to `new`, or nil when nothing changed. Top-level
+        /// objects get a key-level patch; anything else is replaced whole.
+        static func record(from old: Any?, to new: Any) -> [String: Any]? {
+            guard let old = old as? [String: Any], let new = new as? [String: Any] else {
+                if let old, (old as AnyObject).isEqual(new) { return nil }
+                return ["value": new]
+            }
+            var set = [String: Any]()
+            for (key, value) in new where !(old[key].map { ($0 as AnyObject).isEqual(value) } ?? false) {
+                set[key] = value
+            }
+            let unset = old.keys.filter { new[$0] == nil }
+            if set.isEmpty && unset.isEmpty { return nil }
+            return ["set": set, "unset": unset]
+        }
+
+        static func apply(_ record: [String: Any], to object: Any?) -> Any? {
+            if let value = record["value"] {
+                return value
+            }
+            var patched = object as? [String: Any] ?? [:]
+            for (key, value) in record["set"] as? [String: Any] ?? [:] {
+                patched[key] = value
+            }
+            for key in record["unset"] as? [String] ?? [] {
+                patched.removeValue(forKey: key)
+            }
+            return patched
+        }
+    }
 }
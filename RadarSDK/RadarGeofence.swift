@@ -57,6 +57,8 @@ struct RadarGeofenceSwift: Codable, Sendable, Equatable {
     let geofenceStopDetection: Bool?
     let metadata: [String: RadarMetadataValue]?
     let operatingHours: [String: [[String]]]?
+    /// Projected form of a polygon geometry, built once at decode for containment queries.
+    let compiledPolygon: RadarCompiledPolygon?
 
     enum CodingKeys: String, CodingKey {
         case id = "_id"
@@ -100,6 +102,7 @@ struct RadarGeofenceSwift: Codable, Sendable, Equatable {
         default:
             geometry = .circle(center: center, radius: radius)
         }
+        compiledPolygon = Self.compile(geometry)
 
         metadata = try container.decodeIfPresent([String: RadarMetadataValue].self, forKey: .metadata)
         operatingHours = try container.decodeIfPresent([String: [[String]]].self, forKey: .operatingHours)
@@ -120,6 +123,12 @@ struct RadarGeofenceSwift: Codable, Sendable, Equatable {
         self.geofenceStopDetection = geofenceStopDetection
         self.metadata = metadata
         self.operatingHours = operatingHours
+        self.compiledPolygon = Self.compile(geometry)
+    }
+
+    private static func compile(_ geometry: RadarGeofenceGeometrySwift) -> RadarCompiledPolygon? {
+        guard case .polygon(let coordinates, _, _) = geometry else { return nil }
+        return RadarCompiledPolygon(coordinates: coordinates)
     }
 
     func encode(to encoder: Encoder) throws {
@@ -0,0 +1,51 @@
+//
+//  RadarGeofenceEvaluation.swift
+//  RadarSDK
+//
+//  Copyright © 2026 Radar Labs, Inc. All rights reserved.
+//
+
+import CoreLocation
+import Foundation
+
+/// Which synced geofences contain a location fix, with entry and exit buffering applied.
+///
+/// This is the only part of geofence evaluation that does geometry math, so
+/// `RadarSyncManager` memoizes it per fix and derives entries, exits and dwells from it.
+struct RadarGeofenceContainment: Sendable {
+    /// Geofences containing the fix using entry buffering (`bufferGeofenceEntries`).
+    let insideEntry: [RadarGeofenceSwift]
+    /// Geofences containing the fix using exit buffering (`bufferGeofenceExits`).
+    let insideExit: [RadarGeofenceSwift]
+    /// Every synced geofence, used to resolve exited ids.
+    let allGeofences: [RadarGeofenceSwift]
+
+    static let empty = RadarGeofenceContainment(insideEntry: [], insideExit: [], allGeofences: [])
+
+    /// Identifies a fix and the inputs containment depends on; two equal keys always
+    /// produce the same containment.
+    struct Key: Equatable {
+        let latitude: Double
+        let longitude: Double
+        let horizontalAccuracy: Double
+        let timestamp: Date
+        let indexVersion: UInt64
+        let bufferEntries: Bool
+        let bufferExits: Bool
+    }
+}
+
+/// Result of evaluating one location fix against the synced geofences and a set of
+/// last known geofence ids.
+struct RadarGeofenceEvaluation: Sendable {
+    let containment: RadarGeofenceContainment
+    /// Geofences entered since `lastKnownIds`, after stop detection.
+    let entered: [RadarGeofenceSwift]
+    /// Last known geofences that no longer contain the fix with exit buffering.
+    let exited: [RadarGeofenceSwift]
+    /// Last known geofences still containing the fix whose dwell threshold has elapsed.
+    let dwells: [RadarGeofenceSwift]
+
+    var insideEntry: [RadarGeofenceSwift] { containment.insideEntry }
+    var insideExit: [RadarGeofenceSwift] { containment.insideExit }
+}
@@ -0,0 +1,161 @@
+//
+//  RadarGeofenceIndex.swift
+//  RadarSDK
+//
+//  Copyright © 2026 Radar Labs, Inc. All rights reserved.
+//
+
+import CoreLocation
+import Foundation
+
+/// Uniform lat/lng grid over the bounding boxes of the synced geofences.
+///
+/// Containment queries only need to run the full geometry check against geofences whose
+/// bounding box overlaps the query, so the grid hands back that candidate set instead of
+/// every synced geofence. Candidates are returned in their original sync order.
+struct RadarGeofenceIndex: Sendable {
+
+    struct BoundingBox: Sendable, Equatable {
+        let minLatitude: Double
+        let minLongitude: Double
+        let maxLatitude: Double
+        let maxLongitude: Double
+
+        func intersects(_ other: BoundingBox) -> Bool {
+            minLatitude <= other.maxLatitude && maxLatitude >= other.minLatitude
+                && minLongitude <= other.maxLongitude && maxLongitude >= other.minLongitude
+        }
+    }
+
+    private struct Cell: Hashable, Sendable {
+        let x: Int
+        let y: Int
+    }
+
+    static let defaultCellSize: Double = 0.01  // ~1.1 km of latitude
+
+    // Geofences spanning more cells than this on either axis skip the grid and are always
+    // returned as candidates; keeps the index small for very large circles.
+    private static let maxCellsPerAxis = 64
+    private static let metersPerDegreeLatitude = 111_320.0
+    // CLLocation distances use an ellipsoid, so pad the spherical conversion slightly.
+    private static let paddingFactor = 1.01
+    private static let paddingMeters = 1.0
+
+    let geofences: [RadarGeofenceSwift]
+    let boundingBoxes: [BoundingBox]
+    private let cellSize: Double
+    private let cells: [Cell: [Int]]
+    private let oversized: [Int]
+
+    var isEmpty: Bool { geofences.isEmpty }
+
+    /// Whether `geofences` is the array this index was built from. Arrays are copy-on-write,
+    /// so sharing storage means the contents cannot have changed.
+    func isBuilt(from geofences: [RadarGeofenceSwift]) -> Bool {
+        geofences.sharesStorage(with: self.geofences)
+    }
+
+    init(geofences: [RadarGeofenceSwift], cellSize: Double = RadarGeofenceIndex.defaultCellSize) {
+        self.geofences = geofences
+        self.cellSize = cellSize
+
+        var boundingBoxes = [BoundingBox]()
+        boundingBoxes.reserveCapacity(geofences.count)
+        var cells = [Cell: [Int]]()
+        var oversized = [Int]()
+
+        for (i, geofence) in geofences.enumerated() {
+            let box = Self.boundingBox(for: geofence.geometry)
+            boundingBoxes.append(box)
+
+            let minX = Self.cellIndex(box.minLongitude, cellSize)
+            let maxX = Self.cellIndex(box.maxLongitude, cellSize)
+            let minY = Self.cellIndex(box.minLatitude, cellSize)
+            let maxY = Self.cellIndex(box.maxLatitude, cellSize)
+
+            if maxX - minX >= Self.maxCellsPerAxis || maxY - minY >= Self.maxCellsPerAxis {
+                oversized.append(i)
+                continue
+            }
+            for x in minX...maxX {
+                for y in minY...maxY {
+                    cells[Cell(x: x, y: y), default: []].append(i)
+                }
+            }
+        }
+
+        self.boundingBoxes = boundingBoxes
+        self.cells = cells
+        self.oversized = oversized
+    }
+
+    /// Geofences whose bounding box is within `radius` meters of `coordinate`.
+    func candidates(near coordinate: CLLocationCoordinate2D, radius: Double) -> [RadarGeofenceSwift] {
+        guard !geofences.isEmpty else { return [] }
+
+        let query = Self.boundingBox(center: coordinate, radius: radius)
+        let minX = Self.cellIndex(query.minLongitude, cellSize)
+        let maxX = Self.cellIndex(query.maxLongitude, cellSize)
+        let minY = Self.cellIndex(query.minLatitude, cellSize)
+        let maxY = Self.cellIndex(query.maxLatitude, cellSize)
+
+        var seen = Set<Int>(oversized)
+        if maxX - minX < Self.maxCellsPerAxis && maxY - minY < Self.maxCellsPerAxis {
+            for x in minX...maxX {
+                for y in minY...maxY {
+                    guard let indices = cells[Cell(x: x, y: y)] else { continue }
+                    for i in indices where boundingBoxes[i].intersects(query) {
+                        seen.insert(i)
+                    }
+                }
+            }
+        } else {
+            // query larger than the grid is useful for, fall back to a bounding box scan
+            for i in boundingBoxes.indices where boundingBoxes[i].intersects(query) {
+                seen.insert(i)
+            }
+        }
+
+        return seen.sorted().map { geofences[$0] }
+    }
+
+    // MARK: - Bounding boxes
+
+    static func boundingBox(for geometry: RadarGeofenceGeometrySwift) -> BoundingBox {
+        let circleBox = boundingBox(center: geometry.center.clLocationCoordinate2D, radius: geometry.radius)
+        guard case .polygon(let coordinates, _, _) = geometry, !coordinates.isEmpty else {
+            return circleBox
+        }
+
+        var minLatitude = circleBox.minLatitude
+        var minLongitude = circleBox.minLongitude
+        var maxLatitude = circleBox.maxLatitude
+        var maxLongitude = circleBox.maxLongitude
+        for coordinate in coordinates {
+            minLatitude = min(minLatitude, coordinate.latitude)
+            minLongitude = min(minLongitude, coordinate.longitude)
+            maxLatitude = max(maxLatitude, coordinate.latitude)
+            maxLongitude = max(maxLongitude, coordinate.longitude)
+        }
+        return BoundingBox(minLatitude: minLatitude, minLongitude: minLongitude, maxLatitude: maxLatitude, maxLongitude: maxLongitude)
+    }
+
+    static func boundingBox(center: CLLocationCoordinate2D, radius: Double) -> BoundingBox {
+        let paddedRadius = max(radius, 0) * paddingFactor + paddingMeters
+        let latitudeDelta = paddedRadius / metersPerDegreeLatitude
+        let cosLatitude = max(cos((abs(center.latitude) + latitudeDelta) * .pi / 180.0), 0.01)
+        let longitudeDelta = paddedRadius / (metersPerDegreeLatitude * cosLatitude)
+
+        return BoundingBox(
+            minLatitude: center.latitude - latitudeDelta,
+            minLongitude: center.longitude - longitudeDelta,
+            maxLatitude: center.latitude + latitudeDelta,
+            maxLongitude: center.longitude + longitudeDelta
+        )
+    }
+
+    private static func cellIndex(_ degrees: Double, _ cellSize: Double) -> Int {
+        Int((degrees / cellSize).rounded(.down))
+    }
+}
@@ -0,0 +1,64 @@
+//
+//  RadarGzip.swift
+//  RadarSDK
+//
+//  Copyright © 2026 Radar Labs, Inc. All rights reserved.
+//
+
+import Compression
+import Foundation
+
+/// Gzip encoding for request bodies sent with `Content-Encoding: gzip`.
+///
+/// The Compression framework produces a raw DEFLATE stream; this wraps it in the gzip
+/// header and the CRC-32 and length trailer servers expect.
+enum RadarGzip {
+
+    /// Bodies smaller than this are sent as is; the gzip framing would eat most of the savings.
+    static let minimumLength = 1024
+
+    /// Returns `data` gzip encoded, or nil if it is empty or doesn't get smaller.
+    static func compress(_ data: Data) -> Data? {
+        guard !data.isEmpty else { return nil }
+
+        let capacity = data.count
+        var deflated = Data(count: capacity)
+        let deflatedCount = deflated.withUnsafeMutableBytes { destination in
+            data.withUnsafeBytes { source in
+                compression_encode_buffer(
+                    destination.bindMemory(to: UInt8.self).baseAddress!, capacity,
+                    source.bindMemory(to: UInt8.self).baseAddress!, data.count,
+                    nil, COMPRESSION_ZLIB
+                )
+            }
+        }
+        // 0 means the output didn't fit, i.e. the data doesn't compress
+        guard deflatedCount > 0, deflatedCount + 18 < data.count else { return nil }
+
+        // magic, deflate, no flags, no mtime, no extra flags, unknown OS
+        var gzip = Data([0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF])
+        gzip.reserveCapacity(10 + deflatedCount + 8)
+        gzip.append(deflated.prefix(deflatedCount))
+        withUnsafeBytes(of: crc32(data).littleEndian) { gzip.append(contentsOf: $0) }
+        withUnsafeBytes(of: UInt32(truncatingIfNeeded: data.count).littleEndian) { gzip.append(contentsOf: $0) }
+        return gzip
+    }
+
+    private static let crcTable: [UInt32] = (0..<256).map { index in
+        var crc = UInt32(index)
+        for _ in 0..<8 {
+            crc = crc & 1 == 1 ? 0xEDB8_8320 ^ (crc >> 1) : crc >> 1
+        }
+        return crc
+    }
+
+    static func crc32(_ data: Data) -> UInt32 {
+        var crc: UInt32 = 0xFFFF_FFFF
+        crcTable.withUnsafeBufferPointer { table in
+            for byte in data {
+                crc = table[Int((crc ^ UInt32(byte)) & 0xFF)] ^ (crc >> 8)
+            }
+        }
+        return crc ^ 0xFFFF_FFFF
+    }
+}
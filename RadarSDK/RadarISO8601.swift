@@ -0,0 +1,219 @@
+//
+//  RadarISO8601.swift
+//  RadarSDK
+//
+//  Copyright © 2026 Radar Labs, Inc. All rights reserved.
+//
+
+import Foundation
+
+/// Parses and formats the API's ISO-8601 timestamps, `yyyy-MM-dd'T'HH:mm:ss.SSSZ`, without a
+/// `DateFormatter`.
+///
+/// Both directions are plain arithmetic on UTF-8 bytes, so they are safe to call from any
+/// thread. Parsing reads native strings and most bridged ones in place, and copies the rest
+/// onto the stack, so it doesn't allocate for timestamps up to `stackLength` bytes.
+///
+/// Output matches `RadarUtils.isoDateFormatter`; parsing also takes any number of fraction
+/// digits, no fraction, and `Z`, `±HH`, `±HHMM` or `±HH:MM` offsets.
+enum RadarISO8601 {
+
+    // MARK: - Parsing
+
+    static let stackLength = 64
+
+    static func date(from string: String) -> Date? {
+        if let date = string.utf8.withContiguousStorageIfAvailable({ parse($0) }) {
+            return date
+        }
+
+        // bridged strings: a valid timestamp is ASCII, so CF either has those bytes already or
+        // can write them out, and any other string fails to convert and is rejected
+        let cfString = string as CFString
+        let length = CFStringGetLength(cfString)
+        let encoding = CFStringBuiltInEncodings.ASCII.rawValue
+        if let pointer = CFStringGetCStringPtr(cfString, encoding) {
+            return pointer.withMemoryRebound(to: UInt8.self, capacity: length) { parse(UnsafeBufferPointer(start: $0, count: length)) }
+        }
+        guard length < stackLength else {
+            var string = string
+            return string.withUTF8 { parse($0) }
+        }
+        return withUnsafeTemporaryAllocation(of: CChar.self, capacity: stackLength) { buffer -> Date? in
+            guard let base = buffer.baseAddress, CFStringGetCString(cfString, base, buffer.count, encoding) else { return nil }
+            return base.withMemoryRebound(to: UInt8.self, capacity: length) { parse(UnsafeBufferPointer(start: $0, count: length)) }
+        }
+    }
+
+    static func parse(_ bytes: UnsafeBufferPointer<UInt8>) -> Date? {
+        var index = 0
+
+        func digits(_ count: Int) -> Int? {
+            guard index + count <= bytes.count else { return nil }
+            var value = 0
+            for _ in 0..<count {
+                let digit = Int(bytes[index]) - 0x30
+                guard digit >= 0 && digit <= 9 else { return nil }
+                value = value * 10 + digit
+                index += 1
+            }
+            return value
+        }
+
+        func expect(_ character: UInt8) -> Bool {
+            guard index < bytes.count && bytes[index] == character else { return false }
+            index += 1
+            return true
+        }
+
+        guard let year = digits(4), expect(UInt8(ascii: "-")),
+            let month = digits(2), expect(UInt8(ascii: "-")),
+            let day = digits(2), expect(UInt8(ascii: "T")),
+            let hour = digits(2), expect(UInt8(ascii: ":")),
+            let minute = digits(2), expect(UInt8(ascii: ":")),
+            let second = digits(2)
+        else {
+            return nil
+        }
+        guard month >= 1 && month <= 12, day >= 1 && day <= daysInMonth(month, year: year), hour <= 23, minute <= 59, second <= 59 else {
+            return nil
+        }
+
+        // fraction digits past nanoseconds are read but ignored
+        var nanoseconds = 0
+        if expect(UInt8(ascii: ".")) {
+            var scale = 100_000_000
+            let start = index
+            while index < bytes.count, bytes[index] >= 0x30 && bytes[index] <= 0x39 {
+                nanoseconds += Int(bytes[index] - 0x30) * scale
+                scale /= 10
+                index += 1
+            }
+            guard index > start else { return nil }
+        }
+
+        var offset = 0
+        guard index < bytes.count else { return nil }
+        if expect(UInt8(ascii: "Z")) {
+            offset = 0
+        } else {
+            let sign: Int
+            if expect(UInt8(ascii: "+")) {
+                sign = 1
+            } else if expect(UInt8(ascii: "-")) {
+                sign = -1
+            } else {
+                return nil
+            }
+            guard let offsetHours = digits(2), offsetHours <= 23 else { return nil }
+            var offsetMinutes = 0
+            if index < bytes.count {
+                _ = expect(UInt8(ascii: ":"))
+                guard let minutes = digits(2), minutes <= 59 else { return nil }
+                offsetMinutes = minutes
+            }
+            offset = sign * (offsetHours * 3600 + offsetMinutes * 60)
+        }
+        guard index == bytes.count else { return nil }
+
+        let seconds = daysFromCivil(year: year, month: month, day: day) * 86400 + hour * 3600 + minute * 60 + second - offset
+        return Date(timeIntervalSince1970: TimeInterval(seconds) + TimeInterval(nanoseconds) / 1_000_000_000)
+    }
+
+    // MARK: - Formatting
+
+    private static let length = 28  // 2026-01-01T00:00:00.000+0000
+
+    /// `date` in UTC with millisecond precision, e.g. `2026-01-01T12:30:00.250+0000`.
+    static func string(from date: Date) -> String {
+        // rounded to the microsecond first so a parsed .123 isn't written back as .122, then
+        // truncated to milliseconds as DateFormatter does
+        let totalMicroseconds = Int64((date.timeIntervalSince1970 * 1_000_000).rounded())
+        var seconds = Int(totalMicroseconds / 1_000_000)
+        var microseconds = Int(totalMicroseconds % 1_000_000)
+        if microseconds < 0 {
+            seconds -= 1
+            microseconds += 1_000_000
+        }
+        let ms = microseconds / 1000
+        var days = seconds / 86400
+        var secondOfDay = seconds % 86400
+        if secondOfDay < 0 {
+            days -= 1
+            secondOfDay += 86400
+        }
+        let (year, month, day) = civilFromDays(days)
+
+        return withUnsafeTemporaryAllocation(of: UInt8.self, capacity: length) { buffer in
+            var index = 0
+            func putNumber(_ value: Int, width: Int) {
+                var value = value
+                for position in stride(from: index + width - 1, through: index, by: -1) {
+                    buffer[position] = UInt8(0x30 + value % 10)
+                    value /= 10
+                }
+                index += width
+            }
+            func putCharacter(_ character: Unicode.Scalar) {
+                buffer[index] = UInt8(ascii: character)
+                index += 1
+            }
+
+            putNumber(min(max(year, 0), 9999), width: 4)
+            putCharacter("-")
+            putNumber(month, width: 2)
+            putCharacter("-")
+            putNumber(day, width: 2)
+            putCharacter("T")
+            putNumber(secondOfDay / 3600, width: 2)
+            putCharacter(":")
+            putNumber(secondOfDay / 60 % 60, width: 2)
+            putCharacter(":")
+            putNumber(secondOfDay % 60, width: 2)
+            putCharacter(".")
+            putNumber(ms, width: 3)
+            putCharacter("+")
+            putNumber(0, width: 4)
+            return String(decoding: UnsafeBufferPointer(rebasing: buffer[0..<index]), as: UTF8.self)
+        }
+    }
+
+    // MARK: - Calendar
+
+    private static func isLeapYear(_ year: Int) -> Bool {
+        year % 4 == 0 && (year % 100 != 0 || year % 400 == 0)
+    }
+
+    private static func daysInMonth(_ month: Int, year: Int) -> Int {
+        switch month {
+        case 2:
+            return isLeapYear(year) ? 29 : 28
+        case 4, 6, 9, 11:
+            return 30
+        default:
+            return 31
+        }
+    }
+
+    // days since 1970-01-01 in the proleptic Gregorian calendar, from Howard Hinnant's date algorithms
+    static func daysFromCivil(year: Int, month: Int, day: Int) -> Int {
+        let year = month <= 2 ? year - 1 : year
+        let era = (year >= 0 ? year : year - 399) / 400
+        let yearOfEra = year - era * 400
+        let dayOfYear = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1
+        let dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear
+        return era * 146097 + dayOfEra - 719468
+    }
+
+    static func civilFromDays(_ days: Int) -> (year: Int, month: Int, day: Int) {
+        let days = days + 719468
+        let era = (days >= 0 ? days : days - 146096) / 146097
+        let dayOfEra = days - era * 146097
+        let yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365
+        let dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100)
+        let shiftedMonth = (5 * dayOfYear + 2) / 153
+        let day = dayOfYear - (153 * shiftedMonth + 2) / 5 + 1
+        let month = shiftedMonth < 10 ? shiftedMonth + 3 : shiftedMonth - 9
+        return (yearOfEra + era * 400 + (month <= 2 ? 1 : 0), month, day)
+    }
+}
@@ -132,7 +132,7 @@ internal class RadarIndoors: NSObject {
     }
 
     nonisolated static func triggerTrackForIndoorUpdate(bridge: RadarSwiftBridgeProtocol?) {
-        guard RadarSettings.tracking, Radar.getTrackingOptions().useIndoorScan,
+        guard RadarSettings.tracking, RadarSettings.effectiveTrackingOptions.useIndoorScan,
             let deviceLocation = bridge?.lastLocation()
         else {
             return
@@ -167,7 +167,7 @@ internal class RadarIndoors: NSObject {
     }
 
     nonisolated static func bootstrapTrackingIfNeeded(trackOnce: () -> Void) {
-        guard Radar.getTrackingOptions().useIndoorScan else {
+        guard RadarSettings.effectiveTrackingOptions.useIndoorScan else {
             return
         }
 
@@ -178,13 +178,13 @@ internal class RadarIndoors: NSObject {
 
     public func updateTracking(geofences: [RadarGeofence]?) async {
         guard let sdk else {
-            if Radar.getTrackingOptions().useIndoorScan {
+            if RadarSettings.effectiveTrackingOptions.useIndoorScan {
                 // if using indoor scan, we're expecting the IndoorSDK to be available, so log a warning if it's not available
                 RadarLogger.shared.warning("RadarIndoors class is nil")
             }
             return
         }
-        if !Radar.getTrackingOptions().useIndoorScan {
+        if !RadarSettings.effectiveTrackingOptions.useIndoorScan {
             await stop()
             return
         }
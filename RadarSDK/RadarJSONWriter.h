@@ -0,0 +1,19 @@
+//
+//  RadarJSONWriter.h
+//  RadarSDK
+//
+//  Copyright © 2026 Radar Labs, Inc. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+@interface RadarJSONWriter : NSObject
+
+// writes params as JSON, stamping updatedAtMsDiff for the request and its replays as of nowMs
++ (NSData *)requestBodyWithParams:(NSDictionary *)params nowMs:(long long)nowMs;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,218 @@
+//
+//  RadarJSONWriter.swift
+//  RadarSDK
+//
+//  Copyright © 2026 Radar Labs, Inc. All rights reserved.
+//
+
+import Foundation
+
+/// Writes API request bodies straight from the params dictionary into one UTF-8 buffer.
+///
+/// Replaces copying the params and every replay to stamp `updatedAtMsDiff`, sanitizing the
+/// tree and then serializing it: the time-sensitive fields are written with their send-time
+/// values as the body is produced, and values `JSONSerialization` can't encode (non-string
+/// keys, NaN and infinite numbers, dates, data) are skipped in place, as `jsonSanitized` does.
+@objc(RadarJSONWriter)
+final class RadarJSONWriter: NSObject {
+
+    // size of the previous body, used to reserve the next buffer up front
+    nonisolated(unsafe) private static var lastBodySize = 4096
+    private static let lock = NSLock()
+
+    private var bytes = [UInt8]()
+
+    private init(capacity: Int) {
+        bytes.reserveCapacity(capacity)
+    }
+
+    /// Body for `params` sent at `nowMs`. When `params` has `updatedAtMsDiff` and `locationMs`,
+    /// or replays, `updatedAtMsDiff` is recomputed from `locationMs` for the request and for
+    /// each replay that has a `locationMs`.
+    @objc(requestBodyWithParams:nowMs:)
+    static func requestBody(params: NSDictionary, nowMs: Int64) -> Data {
+        lock.lock()
+        let capacity = lastBodySize + lastBodySize / 4
+        lock.unlock()
+
+        let writer = RadarJSONWriter(capacity: capacity)
+        let stampsTime = params["updatedAtMsDiff"] != nil || params["replays"] != nil
+        writer.writeObject(params, nowMs: stampsTime ? nowMs : nil, isRequest: true)
+
+        lock.lock()
+        lastBodySize = writer.bytes.count
+        lock.unlock()
+        return Data(writer.bytes)
+    }
+
+    // MARK: - Values
+
+    /// Writes a dictionary. With `nowMs`, `updatedAtMsDiff` is derived from `locationMs`; at the
+    /// top level only when the request already had one, in replays always.
+    private func writeObject(_ dict: NSDictionary, nowMs: Int64? = nil, isRequest: Bool = false) {
+        var updatedAtMsDiff: Int64?
+        if let nowMs, let locationMs = dict["locationMs"] as? NSNumber {
+            updatedAtMsDiff = nowMs - locationMs.int64Value
+        }
+
+        bytes.append(UInt8(ascii: "{"))
+        var first = true
+        for case let (key as String, value) in dict {
+            if updatedAtMsDiff != nil && key == "updatedAtMsDiff" {
+                continue
+            }
+            if !isWritable(value) {
+                continue
+            }
+            writeSeparator(&first)
+            writeString(key)
+            bytes.append(UInt8(ascii: ":"))
+            if isRequest, nowMs != nil, key == "replays", let replays = value as? NSArray {
+                writeReplays(replays, nowMs: nowMs)
+            } else {
+                write(value)
+            }
+        }
+        if let updatedAtMsDiff, !isRequest || dict["updatedAtMsDiff"] != nil {
+            writeSeparator(&first)
+            writeString("updatedAtMsDiff")
+            bytes.append(UInt8(ascii: ":"))
+            writeInteger(updatedAtMsDiff)
+        }
+        bytes.append(UInt8(ascii: "}"))
+    }
+
+    private func writeReplays(_ replays: NSArray, nowMs: Int64?) {
+        bytes.append(UInt8(ascii: "["))
+        var first = true
+        for replay in replays {
+            guard isWritable(replay) else { continue }
+            writeSeparator(&first)
+            if let replay = replay as? NSDictionary {
+                writeObject(replay, nowMs: nowMs)
+            } else {
+                write(replay)
+            }
+        }
+        bytes.append(UInt8(ascii: "]"))
+    }
+
+    private func writeArray(_ array: NSArray) {
+        bytes.append(UInt8(ascii: "["))
+        var first = true
+        for element in array where isWritable(element) {
+            writeSeparator(&first)
+            write(element)
+        }
+        bytes.append(UInt8(ascii: "]"))
+    }
+
+    private func write(_ value: Any) {
+        switch value {
+        case let string as String:
+            writeString(string)
+        case let number as NSNumber:
+            writeNumber(number)
+        case let dict as NSDictionary:
+            writeObject(dict)
+        case let array as NSArray:
+            writeArray(array)
+        default:
+            bytes.append(contentsOf: "null".utf8)
+        }
+    }
+
+    private func isWritable(_ value: Any) -> Bool {
+        switch value {
+        case is String, is NSDictionary, is NSArray, is NSNull:
+            return true
+        case let number as NSNumber:
+            return number.doubleValue.isFinite
+        default:
+            return false
+        }
+    }
+
+    private func writeSeparator(_ first: inout Bool) {
+        if first {
+            first = false
+        } else {
+            bytes.append(UInt8(ascii: ","))
+        }
+    }
+
+    // MARK: - Scalars
+
+    private func writeNumber(_ number: NSNumber) {
+        if CFGetTypeID(number) == CFBooleanGetTypeID() {
+            bytes.append(contentsOf: (number.boolValue ? "true" : "false").utf8)
+            return
+        }
+        switch UInt8(bitPattern: number.objCType.pointee) {
+        case UInt8(ascii: "f"), UInt8(ascii: "d"):
+            let double = number.doubleValue
+            // whole values are written without a fraction, as JSONSerialization does
+            if double == double.rounded(.towardZero) && abs(double) < 1e15 {
+                writeInteger(Int64(double))
+            } else {
+                bytes.append(contentsOf: double.description.utf8)
+            }
+        case UInt8(ascii: "Q"):
+            writeDigits(number.uint64Value)
+        default:
+            writeInteger(number.int64Value)
+        }
+    }
+
+    private func writeInteger(_ value: Int64) {
+        if value < 0 {
+            bytes.append(UInt8(ascii: "-"))
+        }
+        writeDigits(value.magnitude)
+    }
+
+    private func writeDigits(_ value: UInt64) {
+        // digits are produced least significant first, then reversed in place
+        let start = bytes.count
+        var remaining = value
+        repeat {
+            bytes.append(UInt8(ascii: "0") + UInt8(remaining % 10))
+            remaining /= 10
+        } while remaining > 0
+        bytes[start...].reverse()
+    }
+
+    private func writeEscape(_ character: UInt8) {
+        bytes.append(UInt8(ascii: "\\"))
+        bytes.append(character)
+    }
+
+    private static let hexDigits = Array("0123456789abcdef".utf8)
+
+    private func writeString(_ string: String) {
+        bytes.append(UInt8(ascii: "\""))
+        for byte in string.utf8 {
+            switch byte {
+            case UInt8(ascii: "\""):
+                writeEscape(UInt8(ascii: "\""))
+            case UInt8(ascii: "\\"):
+                writeEscape(UInt8(ascii: "\\"))
+            case UInt8(ascii: "\n"):
+                writeEscape(UInt8(ascii: "n"))
+            case UInt8(ascii: "\r"):
+                writeEscape(UInt8(ascii: "r"))
+            case UInt8(ascii: "\t"):
+                writeEscape(UInt8(ascii: "t"))
+            case 0..<0x20:
+                writeEscape(UInt8(ascii: "u"))
+                bytes.append(UInt8(ascii: "0"))
+                bytes.append(UInt8(ascii: "0"))
+                bytes.append(Self.hexDigits[Int(byte >> 4)])
+                bytes.append(Self.hexDigits[Int(byte & 0xF)])
+            default:
+                bytes.append(byte)
+            }
+        }
+        bytes.append(UInt8(ascii: "\""))
+    }
+}
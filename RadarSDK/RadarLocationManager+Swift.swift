@@ -83,7 +83,7 @@ final class RadarLocationManagerSwift: NSObject {
 
         removeSyncedBeacons(locationManager: locationManager)
 
-        let options = Radar.getTrackingOptions()
+        let options = RadarSettings.effectiveTrackingOptions
         guard RadarSettings.tracking, options.beacons, let beacons else {
             RadarLogger.shared.debug("🦅 Skipping replacing synced beacons")
             return
@@ -134,7 +134,7 @@ final class RadarLocationManagerSwift: NSObject {
 
         removeSyncedBeacons(locationManager: locationManager)
 
-        let options = Radar.getTrackingOptions()
+        let options = RadarSettings.effectiveTrackingOptions
         guard RadarSettings.tracking, options.beacons, let uuids else {
             RadarLogger.shared.debug("🦅 Skipping replacing synced beacon UUIDs")
             return
@@ -218,7 +218,7 @@ final class RadarLocationManagerSwift: NSObject {
 
         removeSyncedGeofences(locationManager: locationManager)
 
-        let options = Radar.getTrackingOptions()
+        let options = RadarSettings.effectiveTrackingOptions
         let numGeofences = min(geofences.count, options.beacons ? 9 : 19)
 
         for geofence in geofences.prefix(numGeofences) {
@@ -307,7 +307,7 @@ extension RadarLocationManagerSwift {
             RadarSettings.remoteTrackingOptions = trackingOptions
         } else {
             RadarSettings.remoteTrackingOptions = nil
-            RadarLogger.shared.debug("🦅 Removed remote tracking options | trackingOptions = \(Radar.getTrackingOptions())")
+            RadarLogger.shared.debug("🦅 Removed remote tracking options | trackingOptions = \(RadarSettings.effectiveTrackingOptions)")
         }
     }
 }
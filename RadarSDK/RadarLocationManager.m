@@ -19,6 +19,8 @@
 #import "RadarPolygonGeometry.h"
 #import "RadarSettings.h"
 #import "RadarState.h"
+#import "RadarTrackResponse.h"
+#import "RadarURLSession.h"
 #import "RadarUtils.h"
 #import "RadarReplayBuffer.h"
 #import "RadarActivityManager.h"
@@ -212,6 +214,7 @@ static NSString *const kSyncBeaconUUIDIdentifierPrefix = @"radar_uuid_";
     [RadarSettings setTrackingOptions:trackingOptions];
     [self updateTracking];
     [RadarIndoors bootstrapTrackingIfNeeded];
+    [[RadarURLSession shared] prewarm];
 }
 
 - (void)stopTracking {
@@ -342,7 +345,7 @@ static NSString *const kSyncBeaconUUIDIdentifierPrefix = @"radar_uuid_";
 - (void)updateTracking:(CLLocation *)location fromInitialize:(BOOL)fromInitialize {
     dispatch_async(dispatch_get_main_queue(), ^{
         BOOL tracking = [RadarSettings tracking];
-        RadarTrackingOptions *options = [Radar getTrackingOptions];
+        RadarTrackingOptions *options = [RadarSettings effectiveTrackingOptions];
         RadarTrackingOptions *localOptions = [RadarSettings trackingOptions];
 
         [[RadarLogger sharedInstance] logWithLevel:RadarLogLevelDebug
@@ -610,6 +613,16 @@ static NSString *const kSyncBeaconUUIDIdentifierPrefix = @"radar_uuid_";
     [[RadarLogger sharedInstance] logWithLevel:RadarLogLevelDebug message:@"Removed bubble geofences"];
 }
 
+- (void)updateIndoorTrackingWithResponse:(RadarTrackResponse *_Nullable)response {
+    if (!response.hasUser) {
+        return;
+    }
+
+    // indoor scanning reads the user's geofences, so the user is only built while it is on
+    NSArray<RadarGeofence *> *geofences = [RadarSettings effectiveTrackingOptions].useIndoorScan ? response.user.geofences : nil;
+    [[RadarIndoors shared] updateTrackingWithGeofences:geofences completionHandler:^{}];
+}
+
 - (void)replaceSyncedGeofences:(NSArray<RadarGeofence *> *)geofences {
     if ([RadarSettings sdkConfiguration].useSwiftLocationManager) {
         [[RadarNotificationHelper_Swift shared] registerGeofenceNotificationsWithGeofences:[RadarGeofence arrayForGeofences:geofences]
@@ -641,7 +654,7 @@ static NSString *const kSyncBeaconUUIDIdentifierPrefix = @"radar_uuid_";
     
     [self removeSyncedGeofences];
 
-    RadarTrackingOptions *options = [Radar getTrackingOptions];
+    RadarTrackingOptions *options = [RadarSettings effectiveTrackingOptions];
     NSUInteger numGeofences = MIN(geofences.count, options.beacons ? 9 : 19);
 
     for (int i = 0; i < numGeofences; i++) {
@@ -722,7 +735,7 @@ static NSString *const kSyncBeaconUUIDIdentifierPrefix = @"radar_uuid_";
     [self removeSyncedBeacons];
 
     BOOL tracking = [RadarSettings tracking];
-    RadarTrackingOptions *options = [Radar getTrackingOptions];
+    RadarTrackingOptions *options = [RadarSettings effectiveTrackingOptions];
     if (!tracking || !options.beacons || !beacons) {
         [[RadarLogger sharedInstance] logWithLevel:RadarLogLevelDebug message:@"Skipping replacing synced beacons"];
 
@@ -768,7 +781,7 @@ static NSString *const kSyncBeaconUUIDIdentifierPrefix = @"radar_uuid_";
     [self removeSyncedBeacons];
 
     BOOL tracking = [RadarSettings tracking];
-    RadarTrackingOptions *options = [Radar getTrackingOptions];
+    RadarTrackingOptions *options = [RadarSettings effectiveTrackingOptions];
     if (!tracking || !options.beacons || !uuids) {
         return;
     }
@@ -832,7 +845,9 @@ static NSString *const kSyncBeaconUUIDIdentifierPrefix = @"radar_uuid_";
 
 - (void)handleLocation:(CLLocation *)location source:(RadarLocationSource)source beacons:(NSArray<RadarBeacon *> *)beacons {
     [[RadarLogger sharedInstance] logWithLevel:RadarLogLevelDebug
-                                       message:[NSString stringWithFormat:@"Handling location | source = %@; location = %@", [Radar stringForLocationSource:source], location]];
+                                  messageBlock:^NSString * {
+                                      return [NSString stringWithFormat:@"Handling location | source = %@; location = %@", [Radar stringForLocationSource:source], location];
+                                  }];
 
     BOOL bypassDeviceLocationState = [RadarLocationManagerSwift shouldBypassDeviceLocationStateForSource:source];
 
@@ -842,14 +857,16 @@ static NSString *const kSyncBeaconUUIDIdentifierPrefix = @"radar_uuid_";
 
     if (!location.isValid) {
         [[RadarLogger sharedInstance] logWithLevel:RadarLogLevelDebug
-                                           message:[NSString stringWithFormat:@"Invalid location | source = %@; location = %@", [Radar stringForLocationSource:source], location]];
+                                      messageBlock:^NSString * {
+                                          return [NSString stringWithFormat:@"Invalid location | source = %@; location = %@", [Radar stringForLocationSource:source], location];
+                                      }];
 
         [self callCompletionHandlersWithStatus:RadarStatusErrorLocation location:nil];
 
         return;
     }
 
-    RadarTrackingOptions *options = [Radar getTrackingOptions];
+    RadarTrackingOptions *options = [RadarSettings effectiveTrackingOptions];
     BOOL wasStopped = [RadarState stopped];
     BOOL stopped = NO;
 
@@ -857,7 +874,9 @@ static NSString *const kSyncBeaconUUIDIdentifierPrefix = @"radar_uuid_";
                   source == RadarLocationSourceBeaconExit || source == RadarLocationSourceVisitArrival));
     if (!bypassDeviceLocationState && wasStopped && !force && location.horizontalAccuracy >= 1000 && options.desiredAccuracy != RadarTrackingOptionsDesiredAccuracyLow) {
         [[RadarLogger sharedInstance] logWithLevel:RadarLogLevelDebug
-                                           message:[NSString stringWithFormat:@"Skipping location: inaccurate | accuracy = %f", location.horizontalAccuracy]];
+                                      messageBlock:^NSString * {
+                                          return [NSString stringWithFormat:@"Skipping location: inaccurate | accuracy = %f", location.horizontalAccuracy];
+                                      }];
 
         [self updateTracking:location];
 
@@ -889,9 +908,10 @@ static NSString *const kSyncBeaconUUIDIdentifierPrefix = @"radar_uuid_";
             [RadarState setLastMovedAt:lastMovedAt];
         }
         if (!force && [lastMovedAt timeIntervalSinceDate:location.timestamp] > 0) {
-            [[RadarLogger sharedInstance]
-                logWithLevel:RadarLogLevelDebug
-                     message:[NSString stringWithFormat:@"Skipping location: old | lastMovedAt = %@; location.timestamp = %@", lastMovedAt, location.timestamp]];
+            [[RadarLogger sharedInstance] logWithLevel:RadarLogLevelDebug
+                                          messageBlock:^NSString * {
+                                              return [NSString stringWithFormat:@"Skipping location: old | lastMovedAt = %@; location.timestamp = %@", lastMovedAt, location.timestamp];
+                                          }];
 
             return;
         }
@@ -904,10 +924,10 @@ static NSString *const kSyncBeaconUUIDIdentifierPrefix = @"radar_uuid_";
             BOOL arrival = source == RadarLocationSourceVisitArrival;
             stopped = (distance <= options.stopDistance && duration >= options.stopDuration) || arrival;
 
-            [[RadarLogger sharedInstance]
-                logWithLevel:RadarLogLevelDebug
-                     message:[NSString stringWithFormat:@"Calculating stopped | stopped = %d; arrival = %d; distance = %f; duration = %f; location.timestamp = %@; lastMovedAt = %@", stopped,
-                              arrival, distance, duration, location.timestamp, lastMovedAt]];
+            [[RadarLogger sharedInstance] logWithLevel:RadarLogLevelDebug
+                                          messageBlock:^NSString * {
+                                              return [NSString stringWithFormat:@"Calculating stopped | stopped = %d; arrival = %d; distance = %f; duration = %f; location.timestamp = %@; lastMovedAt = %@", stopped, arrival, distance, duration, location.timestamp, lastMovedAt];
+                                          }];
 
             if (distance > options.stopDistance) {
                 [RadarState setLastMovedLocation:location];
@@ -954,7 +974,9 @@ static NSString *const kSyncBeaconUUIDIdentifierPrefix = @"radar_uuid_";
         [RadarState setLastFailedStoppedLocation:nil];
 
         [[RadarLogger sharedInstance] logWithLevel:RadarLogLevelDebug
-                                           message:[NSString stringWithFormat:@"Replaying location | location = %@; stopped = %d", sendLocation, stopped]];
+                                      messageBlock:^NSString * {
+                                          return [NSString stringWithFormat:@"Replaying location | location = %@; stopped = %d", sendLocation, stopped];
+                                      }];
     }
 
     NSDate *lastSentAt = [RadarState lastSentAt];
@@ -966,7 +988,9 @@ static NSString *const kSyncBeaconUUIDIdentifierPrefix = @"radar_uuid_";
         if (!bypassDeviceLocationState && !force && stopped && wasStopped && distance <= options.stopDistance &&
             (options.desiredStoppedUpdateInterval == 0 || (options.syncLocations != RadarTrackingOptionsSyncAll && options.syncLocations != RadarTrackingOptionsSyncEvents))) {
             [[RadarLogger sharedInstance] logWithLevel:RadarLogLevelDebug
-                                               message:[NSString stringWithFormat:@"Skipping sync: already stopped | stopped = %d; wasStopped = %d", stopped, wasStopped]];
+                                          messageBlock:^NSString * {
+                                              return [NSString stringWithFormat:@"Skipping sync: already stopped | stopped = %d; wasStopped = %d", stopped, wasStopped];
+                                          }];
 
             return;
         }
@@ -975,24 +999,27 @@ static NSString *const kSyncBeaconUUIDIdentifierPrefix = @"radar_uuid_";
         NSTimeInterval lastSyncIntervalWithBuffer = lastSyncInterval + 0.1;
         if (lastSyncIntervalWithBuffer < options.desiredSyncInterval) {
             [[RadarLogger sharedInstance] logWithLevel:RadarLogLevelDebug
-                                               message:[NSString stringWithFormat:@"Skipping sync: desired sync interval | desiredSyncInterval = %d; lastSyncInterval = %f",
-                                                                                  options.desiredSyncInterval, lastSyncIntervalWithBuffer]];
+                                          messageBlock:^NSString * {
+                                              return [NSString stringWithFormat:@"Skipping sync: desired sync interval | desiredSyncInterval = %d; lastSyncInterval = %f", options.desiredSyncInterval, lastSyncIntervalWithBuffer];
+                                          }];
 
             return;
         }
 
         if (!force && !justStopped && lastSyncInterval < 1) {
-            [[RadarLogger sharedInstance]
-                logWithLevel:RadarLogLevelDebug
-                     message:[NSString stringWithFormat:@"Skipping sync: rate limit | justStopped = %d; lastSyncInterval = %f", justStopped, lastSyncInterval]];
+            [[RadarLogger sharedInstance] logWithLevel:RadarLogLevelDebug
+                                          messageBlock:^NSString * {
+                                              return [NSString stringWithFormat:@"Skipping sync: rate limit | justStopped = %d; lastSyncInterval = %f", justStopped, lastSyncInterval];
+                                          }];
 
             return;
         }
 
         if (options.syncLocations == RadarTrackingOptionsSyncNone) {
-            [[RadarLogger sharedInstance]
-                logWithLevel:RadarLogLevelDebug
-                     message:[NSString stringWithFormat:@"Skipping sync: sync mode | sync = %@", [RadarTrackingOptions stringForSyncLocations:options.syncLocations]]];
+            [[RadarLogger sharedInstance] logWithLevel:RadarLogLevelDebug
+                                          messageBlock:^NSString * {
+                                              return [NSString stringWithFormat:@"Skipping sync: sync mode | sync = %@", [RadarTrackingOptions stringForSyncLocations:options.syncLocations]];
+                                          }];
 
             return;
         }
@@ -1000,8 +1027,9 @@ static NSString *const kSyncBeaconUUIDIdentifierPrefix = @"radar_uuid_";
         BOOL canExit = [RadarState canExit];
         if (!canExit && options.syncLocations == RadarTrackingOptionsSyncStopsAndExits) {
             [[RadarLogger sharedInstance] logWithLevel:RadarLogLevelDebug
-                                               message:[NSString stringWithFormat:@"Skipping sync: can't exit | sync = %@; canExit = %d",
-                                                                                  [RadarTrackingOptions stringForSyncLocations:options.syncLocations], canExit]];
+                                          messageBlock:^NSString * {
+                                              return [NSString stringWithFormat:@"Skipping sync: can't exit | sync = %@; canExit = %d", [RadarTrackingOptions stringForSyncLocations:options.syncLocations], canExit];
+                                          }];
 
             return;
         }
@@ -1012,13 +1040,18 @@ static NSString *const kSyncBeaconUUIDIdentifierPrefix = @"radar_uuid_";
         
         if (location.horizontalAccuracy >= 1000 && options.desiredAccuracy != RadarTrackingOptionsDesiredAccuracyLow) {
             [[RadarLogger sharedInstance] logWithLevel:RadarLogLevelInfo
-                                               message:[NSString stringWithFormat:@"Skipping sync region eval: inaccurate | accuracy = %f", location.horizontalAccuracy]];
+                                          messageBlock:^NSString * {
+                                              return [NSString stringWithFormat:@"Skipping sync region eval: inaccurate | accuracy = %f", location.horizontalAccuracy];
+                                          }];
             return;
         }
         
         BOOL geofenceOrPlaceChanged = [RadarSyncManager shouldTrackWithLocation:location options:options];
         
         if (geofenceOrPlaceChanged) {
+            if (options.batchAdaptive) {
+                [[RadarReplayBuffer sharedInstance] markBatchEventForLocation:sendLocation];
+            }
             [RadarState updateLastSentAt];
             [self sendLocation:sendLocation stopped:stopped source:source replayed:replayed beacons:beacons forceTrack:YES];
             return;
@@ -1030,7 +1063,9 @@ static NSString *const kSyncBeaconUUIDIdentifierPrefix = @"radar_uuid_";
         }
         
         [[RadarLogger sharedInstance] logWithLevel:RadarLogLevelInfo
-                                           message:[NSString stringWithFormat:@"Skipping track: useSyncRegion - no state change detected | source = %@", [Radar stringForLocationSource:source]]];
+                                      messageBlock:^NSString * {
+                                          return [NSString stringWithFormat:@"Skipping track: useSyncRegion - no state change detected | source = %@", [Radar stringForLocationSource:source]];
+                                      }];
         return;
     }
     
@@ -1050,7 +1085,7 @@ static NSString *const kSyncBeaconUUIDIdentifierPrefix = @"radar_uuid_";
 
     self.sending = YES;
 
-    RadarTrackingOptions *options = [Radar getTrackingOptions];
+    RadarTrackingOptions *options = [RadarSettings effectiveTrackingOptions];
     
     if ([RadarSettings useRadarModifiedBeacon]) {
         void (^callTrackAPI)(NSArray<RadarBeacon *> *_Nullable) = ^(NSArray<RadarBeacon *> *_Nullable beacons) {
@@ -1062,13 +1097,13 @@ static NSString *const kSyncBeaconUUIDIdentifierPrefix = @"radar_uuid_";
                                                           replayed:replayed
                                                            beacons:beacons
                                                     indoorLocation:indoorLocation
-                                                 completionHandler:^(RadarStatus status, NSDictionary *_Nullable res, NSArray<RadarEvent *> *_Nullable events, RadarUser *_Nullable user,
+                                                 completionHandler:^(RadarStatus status, NSDictionary *_Nullable res, NSArray<RadarEvent *> *_Nullable events, RadarTrackResponse *_Nullable response,
                                                                      NSArray<RadarGeofence *> *_Nullable nearbyGeofences, RadarConfig *_Nullable config, RadarVerifiedLocationToken *_Nullable token) {
                     self.sending = NO;
 
                     if ([RadarSettings sdkConfiguration].useSyncRegion) {
-                        if (status == RadarStatusSuccess && user) {
-                            [RadarSyncManager reconcileSyncStateWithUser:user];
+                        if (status == RadarStatusSuccess && response.hasUser) {
+                            [RadarSyncManager reconcileSyncStateWithGeofenceIds:response.geofenceIds placeId:response.placeId beaconIds:response.beaconIds];
 
                             for (RadarEvent *event in events) {
                                 if (event.type == RadarEventTypeUserDwelledInGeofence && event.geofence && event.geofence._id) {
@@ -1082,9 +1117,7 @@ static NSString *const kSyncBeaconUUIDIdentifierPrefix = @"radar_uuid_";
 
                     [self updateTrackingFromMeta:config.meta];
                     [self replaceSyncedGeofences:nearbyGeofences];
-                    if (user) {
-                        [[RadarIndoors shared] updateTrackingWithGeofences:user.geofences completionHandler:^{}];
-                    }
+                    [self updateIndoorTrackingWithResponse:response];
                 }];
             }];
         };
@@ -1215,12 +1248,12 @@ static NSString *const kSyncBeaconUUIDIdentifierPrefix = @"radar_uuid_";
                                                                                       replayed:replayed
                                                                                        beacons:rangedBeacons
                                                                                 indoorLocation:indoorLocation
-                                                                             completionHandler:^(RadarStatus status, NSDictionary *_Nullable res, NSArray<RadarEvent *> *_Nullable events, RadarUser *_Nullable user,
+                                                                             completionHandler:^(RadarStatus status, NSDictionary *_Nullable res, NSArray<RadarEvent *> *_Nullable events, RadarTrackResponse *_Nullable response,
                                                                                                  NSArray<RadarGeofence *> *_Nullable nearbyGeofences, RadarConfig *_Nullable config, RadarVerifiedLocationToken *_Nullable token) {
                                                 self.sending = NO;
                                                 if ([RadarSettings sdkConfiguration].useSyncRegion) {
-                                                    if (status == RadarStatusSuccess && user) {
-                                                        [RadarSyncManager reconcileSyncStateWithUser:user];
+                                                    if (status == RadarStatusSuccess && response.hasUser) {
+                                                        [RadarSyncManager reconcileSyncStateWithGeofenceIds:response.geofenceIds placeId:response.placeId beaconIds:response.beaconIds];
 
                                                         for (RadarEvent *event in events) {
                                                             if (event.type == RadarEventTypeUserDwelledInGeofence && event.geofence && event.geofence._id) {
@@ -1231,9 +1264,7 @@ static NSString *const kSyncBeaconUUIDIdentifierPrefix = @"radar_uuid_";
                                                         [RadarSyncManager rollbackSyncState];
                                                     }
                                                 }
-                                                if (user) {
-                                                    [[RadarIndoors shared] updateTrackingWithGeofences:user.geofences completionHandler:^{}];
-                                                }
+                                                [self updateIndoorTrackingWithResponse:response];
                                                 if (!config) { return; }
                                                 [self updateTrackingFromMeta:config.meta];
                                                 if (status == RadarStatusSuccess) {
@@ -1274,13 +1305,13 @@ static NSString *const kSyncBeaconUUIDIdentifierPrefix = @"radar_uuid_";
                                                       replayed:replayed
                                                        beacons:beacons
                                                 indoorLocation:indoorLocation
-                                             completionHandler:^(RadarStatus status, NSDictionary *_Nullable res, NSArray<RadarEvent *> *_Nullable events, RadarUser *_Nullable user,
+                                             completionHandler:^(RadarStatus status, NSDictionary *_Nullable res, NSArray<RadarEvent *> *_Nullable events, RadarTrackResponse *_Nullable response,
                                                                  NSArray<RadarGeofence *> *_Nullable nearbyGeofences, RadarConfig *_Nullable config, RadarVerifiedLocationToken *_Nullable token) {
                 self.sending = NO;
 
                 if ([RadarSettings sdkConfiguration].useSyncRegion) {
-                    if (status == RadarStatusSuccess && user) {
-                        [RadarSyncManager reconcileSyncStateWithUser:user];
+                    if (status == RadarStatusSuccess && response.hasUser) {
+                        [RadarSyncManager reconcileSyncStateWithGeofenceIds:response.geofenceIds placeId:response.placeId beaconIds:response.beaconIds];
 
                         for (RadarEvent *event in events) {
                             if (event.type == RadarEventTypeUserDwelledInGeofence && event.geofence && event.geofence._id) {
@@ -1292,9 +1323,7 @@ static NSString *const kSyncBeaconUUIDIdentifierPrefix = @"radar_uuid_";
                     }
                 }
 
-                if (user) {
-                    [[RadarIndoors shared] updateTrackingWithGeofences:user.geofences completionHandler:^{}];
-                }
+                [self updateIndoorTrackingWithResponse:response];
 
                 if (!config) {
                     return;
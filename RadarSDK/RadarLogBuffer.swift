@@ -6,6 +6,7 @@
 //
 
 import OSLog
+import UIKit
 
 actor RadarLogBuffer {
 
@@ -13,13 +14,16 @@ actor RadarLogBuffer {
 
     var logs = [RadarLog]()
 
-    // the logs file is a full reflection of the logs
-    let logsFile: RadarFileStorage?
+    // segmented on-disk copy of the logs, committed in batches
+    let logsStore: RadarLogSegments?
 
     let MAX_LOGS: Int  // swiftlint:disable:this identifier_name
     let KEEP: Int
+    // logs sent per request by flush()
+    let CHUNK_SIZE: Int  // swiftlint:disable:this identifier_name
 
-    let NEW_LINE = "\n".data(using: .utf8)!  // swiftlint:disable:this identifier_name non_optional_string_data_conversion
+    // how long appended logs may wait in memory before they are committed to disk
+    let COMMIT_DELAY: UInt64 = 5_000_000_000  // swiftlint:disable:this identifier_name
 
     // in testing mode, allow overriding useLogPersistence
     var useLogPersistenceOverride: Bool?
@@ -29,10 +33,22 @@ actor RadarLogBuffer {
 
     let apiClient: RadarAPIClient
 
-    init(logsFile: String = "persistent_logs.txt", maxLogs: Int = 500, keep: Int = 250, logPersistence: Bool? = nil, apiClient: RadarAPIClient = RadarAPIClient.shared) {
-        self.logsFile = RadarFileStorage(fileName: logsFile)
+    private var commitScheduled = false
+    private var flushing = false
+    // logs ever removed from the front of `logs`, so a flush can tell which of the logs it
+    // sent are still buffered after awaiting the upload
+    private var removedCount = 0
+    private(set) var lifecycleObservers = [NSObjectProtocol]()
+
+    init(
+        logsFile: String = "persistent_logs.txt", maxLogs: Int = 500, keep: Int = 250, chunkSize: Int = 100, logPersistence: Bool? = nil,
+        apiClient: RadarAPIClient = RadarAPIClient.shared
+    ) {
+        // a trim drops whole segments, so several must fit between KEEP and MAX_LOGS
+        self.logsStore = RadarLogSegments(name: logsFile, segmentCapacity: (maxLogs - keep) / 2)
         self.MAX_LOGS = maxLogs
         self.KEEP = keep
+        self.CHUNK_SIZE = max(chunkSize, 1)
         self.useLogPersistenceOverride = logPersistence
         self.apiClient = apiClient
 
@@ -41,56 +57,100 @@ actor RadarLogBuffer {
         }
     }
 
-    func loadLogs() async {
-        guard let logsFile, #available(iOS 15.0, *) else { return }
+    deinit {
+        for observer in lifecycleObservers {
+            NotificationCenter.default.removeObserver(observer)
+        }
+    }
 
-        do {
-            for try await line in logsFile.file.lines {
-                guard let data = line.data(using: .utf8) else {
-                    continue
-                }
-                guard let log = try? JSONDecoder().decode(RadarLog.self, from: data) else {
-                    continue
-                }
-                logs.append(log)
-            }
-        } catch {
+    func loadLogs() {
+        guard let logsStore else { return }
 
+        logs.insert(contentsOf: logsStore.load(), at: 0)
+        if logs.count > MAX_LOGS {
+            removeFirst(logs.count - KEEP)
+        }
+
+        // loadLogs can run more than once, e.g. from tests; observe the lifecycle only once
+        guard lifecycleObservers.isEmpty else { return }
+        lifecycleObservers = [UIApplication.didEnterBackgroundNotification, UIApplication.willTerminateNotification].map { name in
+            NotificationCenter.default.addObserver(forName: name, object: nil, queue: nil) { [weak self] _ in
+                Task { await self?.commitPendingLogs() }
+            }
         }
     }
 
     func log(_ log: RadarLog) {
-        logs.append(log)
+        self.log(contentsOf: [log])
+    }
+
+    /// Appends a batch of logs. With log persistence on they are buffered for the logs store,
+    /// which commits them together once enough are pending or after `COMMIT_DELAY`.
+    func log(contentsOf newLogs: [RadarLog]) {
+        guard !newLogs.isEmpty else { return }
+        logs.append(contentsOf: newLogs)
 
         if logs.count > MAX_LOGS {
-            logs.removeFirst(logs.count - KEEP)
-            // write the current logs list to file
-            if useLogPersistence, let logsFile {
-                logsFile.write(data: Data())
-                for log in logs {
-                    if let data = try? JSONEncoder().encode(log) {
-                        logsFile.append(data: data + NEW_LINE)
-                    }
-                }
-            }
-        } else {
-            if useLogPersistence, let logsFile {
-                if let data = try? JSONEncoder().encode(log) {
-                    logsFile.append(data: data + NEW_LINE)
-                }
-            }
+            removeFirst(logs.count - KEEP)
+        }
+
+        guard useLogPersistence, let logsStore else { return }
+        logsStore.append(newLogs)
+        // keep at least the logs still in memory on disk
+        logsStore.trim(keep: logs.count)
+        scheduleCommit()
+    }
+
+    /// Writes logs still waiting for the commit timer to disk.
+    func commitPendingLogs() {
+        commitScheduled = false
+        logsStore?.commit()
+    }
+
+    private func scheduleCommit() {
+        guard !commitScheduled, logsStore?.hasPending == true else { return }
+        commitScheduled = true
+        Task { [weak self, COMMIT_DELAY] in
+            try? await Task.sleep(nanoseconds: COMMIT_DELAY)
+            await self?.commitPendingLogs()
         }
     }
 
+    private func removeFirst(_ count: Int) {
+        logs.removeFirst(count)
+        removedCount += count
+    }
+
+    /// Uploads the logs buffered when it is called in chunks of `CHUNK_SIZE`, oldest first,
+    /// removing each chunk once the server acknowledges it. Stops at the first failure, keeping
+    /// the logs not yet sent. Logs added during the upload, including the ones the upload
+    /// itself logs, wait for the next flush.
     func flush() async {
-        do {
-            try await apiClient.sendLogs(logs: logs)
-            logs = []
-            if useLogPersistence, let logsFile {
-                logsFile.write(data: Data())
+        guard !flushing else { return }
+        flushing = true
+        defer { flushing = false }
+
+        let end = removedCount + logs.count
+        while removedCount < end && !logs.isEmpty {
+            let chunk = Array(logs.prefix(min(CHUNK_SIZE, end - removedCount)))
+            let chunkStart = removedCount
+            do {
+                try await apiClient.sendLogs(logs: chunk)
+            } catch {
+                // failed to flush logs, keep the rest of the buffer
+                break
+            }
+            // logs may have been trimmed while the chunk was in flight
+            removeFirst(max(0, min(chunkStart + chunk.count - removedCount, logs.count)))
+
+            // the store records how far it was acknowledged, so sent logs aren't loaded again
+            if useLogPersistence, let logsStore {
+                if logs.isEmpty {
+                    logsStore.removeAll()
+                } else {
+                    logsStore.trim(keep: logs.count)
+                }
             }
-        } catch {
-            // failed to flush logs, keep existing buffer
         }
     }
 }
@@ -0,0 +1,107 @@
+//
+//  RadarLogQueue.swift
+//  RadarSDK
+//
+//  Copyright © 2026 Radar Labs, Inc. All rights reserved.
+//
+
+import Foundation
+
+/// Bounded multi-producer, single-consumer queue between the threads that log and the
+/// `RadarLogger` drainer that delivers logs in batches.
+///
+/// Producers write into a preallocated ring under a short lock and never suspend. When the
+/// ring is full the oldest pending log is dropped to make room; drops are counted and
+/// reported with the next drained batch.
+final class RadarLogQueue: @unchecked Sendable {
+
+    struct Entry {
+        let level: RadarLogLevel
+        let message: String
+        let type: RadarLogType
+        let createdAt: Date
+        let includeDate: Bool
+        let includeBattery: Bool
+    }
+
+    struct Stats: Equatable {
+        /// Logs accepted by `enqueue(_:)`, including ones later dropped.
+        var enqueued = 0
+        /// Pending logs overwritten because the ring was full.
+        var dropped = 0
+        /// Batches handed to the drainer.
+        var batches = 0
+    }
+
+    let capacity: Int
+
+    private let lock = NSLock()
+    private var slots: ContiguousArray<Entry?>
+    private var head = 0
+    private var count = 0
+    private var droppedSinceDrain = 0
+    private var drainScheduled = false
+    private var counters = Stats()
+
+    init(capacity: Int) {
+        self.capacity = max(capacity, 1)
+        self.slots = ContiguousArray(repeating: nil, count: self.capacity)
+    }
+
+    var stats: Stats {
+        lock.lock()
+        defer { lock.unlock() }
+        return counters
+    }
+
+    /// Adds a log, dropping the oldest pending one if the ring is full. Returns true when the
+    /// caller should schedule a drain, which happens once per batch rather than per log.
+    func enqueue(_ entry: Entry) -> Bool {
+        lock.lock()
+        defer { lock.unlock() }
+
+        if count == capacity {
+            slots[head] = nil
+            head = (head + 1) % capacity
+            count -= 1
+            droppedSinceDrain += 1
+            counters.dropped += 1
+        }
+        slots[(head + count) % capacity] = entry
+        count += 1
+        counters.enqueued += 1
+
+        if drainScheduled {
+            return false
+        }
+        drainScheduled = true
+        return true
+    }
+
+    /// Removes every pending log, oldest first, along with the number dropped since the
+    /// previous drain. Logs enqueued after this schedule a new drain.
+    func drain() -> (entries: [Entry], dropped: Int) {
+        lock.lock()
+        defer { lock.unlock() }
+
+        var entries = [Entry]()
+        entries.reserveCapacity(count)
+        for offset in 0..<count {
+            let index = (head + offset) % capacity
+            if let entry = slots[index] {
+                entries.append(entry)
+            }
+            slots[index] = nil
+        }
+        head = 0
+        count = 0
+        drainScheduled = false
+
+        let dropped = droppedSinceDrain
+        droppedSinceDrain = 0
+        if !entries.isEmpty || dropped > 0 {
+            counters.batches += 1
+        }
+        return (entries, dropped)
+    }
+}
@@ -0,0 +1,211 @@
+//
+//  RadarLogSegments.swift
+//  RadarSDK
+//
+//  Copyright © 2026 Radar Labs, Inc. All rights reserved.
+//
+
+import Foundation
+
+/// Segmented on-disk log backing `RadarLogBuffer` when log persistence is on.
+///
+/// Logs are stored one JSON record per line across numbered segment files in a
+/// `<name>.segments` directory, each holding at most `segmentCapacity` records. Appends are
+/// buffered and committed to the newest segment with a single write once `commitBytes` are
+/// pending or when the owner calls `commit()`. Trimming deletes whole segments from the
+/// front and records how far into the oldest remaining segment the logs were dropped in a
+/// small `head` file, so it never rewrites the logs that are kept and dropped logs are not
+/// loaded again.
+final class RadarLogSegments {
+
+    struct Segment {
+        let id: Int
+        var count: Int
+    }
+
+    let segmentCapacity: Int
+    let commitBytes: Int
+    let directory: URL
+
+    private let directoryName: String
+    private let legacyFile: URL
+    private let headFile: URL
+    private(set) var segments = [Segment]()
+    // records at the front of the oldest segment that were trimmed or acknowledged
+    private(set) var headOffset = 0
+    private var current: RadarFileStorage?
+    private var pending = Data()
+    private var scanned = false
+    // records found on disk by the first scan, handed out once by `load()`
+    private var recovered = [RadarLog]()
+
+    private let encoder = JSONEncoder()
+    private let decoder = JSONDecoder()
+
+    private static let newLine = UInt8(ascii: "\n")
+
+    init?(name: String, segmentCapacity: Int, commitBytes: Int = 16 * 1024) {
+        guard let documents = FileManager.default.urls(for: .applicationSupportDirectory, in: .userDomainMask).first else {
+            // failed to find directory
+            return nil
+        }
+        let root = documents.appendingPathComponent("RadarSDK", isDirectory: true)
+        let directoryName = "\(name).segments"
+        self.directoryName = directoryName
+        self.legacyFile = root.appendingPathComponent(name, isDirectory: false)
+        self.directory = root.appendingPathComponent(directoryName, isDirectory: true)
+        self.headFile = directory.appendingPathComponent("head", isDirectory: false)
+        self.segmentCapacity = max(segmentCapacity, 1)
+        self.commitBytes = commitBytes
+    }
+
+    /// Records on disk, committed or not.
+    var recordCount: Int {
+        segments.reduce(0) { $0 + $1.count } - headOffset
+    }
+
+    var hasPending: Bool {
+        !pending.isEmpty
+    }
+
+    // MARK: - Reading
+
+    /// Logs persisted before this instance first touched the directory, oldest first. Returns
+    /// them once; later calls return an empty array.
+    func load() -> [RadarLog] {
+        scanIfNeeded()
+        let logs = recovered
+        recovered = []
+        return logs
+    }
+
+    private func scanIfNeeded() {
+        guard !scanned else { return }
+        scanned = true
+
+        let names = (try? FileManager.default.contentsOfDirectory(atPath: directory.path)) ?? []
+        let ids = names.compactMap { name -> Int? in
+            guard name.hasSuffix(".log") else { return nil }
+            return Int(name.dropLast(4))
+        }.sorted()
+
+        let head = readHead()
+        for id in ids {
+            // segments before the head were dropped, but not deleted before the app exited
+            if let head, id < head.id {
+                try? FileManager.default.removeItem(at: segmentURL(id))
+                continue
+            }
+            let logs = decodeLines(try? Data(contentsOf: segmentURL(id)))
+            if segments.isEmpty, let head, head.id == id {
+                headOffset = min(head.offset, logs.count)
+            }
+            recovered.append(contentsOf: segments.isEmpty ? logs.dropFirst(headOffset) : logs[...])
+            segments.append(Segment(id: id, count: logs.count))
+        }
+        current = segments.last.flatMap { openSegment($0.id) }
+
+        // logs written before segmenting were a single JSON lines file; move them over
+        if FileManager.default.fileExists(atPath: legacyFile.path) {
+            let logs = decodeLines(try? Data(contentsOf: legacyFile))
+            try? FileManager.default.removeItem(at: legacyFile)
+            append(logs)
+            commit()
+            recovered.append(contentsOf: logs)
+        }
+    }
+
+    private func decodeLines(_ data: Data?) -> [RadarLog] {
+        guard let data else { return [] }
+        return data.split(separator: Self.newLine).compactMap { try? decoder.decode(RadarLog.self, from: $0) }
+    }
+
+    // MARK: - Writing
+
+    /// Buffers `logs` for the newest segment, starting new segments as they fill. Commits once
+    /// `commitBytes` are pending.
+    func append(_ logs: [RadarLog]) {
+        scanIfNeeded()
+        for log in logs {
+            guard let encoded = try? encoder.encode(log) else { continue }
+            if segments.last.map({ $0.count >= segmentCapacity }) ?? true {
+                startSegment()
+            }
+            pending.append(encoded)
+            pending.append(Self.newLine)
+            segments[segments.count - 1].count += 1
+        }
+        if pending.count >= commitBytes {
+            commit()
+        }
+    }
+
+    /// Writes pending records to the newest segment.
+    func commit() {
+        guard !pending.isEmpty else { return }
+        current?.append(data: pending)
+        pending.removeAll(keepingCapacity: true)
+    }
+
+    /// Drops the oldest records until `keep` remain, e.g. once the server acknowledged them.
+    /// Segments left with no records are deleted; the rest of the drop is recorded in the
+    /// head file, so the dropped records are skipped on the next load.
+    func trim(keep: Int) {
+        var drop = recordCount - max(keep, 0)
+        guard drop > 0 else { return }
+
+        while drop > 0, let first = segments.first {
+            let available = first.count - headOffset
+            if drop >= available && segments.count > 1 {
+                try? FileManager.default.removeItem(at: segmentURL(first.id))
+                segments.removeFirst()
+                headOffset = 0
+                drop -= available
+            } else {
+                headOffset += min(drop, available)
+                drop = 0
+            }
+        }
+        writeHead()
+    }
+
+    func removeAll() {
+        scanIfNeeded()
+        recovered = []
+        pending.removeAll()
+        segments.removeAll()
+        headOffset = 0
+        current = nil
+        try? FileManager.default.removeItem(at: directory)
+    }
+
+    private func startSegment() {
+        commit()
+        let id = (segments.last?.id ?? -1) + 1
+        segments.append(Segment(id: id, count: 0))
+        current = openSegment(id)
+    }
+
+    private func readHead() -> (id: Int, offset: Int)? {
+        guard let data = try? Data(contentsOf: headFile), let string = String(data: data, encoding: .utf8) else { return nil }
+        let parts = string.split(separator: " ").compactMap { Int($0) }
+        guard parts.count == 2 else { return nil }
+        return (parts[0], parts[1])
+    }
+
+    private func writeHead() {
+        guard let first = segments.first else {
+            try? FileManager.default.removeItem(at: headFile)
+            return
+        }
+        try? Data("\(first.id) \(headOffset)".utf8).write(to: headFile, options: .atomic)
+    }
+
+    private func openSegment(_ id: Int) -> RadarFileStorage? {
+        RadarFileStorage(fileName: "\(directoryName)/\(id).log")
+    }
+
+    func segmentURL(_ id: Int) -> URL {
+        directory.appendingPathComponent("\(id).log", isDirectory: false)
+    }
+}
@@ -17,7 +17,10 @@ NS_ASSUME_NONNULL_BEGIN
 @property (strong, nonatomic) UIDevice *device;
 
 + (instancetype)sharedInstance;
+- (BOOL)isLoggable:(RadarLogLevel)level;
 - (void)logWithLevel:(RadarLogLevel)level message:(NSString *)message;
+// messageBlock is only called when level is enabled, use it when building the message is expensive
+- (void)logWithLevel:(RadarLogLevel)level messageBlock:(NSString * (^NS_NOESCAPE)(void))messageBlock;
 - (void)logWithLevel:(RadarLogLevel)level type:(RadarLogType)type message:(NSString *)message;
 - (void)logWithLevel:(RadarLogLevel)level type:(RadarLogType)type message:(NSString *)message includeDate:(BOOL)includeDate includeBattery:(BOOL)includeBattery;
 - (void)logWithLevel:(RadarLogLevel)level type:(RadarLogType)type message:(NSString *)message includeDate:(BOOL)includeDate includeBattery:(BOOL)includeBattery append:(BOOL)append;
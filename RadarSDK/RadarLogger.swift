@@ -26,13 +26,44 @@ final class RadarLogger: NSObject, @unchecked Sendable {
         logLevelOverride ?? RadarSettings.logLevel
     }
 
-    // Test-only bookkeeping: each `log(...)` call spawns a detached Task that delivers the
-    // message to the delegate asynchronously. Tests need to deterministically await that
-    // delivery instead of racing a wall-clock timeout (which is flaky under CI load). When
-    // `logLevelOverride` is set (test mode) we retain the in-flight tasks so `awaitPendingLogs()`
-    // can await them. In production `logLevelOverride` is nil, so this stays a no-op.
-    private let pendingLogTasksLock = NSLock()
-    private var pendingLogTasks = [Task<Void, Never>]()
+    // logs are handed to a single drainer instead of spawning a task per message
+    private let queue: RadarLogQueue
+    private let drainQueue = DispatchQueue(label: "io.radar.logger", qos: .utility)
+
+    enum Batch: Sendable {
+        case logs([RadarLogQueue.Entry], dropped: Int)
+        // resumed once every batch before it has been delivered
+        case barrier(CheckedContinuation<Void, Never>)
+    }
+
+    // batches are delivered in order by one long-lived consumer
+    private let batches: AsyncStream<Batch>.Continuation
+
+    init(queueCapacity: Int) {
+        self.queue = RadarLogQueue(capacity: queueCapacity)
+        let (stream, batches) = AsyncStream<Batch>.makeStream()
+        self.batches = batches
+        super.init()
+
+        Task.detached(priority: .utility) { [weak self] in
+            for await batch in stream {
+                await self?.deliver(batch)
+            }
+        }
+    }
+
+    override convenience init() {
+        self.init(queueCapacity: 1024)
+    }
+
+    deinit {
+        batches.finish()
+    }
+
+    /// Logs queued, dropped on overflow and drained in batches by this logger.
+    var queueStats: RadarLogQueue.Stats {
+        queue.stats
+    }
 
     @MainActor
     let device = {
@@ -52,72 +83,109 @@ final class RadarLogger: NSObject, @unchecked Sendable {
     @available(iOS 14.0, *)
     static let logger = Logger(subsystem: Bundle.main.bundleIdentifier ?? "RadarSDK", category: "RadarSDK")
 
-    func debug(_ message: String, type: RadarLogType = .none, includeDate: Bool = false, includeBattery: Bool = false, append: Bool = false) {
-        log(level: .debug, message: message, type: type, includeDate: includeDate, includeBattery: includeBattery, append: append)
+    // messages are autoclosures, only evaluated when their level is enabled
+    func debug(_ message: @autoclosure () -> String, type: RadarLogType = .none, includeDate: Bool = false, includeBattery: Bool = false, append: Bool = false) {
+        guard isLoggable(.debug) else { return }
+        log(level: .debug, message: message(), type: type, includeDate: includeDate, includeBattery: includeBattery, append: append)
     }
 
-    func info(_ message: String, type: RadarLogType = .none, includeDate: Bool = false, includeBattery: Bool = false, append: Bool = false) {
-        log(level: .info, message: message, type: type, includeDate: includeDate, includeBattery: includeBattery, append: append)
+    func info(_ message: @autoclosure () -> String, type: RadarLogType = .none, includeDate: Bool = false, includeBattery: Bool = false, append: Bool = false) {
+        guard isLoggable(.info) else { return }
+        log(level: .info, message: message(), type: type, includeDate: includeDate, includeBattery: includeBattery, append: append)
     }
 
-    func warning(_ message: String, type: RadarLogType = .none, includeDate: Bool = false, includeBattery: Bool = false, append: Bool = false) {
-        log(level: .warning, message: message, type: type, includeDate: includeDate, includeBattery: includeBattery, append: append)
+    func warning(_ message: @autoclosure () -> String, type: RadarLogType = .none, includeDate: Bool = false, includeBattery: Bool = false, append: Bool = false) {
+        guard isLoggable(.warning) else { return }
+        log(level: .warning, message: message(), type: type, includeDate: includeDate, includeBattery: includeBattery, append: append)
     }
 
-    func error(_ message: String, type: RadarLogType = .none, includeDate: Bool = false, includeBattery: Bool = false, append: Bool = false) {
-        log(level: .error, message: message, type: type, includeDate: includeDate, includeBattery: includeBattery, append: append)
+    func error(_ message: @autoclosure () -> String, type: RadarLogType = .none, includeDate: Bool = false, includeBattery: Bool = false, append: Bool = false) {
+        guard isLoggable(.error) else { return }
+        log(level: .error, message: message(), type: type, includeDate: includeDate, includeBattery: includeBattery, append: append)
+    }
+
+    /// Whether a message at `level` would be logged, so callers can skip building it.
+    @objc(isLoggable:)
+    func isLoggable(_ level: RadarLogLevel) -> Bool {
+        level.rawValue <= logLevel.rawValue
     }
 
     func log(level: RadarLogLevel, message: String, type: RadarLogType = .none, includeDate: Bool = false, includeBattery: Bool = false, append: Bool = false) {
-        if level.rawValue > logLevel.rawValue {
+        guard isLoggable(level) else {
+            return
+        }
+
+        let entry = RadarLogQueue.Entry(level: level, message: message, type: type, createdAt: Date(), includeDate: includeDate, includeBattery: includeBattery)
+        if queue.enqueue(entry) {
+            drainQueue.async {
+                self.drain()
+            }
+        }
+    }
+
+    /// Hands everything queued so far to the consumer as one batch.
+    private func drain() {
+        let (entries, dropped) = queue.drain()
+        if entries.isEmpty && dropped == 0 {
             return
         }
+        batches.yield(.logs(entries, dropped: dropped))
+    }
 
-        let task = Task {
-            let log = RadarLog(level: level, message: message, type: type, createdAt: Date(), includeDate: includeDate, battery: includeBattery ? await self.device.batteryLevel : nil)
+    /// Delivers a batch: the battery level and background time are read with one async hop
+    /// each, then the batch is written to `RadarLogBuffer` and sent to the console and delegate.
+    private func deliver(_ batch: Batch) async {
+        guard case let .logs(entries, dropped) = batch else {
+            if case let .barrier(continuation) = batch {
+                continuation.resume()
+            }
+            return
+        }
 
-            await RadarLogBuffer.shared.log(log)
+        let battery: Float? = entries.contains { $0.includeBattery } ? await MainActor.run { self.device.batteryLevel } : nil
+        let backgroundTime = await RadarUtils.backgroundTimeRemaining
 
-            let backgroundTime = await RadarUtils.backgroundTimeRemaining
-            let logMessage = "\(log) | backgroundTimeRemaining = \(backgroundTime)"
+        var logs = [RadarLog]()
+        logs.reserveCapacity(entries.count + 1)
+        if dropped > 0 {
+            logs.append(RadarLog(level: .warning, message: "Dropped \(dropped) logs | log queue full", type: .sdkError, createdAt: Date(), includeDate: false, battery: nil))
+        }
+        for entry in entries {
+            logs.append(
+                RadarLog(
+                    level: entry.level, message: entry.message, type: entry.type, createdAt: entry.createdAt, includeDate: entry.includeDate,
+                    battery: entry.includeBattery ? battery : nil
+                ))
+        }
+
+        await RadarLogBuffer.shared.log(contentsOf: logs)
 
-            if #available(iOS 14.0, *),
-                logLevelOverride == nil
-            {  // if logLevelOverride != nil, we are in test mode, don't output to console
+        let logMessages = logs.map { "\($0) | backgroundTimeRemaining = \(backgroundTime)" }
+        if #available(iOS 14.0, *),
+            logLevelOverride == nil
+        {  // if logLevelOverride != nil, we are in test mode, don't output to console
+            for logMessage in logMessages {
                 RadarLogger.logger.log("\(logMessage)")
             }
-            await MainActor.run {
+        }
+        await MainActor.run {
+            for logMessage in logMessages {
                 self.delegate?.didLog?(message: logMessage)
             }
         }
-
-        // Only retain tasks in test mode to keep production allocation-free.
-        if logLevelOverride != nil {
-            pendingLogTasksLock.lock()
-            pendingLogTasks.append(task)
-            pendingLogTasksLock.unlock()
-        }
     }
 
-    /// Test hook: awaits every log task spawned so far, guaranteeing their delegate
-    /// callbacks have run. Lets tests assert on delivered messages deterministically
-    /// instead of polling against a wall-clock timeout.
+    /// Test hook: drains the queue and waits until the delegate has been sent every message
+    /// logged so far, so tests can assert on delivered messages deterministically.
     func awaitPendingLogs() async {
-        // Drain under the lock in a synchronous helper so the lock is never held across an
-        // `await` (NSLock.lock/unlock are unavailable from async contexts).
-        for task in drainPendingLogTasks() {
-            await task.value
+        await withCheckedContinuation { (continuation: CheckedContinuation<Void, Never>) in
+            drainQueue.async {
+                self.drain()
+                self.batches.yield(.barrier(continuation))
+            }
         }
     }
 
-    private func drainPendingLogTasks() -> [Task<Void, Never>] {
-        pendingLogTasksLock.lock()
-        defer { pendingLogTasksLock.unlock() }
-        let tasks = pendingLogTasks
-        pendingLogTasks.removeAll()
-        return tasks
-    }
-
     // ObjC interface, which will be deprecated
     @objc
     func log(level: RadarLogLevel, message: String) {
@@ -136,6 +204,13 @@ final class RadarLogger: NSObject, @unchecked Sendable {
     func log(level: RadarLogLevel, type: RadarLogType, message: String, includeDate: Bool, includeBattery: Bool, append: Bool) {
         log(level: level, message: message, type: type, includeDate: includeDate, includeBattery: includeBattery, append: append)
     }
+    /// Calls `messageBlock` only when `level` is enabled, for callers whose message formatting
+    /// is expensive.
+    @objc(logWithLevel:messageBlock:)
+    func log(level: RadarLogLevel, messageBlock: () -> String) {
+        guard isLoggable(level) else { return }
+        log(level: level, message: messageBlock())
+    }
     // ObjC interface from RadarLog.h consolidated into [RadarLogger ...] replaceing [RadarLog ...]
     @objc
     static func levelFromString(_ string: String) -> RadarLogLevel {
@@ -159,13 +234,13 @@ final class RadarLogger: NSObject, @unchecked Sendable {
             await RadarLogBuffer.shared.log(log)
         }
     }
-    static func debug(_ message: String, type: RadarLogType = .none) {
-        RadarLogger.shared.debug(message, type: type)
+    static func debug(_ message: @autoclosure () -> String, type: RadarLogType = .none) {
+        RadarLogger.shared.debug(message(), type: type)
     }
-    static func info(_ message: String, type: RadarLogType = .none) {
-        RadarLogger.shared.info(message, type: type)
+    static func info(_ message: @autoclosure () -> String, type: RadarLogType = .none) {
+        RadarLogger.shared.info(message(), type: type)
     }
-    static func warning(_ message: String, type: RadarLogType = .none) {
-        RadarLogger.shared.warning(message, type: type)
+    static func warning(_ message: @autoclosure () -> String, type: RadarLogType = .none) {
+        RadarLogger.shared.warning(message(), type: type)
     }
 }
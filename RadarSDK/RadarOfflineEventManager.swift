@@ -43,9 +43,10 @@ class RadarOfflineEventManager: NSObject {
         let effectiveGeofenceIds = offlineGeofenceIds ?? Set(state.lastSyncedGeofenceIds)
         let effectiveBeaconIds = offlineBeaconIds ?? Set(state.lastSyncedBeaconIds)
 
-        let geofenceEntries = RadarSyncManager.getGeofenceEntries(for: location, against: effectiveGeofenceIds)
-        let geofenceExits = RadarSyncManager.getGeofenceExits(for: location, against: effectiveGeofenceIds)
-        let geofenceDwells = RadarSyncManager.getGeofenceDwells(for: location, against: effectiveGeofenceIds)
+        let evaluation = RadarSyncManager.evaluateGeofences(for: location, against: effectiveGeofenceIds, state: state)
+        let geofenceEntries = evaluation.entered
+        let geofenceExits = evaluation.exited
+        let geofenceDwells = evaluation.dwells
 
         let beaconEntries =
             beaconsEnabled
@@ -57,7 +58,7 @@ class RadarOfflineEventManager: NSObject {
             : []
 
         let now = Date()
-        let isoString = RadarUtils.isoDateFormatter.string(from: now)
+        let isoString = RadarISO8601.string(from: now)
         let isLive = (RadarSettings.publishableKey ?? "").hasPrefix("prj_live")
 
         let dwellDurations = state.geofenceEntryTimestamps.mapValues { now.timeIntervalSince1970 - $0 }
@@ -83,7 +84,7 @@ class RadarOfflineEventManager: NSObject {
             RadarSyncManager.markDwellFired(geofence.id)
         }
 
-        let currentGeofences = RadarSyncManager.getGeofences(for: location)
+        let currentGeofences = evaluation.insideEntry
         let currentBeacons = beaconsEnabled ? RadarSyncManager.getBeacons(for: location) : []
         offlineGeofenceIds = Set(currentGeofences.map { $0.id })
 
@@ -168,6 +169,8 @@ class RadarOfflineEventManager: NSObject {
 
     // MARK: - Tracking options ramp-up/down
 
+    // RadarRemoteTrackingOptions hands out copies, so setting the type below doesn't change
+    // the cached sdkConfiguration.
     static func updateTrackingOptions(geofenceTags: [String]) -> RadarTrackingOptions? {
         let sdkConfig = RadarSettings.sdkConfiguration
         let remoteOptions = sdkConfig?.remoteTrackingOptions
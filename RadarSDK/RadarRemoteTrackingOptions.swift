@@ -12,8 +12,13 @@ import Foundation
 class RadarRemoteTrackingOptions: NSObject {
 
     let type: String
-    let trackingOptions: RadarTrackingOptions
     let geofenceTags: [String]?
+    // configurations are cached and shared, so the options are handed out as copies
+    private let storedTrackingOptions: RadarTrackingOptions
+
+    var trackingOptions: RadarTrackingOptions {
+        storedTrackingOptions.copy() as! RadarTrackingOptions
+    }
 
     init?(dict: [String: Any]) {
         guard let type = dict["type"] as? String,
@@ -23,14 +28,14 @@ class RadarRemoteTrackingOptions: NSObject {
             return nil
         }
         self.type = type
-        self.trackingOptions = trackingOptions
+        self.storedTrackingOptions = trackingOptions
         self.geofenceTags = dict["geofenceTags"] as? [String]
     }
 
     func dictionaryValue() -> [String: Any] {
         var dict: [String: Any] = [
             "type": type,
-            "trackingOptions": trackingOptions.dictionaryValue(),
+            "trackingOptions": storedTrackingOptions.dictionaryValue(),
         ]
         if let geofenceTags = geofenceTags {
             dict["geofenceTags"] = geofenceTags
@@ -5,6 +5,7 @@
 //  Copyright © 2023 Radar Labs, Inc. All rights reserved.
 //
 
+#import <CoreLocation/CoreLocation.h>
 #import <Foundation/Foundation.h>
 #import "Radar.h"
 @class RadarReplay;
@@ -42,6 +43,11 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (void)flushBatch;
 
+// marks a fix as changing geofence or place state, so an adaptive batch is flushed when it is added
+- (void)markBatchEventForLocation:(CLLocation *)location;
+
+- (BOOL)consumeBatchEventForLocation:(CLLocation *)location;
+
 - (NSUInteger)batchCount;
 
 @end
@@ -6,58 +6,63 @@
 //  Copyright © 2026 Radar Labs, Inc. All rights reserved.
 //
 
+import CoreLocation
 import Foundation
 
 @objc(RadarReplayBuffer)
 final class RadarReplayBuffer: NSObject, @unchecked Sendable {
 
     private static let maxBufferSize = 120  // one hour of updates
-    private static let storageKey = "radar-replays"
+    // replays used to be archived into UserDefaults under this key, migrated to `log` on load
+    private static let legacyStorageKey = "radar-replays"
 
-    var mutableReplayBuffer: [RadarReplay] = []
+    private var ring = RadarReplayRing(capacity: RadarReplayBuffer.maxBufferSize)
+    private let log = RadarReplayLog(capacity: RadarReplayBuffer.maxBufferSize)
     private var isFlushing = false
     private var batchFlushTimer: Timer?
+    private var currentBatchLimits = RadarAdaptiveBatchPolicy.Limits(size: 0, interval: 0)
+    let adaptiveBatch = RadarAdaptiveBatchPolicy()
 
     @objc(sharedInstance)
     static let sharedInstance = RadarReplayBuffer()
 
     private override init() {
         super.init()
+        // continue numbering after any replays already on disk
+        ring = RadarReplayRing(capacity: Self.maxBufferSize, nextSequence: log.loadTail())
+    }
+
+    /// In-memory replays, oldest first. Assigning replaces the in-memory buffer only; the
+    /// persisted log is left as is.
+    var mutableReplayBuffer: [RadarReplay] {
+        get { ring.replays }
+        set {
+            ring.removeAll()
+            for replay in newValue.suffix(Self.maxBufferSize) {
+                ring.append(replay)
+            }
+        }
     }
 
     @objc
     var flushableReplays: [RadarReplay] {
-        return mutableReplayBuffer
+        return ring.replays
     }
 
     @objc(writeNewReplayToBuffer:)
     func writeNewReplayToBuffer(_ replayParams: [AnyHashable: Any]) {
-        if mutableReplayBuffer.count >= Self.maxBufferSize {
-            dropOldestReplay()
-        }
-
-        let radarReplay = RadarReplay(params: replayParams)
-        mutableReplayBuffer.append(radarReplay)
+        // a full ring drops its oldest replay; the log needs no write for that since loading
+        // only keeps the newest maxBufferSize records
+        let replay = RadarReplay(params: replayParams)
+        let sequence = ring.append(replay)
 
         guard let sdkConfiguration = RadarSettings.sdkConfiguration, sdkConfiguration.usePersistence else {
             return
         }
 
-        // if buffer length is above 50, remove every fifth replay from the persisted buffer
-        let bufferToPersist: [RadarReplay]
-        if mutableReplayBuffer.count > 50 {
-            bufferToPersist = mutableReplayBuffer.enumerated()
-                .filter { ($0.offset + 1) % 5 != 0 }
-                .map { $0.element }
-        } else {
-            bufferToPersist = mutableReplayBuffer
-        }
-
-        do {
-            let replaysData = try NSKeyedArchiver.archivedData(withRootObject: bufferToPersist, requiringSecureCoding: true)
-            UserDefaults.standard.set(replaysData, forKey: Self.storageKey)
-        } catch {
-            RadarLogger.shared.debug("Error archiving replays")
+        log.append(RadarReplayRing.Entry(sequence: sequence, replay: replay))
+        if log.needsCompaction {
+            log.compact(ring.entries, tail: ring.nextSequence)
         }
     }
 
@@ -72,6 +77,7 @@ final class RadarReplayBuffer: NSObject, @unchecked Sendable {
         isFlushing = true
 
         let replaysArray = flushableReplays
+        let flushedThrough = ring.last?.sequence
         if replaysArray.isEmpty && replayParams == nil {
             RadarLogger.shared.debug("No replays to flush")
             isFlushing = false
@@ -104,7 +110,9 @@ final class RadarReplayBuffer: NSObject, @unchecked Sendable {
         bridge.flushReplaysRequest(replaysRequestArray) { [self] status, res in
             if status == .success {
                 RadarLogger.shared.debug("Flushed replays successfully")
-                removeReplaysFromBuffer(replaysArray)
+                if let flushedThrough {
+                    removeReplays(through: flushedThrough)
+                }
                 RadarLogger.flushLogs()
             } else if replayParams != nil, let newReplayParams = newReplayParams {
                 writeNewReplayToBuffer(newReplayParams)
@@ -122,44 +130,58 @@ final class RadarReplayBuffer: NSObject, @unchecked Sendable {
 
     @objc
     func clearBuffer() {
-        mutableReplayBuffer.removeAll()
-        UserDefaults.standard.removeObject(forKey: Self.storageKey)
+        ring.removeAll()
+        log.clear(tail: ring.nextSequence)
+        UserDefaults.standard.removeObject(forKey: Self.legacyStorageKey)
     }
 
-    private func removeReplaysFromBuffer(_ replays: [RadarReplay]) {
-        mutableReplayBuffer.removeAll { replay in replays.contains { $0.isEqual(replay) } }
-
-        do {
-            let replaysData = try NSKeyedArchiver.archivedData(withRootObject: mutableReplayBuffer, requiringSecureCoding: true)
-            UserDefaults.standard.set(replaysData, forKey: Self.storageKey)
-        } catch {
-            RadarLogger.shared.debug("Error archiving replays")
-        }
+    /// Removes flushed replays, which are always the oldest ones in the buffer.
+    private func removeReplays(through sequence: UInt64) {
+        ring.removeThrough(sequence: sequence)
+        log.setHead(sequence + 1, tail: ring.nextSequence)
     }
 
     @objc
     func loadReplaysFromPersistentStore() {
-        guard let replaysData = UserDefaults.standard.object(forKey: Self.storageKey) as? Data else {
+        migrateLegacyReplays()
+
+        var entries = log.load()
+        // if buffer length is above 50, remove every fifth replay from the restored buffer
+        if entries.count > 50 {
+            entries = entries.enumerated().filter { ($0.offset + 1) % 5 != 0 }.map(\.element)
+        }
+        guard !entries.isEmpty else { return }
+
+        RadarLogger.shared.debug("Loaded replays | length = \(entries.count)")
+        ring = RadarReplayRing(capacity: Self.maxBufferSize, nextSequence: max(ring.nextSequence, log.index.tail))
+        for entry in entries {
+            ring.append(entry)
+        }
+    }
+
+    /// Moves replays archived into UserDefaults by earlier SDK versions into the log.
+    private func migrateLegacyReplays() {
+        guard let replaysData = UserDefaults.standard.object(forKey: Self.legacyStorageKey) as? Data else {
             return
         }
+        UserDefaults.standard.removeObject(forKey: Self.legacyStorageKey)
 
         let allowedClasses: [AnyClass] = [NSArray.self, RadarReplay.self, NSDictionary.self, NSString.self, NSNumber.self]
-        do {
-            let replays = try NSKeyedUnarchiver.unarchivedObject(ofClasses: allowedClasses, from: replaysData) as? [RadarReplay]
-            RadarLogger.shared.debug("Loaded replays | length = \(replays?.count ?? 0)")
-            if let replays = replays {
-                mutableReplayBuffer = replays
-            }
-        } catch {
+        guard let replays = try? NSKeyedUnarchiver.unarchivedObject(ofClasses: allowedClasses, from: replaysData) as? [RadarReplay] else {
             RadarLogger.shared.debug("Error unarchiving replays")
+            return
+        }
+        var sequence = max(ring.nextSequence, log.index.tail)
+        for replay in replays {
+            log.append(RadarReplayRing.Entry(sequence: sequence, replay: replay))
+            sequence += 1
         }
     }
 
     @objc
     func dropOldestReplay() {
-        if !mutableReplayBuffer.isEmpty {
-            mutableReplayBuffer.removeFirst()
-        }
+        guard ring.dropFirst() != nil else { return }
+        log.setHead(ring.first?.sequence ?? ring.nextSequence, tail: ring.nextSequence)
     }
 
     // MARK: - Batch Methods
@@ -173,20 +195,47 @@ final class RadarReplayBuffer: NSObject, @unchecked Sendable {
 
         writeNewReplayToBuffer(batchParams)
 
-        if options.batchInterval > 0 && batchFlushTimer == nil {
+        let limits = batchLimits(for: options, foreground: params["foreground"] as? Bool ?? false)
+        currentBatchLimits = limits
+        if options.batchAdaptive {
+            // the interval moves with the network, so a pending flush is brought forward if it is now due sooner
+            if limits.interval > 0 {
+                scheduleBatchTimer(after: limits.interval, keepingSooner: true)
+            }
+        } else if options.batchInterval > 0 && batchFlushTimer == nil {
             scheduleBatchTimer(withInterval: options.batchInterval)
         }
 
-        RadarLogger.shared.debug("Added to batch | size = \(mutableReplayBuffer.count)")
+        RadarLogger.shared.debug("Added to batch | size = \(ring.count); limit = \(limits.size); interval = \(limits.interval)")
+    }
+
+    /// Size and interval batches are flushed at: the adaptive policy's with `batchAdaptive`,
+    /// otherwise the fixed ones from the options.
+    func batchLimits(for options: RadarTrackingOptions, foreground: Bool) -> RadarAdaptiveBatchPolicy.Limits {
+        if options.batchAdaptive {
+            return adaptiveBatch.limits(network: RadarUtils.networkType, foreground: foreground)
+        }
+        return RadarAdaptiveBatchPolicy.Limits(size: Int(options.batchSize), interval: TimeInterval(options.batchInterval))
+    }
+
+    @objc(markBatchEventForLocation:)
+    func markBatchEvent(for location: CLLocation) {
+        adaptiveBatch.markEvent(at: location.timestamp)
+    }
+
+    @objc(consumeBatchEventForLocation:)
+    func consumeBatchEvent(for location: CLLocation) -> Bool {
+        adaptiveBatch.consumeEvent(at: location.timestamp)
     }
 
     @objc(shouldFlushBatchWithOptions:)
     func shouldFlushBatch(withOptions options: RadarTrackingOptions) -> Bool {
-        if mutableReplayBuffer.isEmpty {
+        if ring.isEmpty {
             return false
         }
 
-        if options.batchSize > 0 && mutableReplayBuffer.count >= Int(options.batchSize) {
+        let size = options.batchAdaptive ? currentBatchLimits.size : Int(options.batchSize)
+        if size > 0 && ring.count >= size {
             RadarLogger.shared.debug("Batch size limit reached")
             return true
         }
@@ -196,15 +245,23 @@ final class RadarReplayBuffer: NSObject, @unchecked Sendable {
 
     @objc(scheduleBatchTimerWithInterval:)
     func scheduleBatchTimer(withInterval interval: Int32) {
+        scheduleBatchTimer(after: TimeInterval(interval), keepingSooner: false)
+    }
+
+    /// With `keepingSooner`, a pending timer that fires within `interval` is left alone.
+    private func scheduleBatchTimer(after interval: TimeInterval, keepingSooner: Bool) {
         DispatchQueue.main.async {
             if let timer = self.batchFlushTimer {
+                if keepingSooner && timer.fireDate <= Date(timeIntervalSinceNow: interval) {
+                    return
+                }
                 timer.invalidate()
                 self.batchFlushTimer = nil
             }
 
             RadarLogger.shared.debug("Scheduling batch timer | interval = \(interval)")
 
-            self.batchFlushTimer = Timer.scheduledTimer(withTimeInterval: TimeInterval(interval), repeats: false) { _ in
+            self.batchFlushTimer = Timer.scheduledTimer(withTimeInterval: interval, repeats: false) { _ in
                 RadarLogger.shared.debug("Batch timer fired")
                 self.batchFlushTimer = nil
                 self.flushBatch()
@@ -236,11 +293,14 @@ final class RadarReplayBuffer: NSObject, @unchecked Sendable {
             return
         }
         cancelBatchTimer()
-        flushReplays(withCompletionHandler: nil, completionHandler: nil)
+        let start = ProcessInfo.processInfo.systemUptime
+        flushReplays(withCompletionHandler: nil) { [self] status, _ in
+            adaptiveBatch.recordFlush(latency: ProcessInfo.processInfo.systemUptime - start, success: status == .success)
+        }
     }
 
     @objc
     func batchCount() -> UInt {
-        return UInt(mutableReplayBuffer.count)
+        return UInt(ring.count)
     }
 }
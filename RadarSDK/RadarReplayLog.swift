@@ -0,0 +1,164 @@
+//
+//  RadarReplayLog.swift
+//  RadarSDK
+//
+//  Copyright © 2026 Radar Labs, Inc. All rights reserved.
+//
+
+import Foundation
+
+/// Append-only on-disk log of replays backing `RadarReplayBuffer`.
+///
+/// Each record is a little-endian `UInt32` payload length, a `UInt64` sequence number and
+/// the replay params as JSON. A separate 16-byte index holds the head sequence, below which
+/// records are dead, and the next sequence to assign. Appending a replay writes one record;
+/// removals only rewrite the index. The log is compacted down to the live records once it
+/// holds `compactionFactor` times the buffer capacity.
+final class RadarReplayLog {
+
+    struct Index: Equatable {
+        var head: UInt64
+        var tail: UInt64
+    }
+
+    static let compactionFactor = 2
+
+    private let logFileName: String
+    private let indexFileName: String
+    private let capacity: Int
+    private var log: RadarFileStorage?
+    private let indexFile: RadarFileStorage?
+    private(set) var index = Index(head: 0, tail: 1)
+    private(set) var recordCount = 0
+
+    init(name: String = "radar_replays", capacity: Int) {
+        self.logFileName = "\(name).log"
+        self.indexFileName = "\(name).index"
+        self.capacity = capacity
+        self.log = RadarFileStorage(fileName: logFileName)
+        self.indexFile = RadarFileStorage(fileName: indexFileName)
+    }
+
+    // MARK: - Reading
+
+    /// Live records, oldest first: those at or above the head sequence, capped to the newest
+    /// `capacity` records since appends past capacity don't rewrite the index.
+    func load() -> [RadarReplayRing.Entry] {
+        var entries = [RadarReplayRing.Entry]()
+        scan { sequence, payload in
+            guard sequence >= index.head,
+                let params = try? JSONSerialization.jsonObject(with: payload()) as? [AnyHashable: Any]
+            else {
+                return
+            }
+            entries.append(RadarReplayRing.Entry(sequence: sequence, replay: RadarReplay(params: params)))
+        }
+        return Array(entries.suffix(capacity))
+    }
+
+    /// Next sequence number to assign, from the index and the record headers on disk.
+    func loadTail() -> UInt64 {
+        scan { _, _ in }
+        return index.tail
+    }
+
+    /// Reads the index, then walks the record headers, handing each record's sequence and a
+    /// payload accessor to `body`. A torn record ends the log, and is cut off so later appends
+    /// are framed from the last good record.
+    private func scan(_ body: (UInt64, () -> Data) -> Void) {
+        if let data = indexFile?.read(), data.count == 16 {
+            index = Index(head: Self.load(UInt64.self, from: data, at: 0), tail: Self.load(UInt64.self, from: data, at: 8))
+        }
+
+        recordCount = 0
+        let data = log?.read() ?? Data()
+        var offset = 0
+        var previous: UInt64?
+        while offset + 12 <= data.count {
+            let length = Int(Self.load(UInt32.self, from: data, at: offset))
+            let sequence = Self.load(UInt64.self, from: data, at: offset + 4)
+            let start = offset + 12
+            // a torn record from an interrupted append ends the log; sequences only grow, so
+            // one that doesn't is a header misread from the bytes of a torn record
+            guard length <= data.count - start, sequence < UInt64.max, previous.map({ sequence > $0 }) ?? true else { break }
+            offset = start + length
+            previous = sequence
+            recordCount += 1
+            index.tail = max(index.tail, sequence + 1)
+            body(sequence) { data.subdata(in: start..<(start + length)) }
+        }
+
+        if offset < data.count {
+            log?.write(data: data.prefix(offset), options: .atomic)
+            // the atomic write replaced the file, so reopen the append handle
+            log = RadarFileStorage(fileName: logFileName)
+        }
+    }
+
+    // MARK: - Writing
+
+    func append(_ entry: RadarReplayRing.Entry) {
+        guard JSONSerialization.isValidJSONObject(entry.replay.replayParams),
+            let payload = try? JSONSerialization.data(withJSONObject: entry.replay.replayParams)
+        else {
+            return
+        }
+        log?.append(data: Self.record(sequence: entry.sequence, payload: payload))
+        recordCount += 1
+        index.tail = max(index.tail, entry.sequence + 1)
+    }
+
+    /// Marks every record below `head` as removed.
+    func setHead(_ head: UInt64, tail: UInt64) {
+        index = Index(head: head, tail: max(index.tail, tail))
+        writeIndex()
+    }
+
+    /// Whether enough dead records have built up that `compact(_:tail:)` should run.
+    var needsCompaction: Bool {
+        recordCount >= capacity * Self.compactionFactor
+    }
+
+    /// Rewrites the log with only `entries`.
+    func compact(_ entries: [RadarReplayRing.Entry], tail: UInt64) {
+        var data = Data()
+        for entry in entries {
+            guard JSONSerialization.isValidJSONObject(entry.replay.replayParams),
+                let payload = try? JSONSerialization.data(withJSONObject: entry.replay.replayParams)
+            else {
+                continue
+            }
+            data.append(Self.record(sequence: entry.sequence, payload: payload))
+        }
+        log?.write(data: data, options: .atomic)
+        // the atomic write replaced the file, so reopen the append handle
+        log = RadarFileStorage(fileName: logFileName)
+        recordCount = entries.count
+        setHead(entries.first?.sequence ?? tail, tail: tail)
+    }
+
+    func clear(tail: UInt64) {
+        log?.write(data: Data())
+        recordCount = 0
+        setHead(tail, tail: tail)
+    }
+
+    private func writeIndex() {
+        var data = Data(capacity: 16)
+        withUnsafeBytes(of: index.head.littleEndian) { data.append(contentsOf: $0) }
+        withUnsafeBytes(of: index.tail.littleEndian) { data.append(contentsOf: $0) }
+        indexFile?.write(data: data, options: .atomic)
+    }
+
+    private static func record(sequence: UInt64, payload: Data) -> Data {
+        var data = Data(capacity: 12 + payload.count)
+        withUnsafeBytes(of: UInt32(payload.count).littleEndian) { data.append(contentsOf: $0) }
+        withUnsafeBytes(of: sequence.littleEndian) { data.append(contentsOf: $0) }
+        data.append(payload)
+        return data
+    }
+
+    private static func load<T: FixedWidthInteger>(_ type: T.Type, from data: Data, at offset: Int) -> T {
+        data.withUnsafeBytes { T(littleEndian: $0.loadUnaligned(fromByteOffset: offset, as: T.self)) }
+    }
+}
@@ -0,0 +1,84 @@
+//
+//  RadarReplayRing.swift
+//  RadarSDK
+//
+//  Copyright © 2026 Radar Labs, Inc. All rights reserved.
+//
+
+import Foundation
+
+/// Fixed-capacity FIFO of replays, oldest first. Every appended replay gets the next
+/// sequence number, so replays can be removed by sequence rather than by comparing params.
+struct RadarReplayRing {
+
+    struct Entry {
+        let sequence: UInt64
+        let replay: RadarReplay
+    }
+
+    let capacity: Int
+    private var slots: ContiguousArray<Entry?>
+    private var head = 0
+    private(set) var count = 0
+    private(set) var nextSequence: UInt64
+
+    init(capacity: Int, nextSequence: UInt64 = 1) {
+        self.capacity = capacity
+        self.slots = ContiguousArray(repeating: nil, count: capacity)
+        self.nextSequence = nextSequence
+    }
+
+    var isEmpty: Bool { count == 0 }
+    var isFull: Bool { count == capacity }
+
+    var first: Entry? { isEmpty ? nil : slots[head] }
+    var last: Entry? { isEmpty ? nil : slots[(head + count - 1) % capacity] }
+
+    var entries: [Entry] {
+        (0..<count).compactMap { slots[(head + $0) % capacity] }
+    }
+
+    var replays: [RadarReplay] {
+        (0..<count).compactMap { slots[(head + $0) % capacity]?.replay }
+    }
+
+    /// Appends a replay, dropping the oldest one when full. Returns the new replay's sequence.
+    @discardableResult
+    mutating func append(_ replay: RadarReplay) -> UInt64 {
+        let sequence = nextSequence
+        append(Entry(sequence: sequence, replay: replay))
+        return sequence
+    }
+
+    /// Appends an entry with an existing sequence number, e.g. one loaded from disk.
+    mutating func append(_ entry: Entry) {
+        if isFull {
+            dropFirst()
+        }
+        slots[(head + count) % capacity] = entry
+        count += 1
+        nextSequence = max(nextSequence, entry.sequence + 1)
+    }
+
+    @discardableResult
+    mutating func dropFirst() -> Entry? {
+        guard let entry = first else { return nil }
+        slots[head] = nil
+        head = (head + 1) % capacity
+        count -= 1
+        return entry
+    }
+
+    /// Removes every replay with a sequence number up to and including `sequence`. Sequences
+    /// increase from oldest to newest, so this only ever trims the front of the ring.
+    mutating func removeThrough(sequence: UInt64) {
+        while let entry = first, entry.sequence <= sequence {
+            dropFirst()
+        }
+    }
+
+    mutating func removeAll() {
+        while dropFirst() != nil {}
+        head = 0
+    }
+}
@@ -0,0 +1,35 @@
+//
+//  RadarRequestScheduler.h
+//  RadarSDK
+//
+//  Copyright © 2026 Radar Labs, Inc. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+typedef void (^RadarScheduledDelivery)(dispatch_block_t completion);
+typedef void (^RadarScheduledBlock)(NSTimeInterval queueLatency, RadarScheduledDelivery deliver);
+
+/**
+ Spaces out the start of rate-limited API requests without blocking a thread.
+
+ Scheduled blocks run in order on the scheduler's queue, each at least `spacing` seconds after the previous one started. A block scheduled after a quiet period runs right
+ away; blocks in a burst wait on a timer. Earlier requests may still be in flight when later ones start, so their responses can arrive out of order; each block hands its
+ completion to `deliver`, which runs completions on the main queue in the order the blocks were scheduled.
+ */
+@interface RadarRequestScheduler : NSObject
+
+@property (assign, atomic) NSTimeInterval spacing;
+
+- (instancetype)initWithQueue:(dispatch_queue_t)queue spacing:(NSTimeInterval)spacing;
+
+/**
+ Runs `block` on the queue once its turn comes, passing the seconds it waited. The block must call `deliver` exactly once; later completions wait for it.
+ */
+- (void)scheduleBlock:(RadarScheduledBlock)block NS_SWIFT_NAME(schedule(_:));
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,88 @@
+//
+//  RadarRequestScheduler.m
+//  RadarSDK
+//
+//  Copyright © 2026 Radar Labs, Inc. All rights reserved.
+//
+
+#import "RadarRequestScheduler.h"
+
+@interface RadarRequestScheduler ()
+
+@property (strong, nonatomic) dispatch_queue_t queue;
+@property (strong, nonatomic) NSMutableArray<dispatch_block_t> *pending;
+// system uptime before which the next block may not start
+@property (assign, nonatomic) NSTimeInterval nextStart;
+@property (assign, nonatomic) BOOL timerArmed;
+// sequence of the next scheduled block, read and written on the queue
+@property (assign, nonatomic) NSUInteger nextSequence;
+// sequence of the next completion to run, and completions that arrived ahead of it, on the main queue
+@property (assign, nonatomic) NSUInteger nextDelivery;
+@property (strong, nonatomic) NSMutableDictionary<NSNumber *, dispatch_block_t> *deliveries;
+
+@end
+
+@implementation RadarRequestScheduler
+
+- (instancetype)initWithQueue:(dispatch_queue_t)queue spacing:(NSTimeInterval)spacing {
+    self = [super init];
+    if (self) {
+        _queue = queue;
+        _spacing = spacing;
+        _pending = [NSMutableArray new];
+        _deliveries = [NSMutableDictionary new];
+    }
+    return self;
+}
+
+- (void)scheduleBlock:(RadarScheduledBlock)block {
+    NSTimeInterval scheduledAt = [NSProcessInfo processInfo].systemUptime;
+    dispatch_async(self.queue, ^{
+        NSUInteger sequence = self.nextSequence++;
+        RadarScheduledDelivery deliver = ^(dispatch_block_t completion) {
+            dispatch_async(dispatch_get_main_queue(), ^{
+                [self deliverCompletion:completion sequence:sequence];
+            });
+        };
+        [self.pending addObject:^{
+            block([NSProcessInfo processInfo].systemUptime - scheduledAt, deliver);
+        }];
+        [self drain];
+    });
+}
+
+- (void)deliverCompletion:(dispatch_block_t)completion sequence:(NSUInteger)sequence {
+    self.deliveries[@(sequence)] = completion;
+    dispatch_block_t next;
+    while ((next = self.deliveries[@(self.nextDelivery)])) {
+        [self.deliveries removeObjectForKey:@(self.nextDelivery)];
+        self.nextDelivery++;
+        next();
+    }
+}
+
+- (void)drain {
+    while (self.pending.count > 0) {
+        NSTimeInterval now = [NSProcessInfo processInfo].systemUptime;
+        if (now < self.nextStart) {
+            // one timer at a time; it drains whatever is due when it fires
+            if (!self.timerArmed) {
+                self.timerArmed = YES;
+                __weak RadarRequestScheduler *weakSelf = self;
+                dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)((self.nextStart - now) * NSEC_PER_SEC)), self.queue, ^{
+                    RadarRequestScheduler *strongSelf = weakSelf;
+                    strongSelf.timerArmed = NO;
+                    [strongSelf drain];
+                });
+            }
+            return;
+        }
+
+        dispatch_block_t block = self.pending.firstObject;
+        [self.pending removeObjectAtIndex:0];
+        self.nextStart = now + MAX(self.spacing, 0);
+        block();
+    }
+}
+
+@end
@@ -0,0 +1,17 @@
+//
+//  RadarRouteMode+Internal.h
+//  RadarSDK
+//
+//  Copyright © 2026 Radar Labs, Inc. All rights reserved.
+//
+
+#import "RadarRouteMode.h"
+#import <Foundation/Foundation.h>
+
+@class RadarEnumMapping;
+
+@interface RadarRouteModeUtils ()
+
++ (RadarEnumMapping *_Nonnull)modeMapping;
+
+@end
@@ -1,23 +1,28 @@
 // RadarRouteMode.m
 #import "RadarRouteMode.h"
+#import "RadarEnumMapping.h"
+#import "RadarRouteMode+Internal.h"
 
 @implementation RadarRouteModeUtils
 
++ (RadarEnumMapping *)modeMapping {
+    static RadarEnumMapping *mapping;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        RadarEnumMappingEntry entries[] = {
+            {RadarRouteModeFoot, @"foot"},
+            {RadarRouteModeBike, @"bike"},
+            {RadarRouteModeCar, @"car"},
+            {RadarRouteModeTruck, @"truck"},
+            {RadarRouteModeMotorbike, @"motorbike"},
+        };
+        mapping = RadarEnumMappingMake(entries);
+    });
+    return mapping;
+}
+
 + (NSString *)stringForMode:(RadarRouteMode)mode {
-    switch (mode) {
-        case RadarRouteModeFoot:
-            return @"foot";
-        case RadarRouteModeBike:
-            return @"bike";
-        case RadarRouteModeCar:
-            return @"car";
-        case RadarRouteModeTruck:
-            return @"truck";
-        case RadarRouteModeMotorbike:
-            return @"motorbike";
-        default:
-            return @"unknown";
-    }
+    return [[RadarRouteModeUtils modeMapping] stringForValue:mode] ?: @"unknown";
 }
 
 @end
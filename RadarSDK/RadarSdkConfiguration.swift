@@ -89,9 +89,9 @@ class RadarSdkConfiguration: NSObject {
 }
 
 extension RadarSdkConfiguration {
-    /// QA accessor exposed via the public ObjC header. Returns the cached
-    /// SDK configuration, or nil if none has been fetched yet.
+    /// QA accessor exposed via the public ObjC header. Returns a copy of the
+    /// cached SDK configuration, or nil if none has been fetched yet.
     @objc static func current() -> RadarSdkConfiguration? {
-        RadarSettings.sdkConfiguration
+        RadarSettings.sdkConfiguration.map { RadarSdkConfiguration(dict: $0.dictionaryValue()) }
     }
 }
@@ -47,6 +47,7 @@ NS_ASSUME_NONNULL_BEGIN
 + (void)setPreviousTrackingOptions:(RadarTrackingOptions * _Nullable)options;
 + (RadarTrackingOptions * _Nullable)remoteTrackingOptions;
 + (void)setRemoteTrackingOptions:(RadarTrackingOptions * _Nullable)options;
++ (RadarTrackingOptions *)effectiveTrackingOptions;
 + (RadarTripOptions * _Nullable)tripOptions;
 + (void)setTripOptions:(RadarTripOptions * _Nullable)options;
 + (RadarTrip * _Nullable)trip;
@@ -150,12 +150,19 @@ internal class RadarSettings: NSObject {  // swiftlint:disable:this type_body_le
         set { RadarUserDefaults.set(newValue, forKey: .tracking) }
     }
 
+    // trackingOptions, remoteTrackingOptions, tripOptions, trip and sdkConfiguration are
+    // read on every location update, so their decoded values are kept in RadarSettingsCache.
+    // The options are mutable and returned as copies of the cached value; trip and
+    // sdkConfiguration are immutable and shared.
+
     public static var trackingOptions: RadarTrackingOptions! {
         get {
-            if let optionsDict = RadarUserDefaults.dictionary(forKey: .trackingOptions) {
-                return RadarTrackingOptions(from: optionsDict) ?? .presetEfficient
+            RadarSettingsCache.shared.copy(forKey: .trackingOptions) { () -> RadarTrackingOptions? in
+                if let optionsDict = RadarUserDefaults.dictionary(forKey: .trackingOptions) {
+                    return RadarTrackingOptions(from: optionsDict) ?? .presetEfficient
+                }
+                return .presetEfficient
             }
-            return .presetEfficient
         }
         set {
             RadarUserDefaults.set(newValue?.dictionaryValue(), forKey: .trackingOptions)
@@ -176,30 +183,41 @@ internal class RadarSettings: NSObject {  // swiftlint:disable:this type_body_le
 
     public static var remoteTrackingOptions: RadarTrackingOptions? {
         get {
-            if let options = RadarUserDefaults.dictionary(forKey: .remoteTrackingOptions) {
-                return RadarTrackingOptions(from: options)
+            RadarSettingsCache.shared.copy(forKey: .remoteTrackingOptions) { () -> RadarTrackingOptions? in
+                if let options = RadarUserDefaults.dictionary(forKey: .remoteTrackingOptions) {
+                    return RadarTrackingOptions(from: options)
+                }
+                return nil
             }
-            return nil
         }
         set { RadarUserDefaults.set(newValue?.dictionaryValue(), forKey: .remoteTrackingOptions) }
     }
 
+    /// Remote tracking options when set, otherwise the local ones.
+    public static var effectiveTrackingOptions: RadarTrackingOptions {
+        remoteTrackingOptions ?? trackingOptions
+    }
+
     public static var tripOptions: RadarTripOptions? {
         get {
-            if let options = RadarUserDefaults.dictionary(forKey: .tripOptions) {
-                return RadarTripOptions(from: options)
+            RadarSettingsCache.shared.copy(forKey: .tripOptions) { () -> RadarTripOptions? in
+                if let options = RadarUserDefaults.dictionary(forKey: .tripOptions) {
+                    return RadarTripOptions(from: options)
+                }
+                return nil
             }
-            return nil
         }
         set { RadarUserDefaults.set(newValue?.dictionaryValue(), forKey: .tripOptions) }
     }
 
     public static var trip: RadarTrip? {
         get {
-            if let dict = RadarUserDefaults.dictionary(forKey: .trip) {
-                return RadarTrip(object: dict)
+            RadarSettingsCache.shared.value(forKey: .trip) { () -> RadarTrip? in
+                if let dict = RadarUserDefaults.dictionary(forKey: .trip) {
+                    return RadarTrip(object: dict)
+                }
+                return nil
             }
-            return nil
         }
         set { RadarUserDefaults.set(newValue?.dictionaryValue(), forKey: .trip) }
     }
@@ -211,8 +229,9 @@ internal class RadarSettings: NSObject {  // swiftlint:disable:this type_body_le
 
     public static var sdkConfiguration: RadarSdkConfiguration? {
         get {
-            let options = RadarUserDefaults.dictionary(forKey: .sdkConfiguration)
-            return RadarSdkConfiguration(dict: options)
+            RadarSettingsCache.shared.value(forKey: .sdkConfiguration) { () -> RadarSdkConfiguration? in
+                RadarSdkConfiguration(dict: RadarUserDefaults.dictionary(forKey: .sdkConfiguration))
+            }
         }
         set {
             RadarUserDefaults.set(newValue?.dictionaryValue(), forKey: .sdkConfiguration)
@@ -223,20 +242,23 @@ internal class RadarSettings: NSObject {  // swiftlint:disable:this type_body_le
         }
     }
 
+    // checked before every log message, so cached like the decoded settings above
     public static var logLevel: RadarLogLevel {
         get {
-            if RadarUserDefaults.object(forKey: .logLevel) == nil {
-                if userDebug {
-                    return .debug
-                } else {
-                    #if DEBUG
+            RadarSettingsCache.shared.value(forKey: .logLevel) { () -> RadarLogLevel in
+                if RadarUserDefaults.object(forKey: .logLevel) == nil {
+                    if userDebug {
                         return .debug
-                    #else
-                        return .none
-                    #endif
+                    } else {
+                        #if DEBUG
+                            return .debug
+                        #else
+                            return .none
+                        #endif
+                    }
                 }
+                return RadarLogLevel(rawValue: RadarUserDefaults.integer(forKey: .logLevel)) ?? .none
             }
-            return RadarLogLevel(rawValue: RadarUserDefaults.integer(forKey: .logLevel)) ?? .none
         }
         set { RadarUserDefaults.set(newValue.rawValue, forKey: .logLevel) }
     }
@@ -265,6 +287,8 @@ internal class RadarSettings: NSObject {  // swiftlint:disable:this type_body_le
         }
         set {
             RadarUserDefaults.set(newValue, forKey: .userDebug)
+            // the default log level depends on userDebug
+            RadarSettingsCache.shared.invalidate(.logLevel)
         }
     }
 
@@ -0,0 +1,110 @@
+//
+//  RadarSettingsCache.swift
+//  RadarSDK
+//
+//  Copyright © 2026 Radar Labs, Inc. All rights reserved.
+//
+
+import Foundation
+
+/// Decoded values of the settings `RadarSettings` stores as dictionaries, so the location
+/// path doesn't rebuild a `RadarSdkConfiguration` or `RadarTrackingOptions` from
+/// `RadarUserDefaults` on every read.
+///
+/// An entry is dropped when its key is written through `RadarUserDefaults.set(_:forKey:)`,
+/// and every entry when the backing `UserDefaults` is swapped or any defaults in the process
+/// change, so writes that bypass `RadarUserDefaults` are never served stale. Cached values are snapshots that
+/// are never handed out mutable: mutable objects are read through `copy(forKey:decode:)`, and
+/// everything else cached is immutable.
+final class RadarSettingsCache: @unchecked Sendable {
+
+    static let shared = RadarSettingsCache()
+
+    private let lock = NSLock()
+    private var values: [RadarUserDefaults.Key: Any] = [:]
+    // bumped on every invalidation, so a decode that raced with a write isn't cached
+    private var generation: UInt64 = 0
+    private var enabled = true
+    private var reads = 0
+    private var decodes = 0
+    private var observer: NSObjectProtocol?
+
+    private init() {
+        observer = NotificationCenter.default.addObserver(forName: UserDefaults.didChangeNotification, object: nil, queue: nil) { [weak self] _ in
+            self?.invalidateAll()
+        }
+    }
+
+    /// When disabled every read decodes, as before the cache existed. Used to compare the two.
+    var isEnabled: Bool {
+        get {
+            lock.lock()
+            defer { lock.unlock() }
+            return enabled
+        }
+        set {
+            lock.lock()
+            enabled = newValue
+            values.removeAll()
+            generation &+= 1
+            lock.unlock()
+        }
+    }
+
+    /// Reads served and decodes performed since the last `resetStats()`.
+    var stats: (reads: Int, decodes: Int) {
+        lock.lock()
+        defer { lock.unlock() }
+        return (reads, decodes)
+    }
+
+    func resetStats() {
+        lock.lock()
+        reads = 0
+        decodes = 0
+        lock.unlock()
+    }
+
+    /// Returns the cached value for `key`, calling `decode` on a miss. `decode` runs outside
+    /// the lock, so it may read other settings.
+    func value<T>(forKey key: RadarUserDefaults.Key, decode: () -> T) -> T {
+        lock.lock()
+        reads += 1
+        if enabled, let cached = values[key] {
+            lock.unlock()
+            return cached as! T
+        }
+        decodes += 1
+        let startGeneration = generation
+        lock.unlock()
+
+        let value = decode()
+
+        lock.lock()
+        if enabled && generation == startGeneration {
+            values[key] = value
+        }
+        lock.unlock()
+        return value
+    }
+
+    /// Like `value(forKey:decode:)`, but returns a copy of the cached object, so a caller that
+    /// mutates what it read doesn't change the snapshot other readers get.
+    func copy<T: NSCopying>(forKey key: RadarUserDefaults.Key, decode: () -> T?) -> T? {
+        value(forKey: key, decode: decode).map { $0.copy(with: nil) as! T }
+    }
+
+    func invalidate(_ key: RadarUserDefaults.Key) {
+        lock.lock()
+        values[key] = nil
+        generation &+= 1
+        lock.unlock()
+    }
+
+    func invalidateAll() {
+        lock.lock()
+        values.removeAll()
+        generation &+= 1
+        lock.unlock()
+    }
+}
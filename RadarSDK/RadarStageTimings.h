@@ -0,0 +1,49 @@
+//
+//  RadarStageTimings.h
+//  RadarSDK
+//
+//  Copyright © 2026 Radar Labs, Inc. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ How long each stage of a multi-step request took, e.g. the config, location, fraud payload and `/track` stages of a verified track, which may overlap.
+
+ Times are measured with system uptime from when the timings were created. Stages can be started and ended from any thread.
+ */
+@interface RadarStageTimings : NSObject
+
+/**
+ Seconds since the timings were created, or until `finish` if it has been called.
+ */
+@property (assign, atomic, readonly) NSTimeInterval total;
+
+- (void)startStage:(NSString *)stage;
+- (void)endStage:(NSString *)stage;
+
+/**
+ Stops the total, stages still running are left unfinished.
+ */
+- (void)finish;
+
+/**
+ Seconds from start to end of the stage, or -1 if it has not both started and ended.
+ */
+- (NSTimeInterval)durationOfStage:(NSString *)stage;
+
+/**
+ Seconds from creation to the start of the stage, or -1 if it has not started.
+ */
+- (NSTimeInterval)offsetOfStage:(NSString *)stage;
+
+/**
+ Stages in the order they started, e.g. "config = 112 ms (+0); location = 340 ms (+0); fraud = 95 ms (+340); total = 801 ms".
+ */
+- (NSString *)logDescription;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,104 @@
+//
+//  RadarStageTimings.m
+//  RadarSDK
+//
+//  Copyright © 2026 Radar Labs, Inc. All rights reserved.
+//
+
+#import "RadarStageTimings.h"
+
+@interface RadarStageTimings ()
+
+@property (assign, nonatomic) NSTimeInterval createdAt;
+@property (assign, nonatomic) NSTimeInterval finishedAt;
+@property (strong, nonatomic) NSMutableArray<NSString *> *stages;
+@property (strong, nonatomic) NSMutableDictionary<NSString *, NSNumber *> *startedAt;
+@property (strong, nonatomic) NSMutableDictionary<NSString *, NSNumber *> *endedAt;
+
+@end
+
+@implementation RadarStageTimings
+
+- (instancetype)init {
+    self = [super init];
+    if (self) {
+        _createdAt = [NSProcessInfo processInfo].systemUptime;
+        _stages = [NSMutableArray new];
+        _startedAt = [NSMutableDictionary new];
+        _endedAt = [NSMutableDictionary new];
+    }
+    return self;
+}
+
+- (void)startStage:(NSString *)stage {
+    NSTimeInterval now = [NSProcessInfo processInfo].systemUptime;
+    @synchronized(self) {
+        if (!self.startedAt[stage]) {
+            [self.stages addObject:stage];
+        }
+        self.startedAt[stage] = @(now - self.createdAt);
+        [self.endedAt removeObjectForKey:stage];
+    }
+}
+
+- (void)endStage:(NSString *)stage {
+    NSTimeInterval now = [NSProcessInfo processInfo].systemUptime;
+    @synchronized(self) {
+        if (self.startedAt[stage] && !self.endedAt[stage]) {
+            self.endedAt[stage] = @(now - self.createdAt);
+        }
+    }
+}
+
+- (void)finish {
+    NSTimeInterval now = [NSProcessInfo processInfo].systemUptime;
+    @synchronized(self) {
+        if (!self.finishedAt) {
+            self.finishedAt = now;
+        }
+    }
+}
+
+- (NSTimeInterval)total {
+    @synchronized(self) {
+        NSTimeInterval end = self.finishedAt ?: [NSProcessInfo processInfo].systemUptime;
+        return end - self.createdAt;
+    }
+}
+
+- (NSTimeInterval)durationOfStage:(NSString *)stage {
+    @synchronized(self) {
+        NSNumber *startedAt = self.startedAt[stage];
+        NSNumber *endedAt = self.endedAt[stage];
+        if (!startedAt || !endedAt) {
+            return -1;
+        }
+        return endedAt.doubleValue - startedAt.doubleValue;
+    }
+}
+
+- (NSTimeInterval)offsetOfStage:(NSString *)stage {
+    @synchronized(self) {
+        NSNumber *startedAt = self.startedAt[stage];
+        return startedAt ? startedAt.doubleValue : -1;
+    }
+}
+
+- (NSString *)logDescription {
+    NSMutableArray<NSString *> *parts = [NSMutableArray new];
+    @synchronized(self) {
+        for (NSString *stage in self.stages) {
+            NSTimeInterval offset = self.startedAt[stage].doubleValue;
+            NSNumber *endedAt = self.endedAt[stage];
+            if (endedAt) {
+                [parts addObject:[NSString stringWithFormat:@"%@ = %.0f ms (+%.0f)", stage, (endedAt.doubleValue - offset) * 1000, offset * 1000]];
+            } else {
+                [parts addObject:[NSString stringWithFormat:@"%@ = unfinished (+%.0f)", stage, offset * 1000]];
+            }
+        }
+    }
+    [parts addObject:[NSString stringWithFormat:@"total = %.0f ms", self.total * 1000]];
+    return [parts componentsJoinedByString:@"; "];
+}
+
+@end
@@ -56,6 +56,8 @@ NS_ASSUME_NONNULL_BEGIN
 + (NSArray<NSDictionary *> *_Nullable)altitudeAdjustments;
 + (void)setAltitudeAdjustments:(NSArray<NSDictionary *> *_Nullable)altitudeAdjustments;
 + (void)setRadarUser:(RadarUser *_Nullable)radarUser NS_SWIFT_NAME(setRadarUser(_:));
+// stores the user object from a /track response, without building a RadarUser from it
++ (void)setRadarUserObject:(NSDictionary *_Nullable)radarUserObject;
 + (RadarUser *_Nullable)radarUser NS_SWIFT_NAME(radarUser());
 
 @end
@@ -320,12 +320,25 @@ static NSTimeInterval const kBackupInterval = 2.0; // 2 seconds
     }
 }
 
++ (void)setRadarUserObject:(NSDictionary *_Nullable)radarUserObject {
+    // kept as JSON, since a response object can hold nulls that a property list can't
+    NSData *radarUserData = [RadarUtils jsonData:radarUserObject];
+    if (radarUserData) {
+        [[NSUserDefaults standardUserDefaults] setObject:radarUserData forKey:kRadarUser];
+    } else {
+        [[NSUserDefaults standardUserDefaults] removeObjectForKey:kRadarUser];
+    }
+}
+
 + (RadarUser *_Nullable)radarUser {
-    NSDictionary *radarUserDict = [[NSUserDefaults standardUserDefaults] objectForKey:kRadarUser];
-    if (!radarUserDict) {
+    id radarUserObj = [[NSUserDefaults standardUserDefaults] objectForKey:kRadarUser];
+    if ([radarUserObj isKindOfClass:[NSData class]]) {
+        radarUserObj = [NSJSONSerialization JSONObjectWithData:radarUserObj options:0 error:nil];
+    }
+    if (![radarUserObj isKindOfClass:[NSDictionary class]]) {
         return nil;
     }
-    return [[RadarUser alloc] initWithObject:radarUserDict];
+    return [[RadarUser alloc] initWithObject:radarUserObj];
 }
 
 @end
@@ -12,7 +12,7 @@ import Foundation
 @objc(RadarSyncManager)
 public final class RadarSyncManager: NSObject {
 
-    static let syncStore = RadarFileStorageObject<RadarSyncState>(fileName: "radar_sync_state.json")
+    static let syncStore = RadarSyncStore()
 
     private static let placeDetectionRadius: Double = 75.0
     private static let beaconRange: Double = 100.0
@@ -29,6 +29,11 @@ public final class RadarSyncManager: NSObject {
     nonisolated(unsafe) static var rejectedAtLocation: CLLocation?
     nonisolated(unsafe) static var lastPlaceCheckLocation: CLLocation?
 
+    private static let geofenceIndexLock = NSLock()
+    nonisolated(unsafe) private static var cachedGeofenceIndex: (generation: UInt64, version: UInt64, index: RadarGeofenceIndex)?
+    nonisolated(unsafe) private static var geofenceIndexVersion: UInt64 = 0
+    nonisolated(unsafe) private static var cachedContainment: (key: RadarGeofenceContainment.Key, containment: RadarGeofenceContainment)?
+
     // MARK: - Lifecycle
 
     @objc public static func start(interval: TimeInterval) {
@@ -59,41 +64,100 @@ public final class RadarSyncManager: NSObject {
 
         Task {
             do {
-                let response = try await RadarAPIClient.shared.fetchSyncRegion(
-                    latitude: location.coordinate.latitude,
-                    longitude: location.coordinate.longitude
-                )
+                try await syncRegion(latitude: location.coordinate.latitude, longitude: location.coordinate.longitude)
+            } catch {
+                RadarLogger.shared.warning("SyncManager: Sync region request failed")
+            }
+        }
+    }
 
-                let currentState = syncStore.read()
+    /// Fetches the sync region around a coordinate and stores it. Once a region has been
+    /// synced, only the changes since its version are requested and applied in place.
+    static func syncRegion(latitude: Double, longitude: Double, apiClient: RadarAPIClient = .shared) async throws {
+        let version = syncStore.read()?.syncedRegionVersion
+        let response = try await apiClient.fetchSyncRegion(latitude: latitude, longitude: longitude, version: version)
 
-                if let center = response.regionCenter, let radius = response.regionRadius {
-                    if currentState?.syncedRegionCenter == nil {
+        if response.notModified {
+            RadarLogger.shared.debug("SyncManager: Sync region not modified | version = \(response.version ?? "")")
+            return
+        }
 
-                        RadarLogger.shared.info("SyncManager: Initial sync region set | lat = \(center.latitude); lng = \(center.longitude); radius = \(radius)")
-                    } else if currentState?.syncedRegionCenter?.latitude != center.latitude || currentState?.syncedRegionCenter?.longitude != center.longitude
-                        || currentState?.syncedRegionRadius != radius
-                    {
+        let currentState = syncStore.read()
 
-                        RadarLogger.shared.info("SyncManager: Sync region changed | lat = \(center.latitude); lng = \(center.longitude); radius = \(radius)")
-                    }
-                } else {
-                    if currentState?.syncedRegionCenter != nil {
-                        RadarLogger.shared.info("SyncManager: Sync region cleared")
-                    }
-                }
+        if let center = response.regionCenter, let radius = response.regionRadius {
+            if currentState?.syncedRegionCenter == nil {
+
+                RadarLogger.shared.info("SyncManager: Initial sync region set | lat = \(center.latitude); lng = \(center.longitude); radius = \(radius)")
+            } else if currentState?.syncedRegionCenter?.latitude != center.latitude || currentState?.syncedRegionCenter?.longitude != center.longitude
+                || currentState?.syncedRegionRadius != radius
+            {
+
+                RadarLogger.shared.info("SyncManager: Sync region changed | lat = \(center.latitude); lng = \(center.longitude); radius = \(radius)")
+            }
+        } else if response.delta == nil {
+            if currentState?.syncedRegionCenter != nil {
+                RadarLogger.shared.info("SyncManager: Sync region cleared")
+            }
+        }
 
-                syncStore.modify { state in
-                    if state == nil { state = RadarSyncState() }
-                    state?.syncedGeofences = response.geofences
-                    state?.syncedPlaces = response.places
-                    state?.syncedBeacons = response.beacons
-                    state?.syncedRegionCenter = response.regionCenter
-                    state?.syncedRegionRadius = response.regionRadius
+        if let delta = response.delta {
+            RadarLogger.shared.debug(
+                "SyncManager: Applying sync region delta | version = \(response.version ?? ""); geofences = +\(delta.geofences.upserted.count)/-\(delta.geofences.removed.count); places = +\(delta.places.upserted.count)/-\(delta.places.removed.count); beacons = +\(delta.beacons.upserted.count)/-\(delta.beacons.removed.count)"
+            )
+        }
+
+        syncStore.modify { state in
+            apply(response, to: &state)
+        }
+        _ = geofenceIndex()
+    }
+
+    static func apply(_ response: SyncRegionResponse, to state: inout RadarSyncState?) {
+        if state == nil { state = RadarSyncState() }
+        if let delta = response.delta {
+            state?.syncedGeofences = merge(state?.syncedGeofences, delta.geofences, id: \.id)
+            state?.syncedPlaces = merge(state?.syncedPlaces, delta.places, id: \.id)
+            state?.syncedBeacons = merge(state?.syncedBeacons, delta.beacons, id: \.id)
+            // a delta only carries the region when it moved
+            if let center = response.regionCenter, let radius = response.regionRadius {
+                state?.syncedRegionCenter = center
+                state?.syncedRegionRadius = radius
+            }
+        } else {
+            state?.syncedGeofences = response.geofences
+            state?.syncedPlaces = response.places
+            state?.syncedBeacons = response.beacons
+            state?.syncedRegionCenter = response.regionCenter
+            state?.syncedRegionRadius = response.regionRadius
+        }
+        state?.syncedRegionVersion = response.version
+    }
+
+    /// Applies removals, then replaces upserted entities in place or appends new ones. An
+    /// empty change set returns `current` untouched so the stored region isn't rewritten.
+    private static func merge<Element>(_ current: [Element]?, _ changes: SyncRegionDelta.Changes<Element>, id: KeyPath<Element, String>) -> [Element]? {
+        guard !changes.isEmpty else { return current }
+
+        var merged = current ?? []
+        if !changes.removed.isEmpty {
+            let removed = Set(changes.removed)
+            merged.removeAll { removed.contains($0[keyPath: id]) }
+        }
+        if !changes.upserted.isEmpty {
+            var positions = [String: Int](minimumCapacity: merged.count)
+            for (i, element) in merged.enumerated() {
+                positions[element[keyPath: id]] = i
+            }
+            for element in changes.upserted {
+                if let i = positions[element[keyPath: id]] {
+                    merged[i] = element
+                } else {
+                    positions[element[keyPath: id]] = merged.count
+                    merged.append(element)
                 }
-            } catch {
-                RadarLogger.shared.warning("SyncManager: Sync region request failed")
             }
         }
+        return merged
     }
 
     // MARK: - Track Decision
@@ -174,7 +238,10 @@ public final class RadarSyncManager: NSObject {
         return distance <= radius
     }
 
-    private static func isPoint(_ point: CLLocationCoordinate2D, insidePolygon polygon: [RadarCoordinateSwift]) -> Bool {
+    // Great-circle reference implementations; containment queries use the geofence's
+    // `RadarCompiledPolygon` instead.
+
+    static func isPoint(_ point: CLLocationCoordinate2D, insidePolygon polygon: [RadarCoordinateSwift]) -> Bool {
         guard polygon.count >= 3 else { return false }
 
         var inside = false
@@ -207,7 +274,7 @@ public final class RadarSyncManager: NSObject {
         return inside
     }
 
-    private static func distanceToPolygonEdge(from point: CLLocationCoordinate2D, polygon: [RadarCoordinateSwift]) -> Double {
+    static func distanceToPolygonEdge(from point: CLLocationCoordinate2D, polygon: [RadarCoordinateSwift]) -> Double {
         guard polygon.count >= 3 else { return Double.greatestFiniteMagnitude }
 
         let pointLocation = CLLocation(latitude: point.latitude, longitude: point.longitude)
@@ -285,7 +352,7 @@ public final class RadarSyncManager: NSObject {
 
     // MARK: - Containment Queries
 
-    private static func isLocationInside(
+    static func isLocationInside(
         geofence: RadarGeofenceSwift,
         location: CLLocation,
         accuracy: Double,
@@ -297,35 +364,131 @@ public final class RadarSyncManager: NSObject {
             ? (sdkConfig?.bufferGeofenceExits ?? true)
             : (sdkConfig?.bufferGeofenceEntries ?? true)
 
+        let inside = containment(of: geofence, location: location, accuracy: accuracy, bufferEntry: shouldBuffer, bufferExit: shouldBuffer)
+        return inside.entry
+    }
+
+    /// Entry and exit containment in one pass; the unbuffered polygon test and the buffered
+    /// edge distance are each computed at most once.
+    private static func containment(
+        of geofence: RadarGeofenceSwift,
+        location: CLLocation,
+        accuracy: Double,
+        bufferEntry: Bool,
+        bufferExit: Bool
+    ) -> (entry: Bool, exit: Bool) {
         switch geofence.geometry {
         case .circle(let center, let radius):
-            var effectiveRadius = radius
-            if shouldBuffer { effectiveRadius += accuracy }
-            return isPoint(location, insideCircleWithCenter: center.clLocationCoordinate2D, radius: effectiveRadius)
-        case .polygon(let coordinates, let center, let radius):
-            if isPoint(location.coordinate, insidePolygon: coordinates) {
-                return true
+            let distance = location.distance(from: center.clLocation)
+            return (distance <= (bufferEntry ? radius + accuracy : radius), distance <= (bufferExit ? radius + accuracy : radius))
+        case .polygon(_, let center, let radius):
+            guard let polygon = geofence.compiledPolygon else {
+                return (false, false)
             }
-            if shouldBuffer {
-                let bufferRadius = radius + accuracy
-                guard isPoint(location, insideCircleWithCenter: center.clLocationCoordinate2D, radius: bufferRadius) else {
-                    return false
-                }
-                return distanceToPolygonEdge(from: location.coordinate, polygon: coordinates) <= accuracy
+            let (x, y) = polygon.project(location.coordinate)
+            if polygon.contains(x: x, y: y) {
+                return (true, true)
             }
-            return false
+            guard bufferEntry || bufferExit, polygon.boundingBoxContains(x: x, y: y, margin: accuracy) else {
+                return (false, false)
+            }
+            let bufferRadius = radius + accuracy
+            guard isPoint(location, insideCircleWithCenter: center.clLocationCoordinate2D, radius: bufferRadius) else {
+                return (false, false)
+            }
+            let withinBuffer = polygon.distanceToEdge(x: x, y: y) <= accuracy
+            return (bufferEntry && withinBuffer, bufferExit && withinBuffer)
         }
     }
 
     static func getGeofences(for location: CLLocation, checkingForExit: Bool = false) -> [RadarGeofenceSwift] {
-        guard let geofences = syncStore.read()?.syncedGeofences, !geofences.isEmpty else {
-            return []
+        let containment = geofenceContainment(for: location)
+        return checkingForExit ? containment.insideExit : containment.insideEntry
+    }
+
+    /// Fix and inputs the memoized containment was computed for.
+    static var memoizedContainmentKey: RadarGeofenceContainment.Key? {
+        geofenceIndexLock.lock()
+        defer { geofenceIndexLock.unlock() }
+        return cachedContainment?.key
+    }
+
+    /// Containment of `location` in the synced geofences, memoized for the most recent fix
+    /// so the several evaluations made while handling one location share the geometry work.
+    static func geofenceContainment(for location: CLLocation) -> RadarGeofenceContainment {
+        guard let versioned = versionedGeofenceIndex() else {
+            return .empty
         }
+
         let sdkConfig = RadarSettings.sdkConfiguration
+        let bufferEntries = sdkConfig?.bufferGeofenceEntries ?? true
+        let bufferExits = sdkConfig?.bufferGeofenceExits ?? true
+        let key = RadarGeofenceContainment.Key(
+            latitude: location.coordinate.latitude,
+            longitude: location.coordinate.longitude,
+            horizontalAccuracy: location.horizontalAccuracy,
+            timestamp: location.timestamp,
+            indexVersion: versioned.version,
+            bufferEntries: bufferEntries,
+            bufferExits: bufferExits
+        )
+
+        geofenceIndexLock.lock()
+        let cached = cachedContainment
+        geofenceIndexLock.unlock()
+        if let cached, cached.key == key {
+            return cached.containment
+        }
+
         let accuracy = max(location.horizontalAccuracy, 0)
-        return geofences.filter {
-            isLocationInside(geofence: $0, location: location, accuracy: accuracy, checkingForExit: checkingForExit, sdkConfig: sdkConfig)
+        var insideEntry = [RadarGeofenceSwift]()
+        var insideExit = [RadarGeofenceSwift]()
+        for geofence in versioned.index.candidates(near: location.coordinate, radius: accuracy) {
+            let inside = containment(of: geofence, location: location, accuracy: accuracy, bufferEntry: bufferEntries, bufferExit: bufferExits)
+            if inside.entry { insideEntry.append(geofence) }
+            if inside.exit { insideExit.append(geofence) }
+        }
+        let containment = RadarGeofenceContainment(insideEntry: insideEntry, insideExit: insideExit, allGeofences: versioned.index.geofences)
+
+        geofenceIndexLock.lock()
+        cachedContainment = (key, containment)
+        geofenceIndexLock.unlock()
+
+        return containment
+    }
+
+    /// Spatial index over the synced geofences, rebuilt whenever the synced geofences in
+    /// `syncStore` have changed since the index was last built.
+    static func geofenceIndex() -> RadarGeofenceIndex? {
+        versionedGeofenceIndex()?.index
+    }
+
+    private static func versionedGeofenceIndex() -> (index: RadarGeofenceIndex, version: UInt64)? {
+        geofenceIndexLock.lock()
+        defer { geofenceIndexLock.unlock() }
+
+        let (state, generation) = syncStore.readVersioned()
+        if let cached = cachedGeofenceIndex, cached.generation == generation {
+            return (cached.index, cached.version)
+        }
+        guard let geofences = state?.syncedGeofences, !geofences.isEmpty else {
+            cachedGeofenceIndex = nil
+            cachedContainment = nil
+            return nil
         }
+
+        // Writes to the tracking state (entry timestamps, last synced ids) leave the
+        // geofence array untouched, so keep the index when it still shares its storage.
+        if let cached = cachedGeofenceIndex, cached.index.isBuilt(from: geofences) {
+            cachedGeofenceIndex = (generation, cached.version, cached.index)
+            return (cached.index, cached.version)
+        }
+
+        geofenceIndexVersion &+= 1
+        let index = RadarGeofenceIndex(geofences: geofences)
+        cachedGeofenceIndex = (generation, geofenceIndexVersion, index)
+        cachedContainment = nil
+        return (index, geofenceIndexVersion)
     }
 
     static func getBeacons(for location: CLLocation) -> [RadarBeaconSwift] {
@@ -375,8 +538,9 @@ public final class RadarSyncManager: NSObject {
     @objc public static func hasGeofenceStateChanged(location: CLLocation) -> Bool {
         let state = syncStore.read() ?? RadarSyncState()
         let lastKnownIds = Set(state.lastSyncedGeofenceIds)
+        let evaluation = evaluateGeofences(for: location, against: lastKnownIds, state: state)
 
-        let entries = getGeofenceEntries(for: location, against: lastKnownIds)
+        let entries = evaluation.entered
         if !entries.isEmpty {
             let ids = entries.map { $0.id }
             RadarLogger.shared.debug("SyncManager: Detected geofence entries: \(ids)")
@@ -384,7 +548,7 @@ public final class RadarSyncManager: NSObject {
             return true
         }
 
-        let exits = getGeofenceExits(for: location, against: lastKnownIds)
+        let exits = evaluation.exited
         if !exits.isEmpty {
             let ids = exits.map { $0.id }
             RadarLogger.shared.debug("SyncManager: Detected geofence exits: \(ids)")
@@ -392,7 +556,7 @@ public final class RadarSyncManager: NSObject {
             return true
         }
 
-        let dwells = getGeofenceDwells(for: location, against: lastKnownIds)
+        let dwells = evaluation.dwells
         if !dwells.isEmpty {
             for geofence in dwells {
                 RadarLogger.shared.debug("SyncManager: Dwell threshold reached for geofence: \(geofence.id)")
@@ -495,13 +659,46 @@ public final class RadarSyncManager: NSObject {
 
     // MARK: - Geofence Diff
 
+    /// Entries, exits and dwells for `location` against `lastKnownIds`, all derived from a
+    /// single (memoized) containment pass.
+    static func evaluateGeofences(for location: CLLocation, against lastKnownIds: Set<String>, state: RadarSyncState? = nil) -> RadarGeofenceEvaluation {
+        let containment = geofenceContainment(for: location)
+        let sdkConfig = RadarSettings.sdkConfiguration
+        let state = state ?? syncStore.read() ?? RadarSyncState()
+
+        return RadarGeofenceEvaluation(
+            containment: containment,
+            entered: geofenceEntries(in: containment, against: lastKnownIds, sdkConfig: sdkConfig),
+            exited: geofenceExits(in: containment, against: lastKnownIds),
+            dwells: geofenceDwells(in: containment, against: lastKnownIds, state: state, sdkConfig: sdkConfig)
+        )
+    }
+
     static func getGeofenceEntries(for location: CLLocation, against lastKnownIds: Set<String>) -> [RadarGeofenceSwift] {
-        let currentGeofences = getGeofences(for: location)
-        let currentGeofenceIds = Set(currentGeofences.map { $0.id })
-        let enteredIds = currentGeofenceIds.subtracting(lastKnownIds)
+        geofenceEntries(in: geofenceContainment(for: location), against: lastKnownIds, sdkConfig: RadarSettings.sdkConfiguration)
+    }
+
+    static func getGeofenceExits(for location: CLLocation, against lastKnownIds: Set<String>) -> [RadarGeofenceSwift] {
+        geofenceExits(in: geofenceContainment(for: location), against: lastKnownIds)
+    }
+
+    static func getGeofenceDwells(for location: CLLocation, against lastKnownIds: Set<String>) -> [RadarGeofenceSwift] {
+        geofenceDwells(
+            in: geofenceContainment(for: location), against: lastKnownIds,
+            state: syncStore.read() ?? RadarSyncState(), sdkConfig: RadarSettings.sdkConfiguration
+        )
+    }
+
+    private static func geofenceEntries(
+        in containment: RadarGeofenceContainment,
+        against lastKnownIds: Set<String>,
+        sdkConfig: RadarSdkConfiguration?
+    ) -> [RadarGeofenceSwift] {
+        let currentGeofences = containment.insideEntry
+        let enteredIds = Set(currentGeofences.map { $0.id }).subtracting(lastKnownIds)
         guard !enteredIds.isEmpty else { return [] }
 
-        let projectStopDetection = RadarSettings.sdkConfiguration?.stopDetection ?? false
+        let projectStopDetection = sdkConfig?.stopDetection ?? false
         let isStopped = RadarSwift.bridge?.isStopped() ?? false
 
         return currentGeofences.filter { geofence in
@@ -515,31 +712,32 @@ public final class RadarSyncManager: NSObject {
         }
     }
 
-    static func getGeofenceExits(for location: CLLocation, against lastKnownIds: Set<String>) -> [RadarGeofenceSwift] {
-        let exitCheckGeofences = getGeofences(for: location, checkingForExit: true)
-        let exitCheckIds = Set(exitCheckGeofences.map { $0.id })
+    private static func geofenceExits(in containment: RadarGeofenceContainment, against lastKnownIds: Set<String>) -> [RadarGeofenceSwift] {
+        let exitCheckIds = Set(containment.insideExit.map { $0.id })
         let exitedIds = lastKnownIds.subtracting(exitCheckIds)
         guard !exitedIds.isEmpty else { return [] }
 
-        let allSyncedGeofences = syncStore.read()?.syncedGeofences ?? []
-        return allSyncedGeofences.filter { exitedIds.contains($0.id) }
+        return containment.allGeofences.filter { exitedIds.contains($0.id) }
     }
 
-    static func getGeofenceDwells(for location: CLLocation, against lastKnownIds: Set<String>) -> [RadarGeofenceSwift] {
-        let projectDwellThreshold = RadarSettings.sdkConfiguration?.defaultGeofenceDwellThreshold ?? 0
-        let currentGeofences = getGeofences(for: location)
-        let currentGeofenceIds = Set(currentGeofences.map { $0.id })
+    private static func geofenceDwells(
+        in containment: RadarGeofenceContainment,
+        against lastKnownIds: Set<String>,
+        state: RadarSyncState,
+        sdkConfig: RadarSdkConfiguration?
+    ) -> [RadarGeofenceSwift] {
+        let projectDwellThreshold = sdkConfig?.defaultGeofenceDwellThreshold ?? 0
+        let currentGeofences = containment.insideEntry
         let anyGeofenceHasDwell = currentGeofences.contains { $0.dwellThreshold != nil }
 
         guard projectDwellThreshold > 0 || anyGeofenceHasDwell else { return [] }
 
-        let state = syncStore.read() ?? RadarSyncState()
         let timestamps = state.geofenceEntryTimestamps
         let dwellFired = Set(state.dwellEventsFired)
         let now = Date()
 
         return currentGeofences.filter { geofence in
-            guard currentGeofenceIds.intersection(lastKnownIds).contains(geofence.id) else { return false }
+            guard lastKnownIds.contains(geofence.id) else { return false }
             guard !dwellFired.contains(geofence.id) else { return false }
             guard let entryTimestamp = timestamps[geofence.id] else { return false }
 
@@ -618,9 +816,19 @@ public final class RadarSyncManager: NSObject {
     }
 
     @objc public static func reconcileSyncState(user: RadarUser) {
-        let serverGeofenceIds = user.geofences?.compactMap { $0._id } ?? []
-        let serverPlaceIds: [String] = user.place?._id != nil ? [user.place!._id] : []
-        let serverBeaconIds = user.beacons?.compactMap { $0._id } ?? []
+        reconcileSyncState(
+            geofenceIds: user.geofences?.compactMap { $0._id } ?? [],
+            placeId: user.place?._id,
+            beaconIds: user.beacons?.compactMap { $0._id } ?? []
+        )
+    }
+
+    /// Reconciles with the ids of the geofences, place and beacons the server has the user in,
+    /// which a /track response summary reads without building a `RadarUser`.
+    @objc public static func reconcileSyncState(geofenceIds: [String], placeId: String?, beaconIds: [String]) {
+        let serverGeofenceIds = geofenceIds
+        let serverPlaceIds: [String] = placeId.map { [$0] } ?? []
+        let serverBeaconIds = beaconIds
 
         let state = syncStore.read() ?? RadarSyncState()
         let clientGeofenceIds = state.lastSyncedGeofenceIds
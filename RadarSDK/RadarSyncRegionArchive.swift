@@ -0,0 +1,410 @@
+//
+//  RadarSyncRegionArchive.swift
+//  RadarSDK
+//
+//  Copyright © 2026 Radar Labs, Inc. All rights reserved.
+//
+
+import Foundation
+
+/// Compact little-endian binary encoding of a `RadarSyncRegion`.
+///
+/// The sync region is large and only changes when a new region is fetched, so it is kept
+/// out of the JSON tracking state and written in this format. Files are read memory-mapped
+/// and decoded in one sequential pass without any JSON parsing.
+///
+/// Layout: `"RSRG"` magic, `UInt16` version, region center, radius and server version (from
+/// format 2), then the geofence, place and beacon sections, each a presence byte followed by
+/// a `UInt32` count and records.
+/// Strings are a `UInt32` byte length followed by UTF-8 bytes; optionals are prefixed by a
+/// presence byte.
+enum RadarSyncRegionArchive {
+
+    static let magic: [UInt8] = Array("RSRG".utf8)
+    static let version: UInt16 = 2
+
+    enum ArchiveError: Error {
+        case badHeader
+        case unsupportedVersion(UInt16)
+        case truncated
+        case invalidValue
+    }
+
+    private enum GeometryTag: UInt8 {
+        case circle = 0
+        case polygon = 1
+    }
+
+    private enum MetadataTag: UInt8 {
+        case string = 0
+        case int = 1
+        case double = 2
+        case bool = 3
+    }
+
+    // MARK: - Encoding
+
+    static func encode(_ region: RadarSyncRegion) -> Data {
+        var writer = Writer()
+        writer.bytes(magic)
+        writer.uint16(version)
+        writer.optional(region.center) { writer, center in writer.coordinate(center) }
+        writer.optional(region.radius) { writer, radius in writer.double(radius) }
+        writer.optional(region.version) { writer, version in writer.string(version) }
+        writer.optionalArray(region.geofences) { writer, geofence in writer.geofence(geofence) }
+        writer.optionalArray(region.places) { writer, place in writer.place(place) }
+        writer.optionalArray(region.beacons) { writer, beacon in writer.beacon(beacon) }
+        return Data(writer.buffer)
+    }
+
+    private struct Writer {
+        var buffer = [UInt8]()
+
+        mutating func bytes(_ bytes: [UInt8]) {
+            buffer.append(contentsOf: bytes)
+        }
+
+        mutating func uint8(_ value: UInt8) {
+            buffer.append(value)
+        }
+
+        mutating func uint16(_ value: UInt16) {
+            withUnsafeBytes(of: value.littleEndian) { buffer.append(contentsOf: $0) }
+        }
+
+        mutating func uint32(_ value: UInt32) {
+            withUnsafeBytes(of: value.littleEndian) { buffer.append(contentsOf: $0) }
+        }
+
+        mutating func int64(_ value: Int64) {
+            withUnsafeBytes(of: value.littleEndian) { buffer.append(contentsOf: $0) }
+        }
+
+        mutating func double(_ value: Double) {
+            withUnsafeBytes(of: value.bitPattern.littleEndian) { buffer.append(contentsOf: $0) }
+        }
+
+        mutating func bool(_ value: Bool) {
+            buffer.append(value ? 1 : 0)
+        }
+
+        mutating func string(_ value: String) {
+            let utf8 = Array(value.utf8)
+            uint32(UInt32(utf8.count))
+            buffer.append(contentsOf: utf8)
+        }
+
+        mutating func coordinate(_ value: RadarCoordinateSwift) {
+            double(value.latitude)
+            double(value.longitude)
+        }
+
+        mutating func optional<T>(_ value: T?, _ body: (inout Writer, T) -> Void) {
+            guard let value else {
+                uint8(0)
+                return
+            }
+            uint8(1)
+            body(&self, value)
+        }
+
+        mutating func optionalArray<T>(_ values: [T]?, _ body: (inout Writer, T) -> Void) {
+            optional(values) { writer, values in
+                writer.uint32(UInt32(values.count))
+                for value in values {
+                    body(&writer, value)
+                }
+            }
+        }
+
+        mutating func geofence(_ geofence: RadarGeofenceSwift) {
+            string(geofence.id)
+            string(geofence.description)
+            optional(geofence.tag) { writer, value in writer.string(value) }
+            optional(geofence.externalId) { writer, value in writer.string(value) }
+            switch geofence.geometry {
+            case .circle(let center, let radius):
+                uint8(GeometryTag.circle.rawValue)
+                coordinate(center)
+                double(radius)
+            case .polygon(let coordinates, let center, let radius):
+                uint8(GeometryTag.polygon.rawValue)
+                coordinate(center)
+                double(radius)
+                uint32(UInt32(coordinates.count))
+                for coordinate in coordinates {
+                    self.coordinate(coordinate)
+                }
+            }
+            optional(geofence.dwellThreshold) { writer, value in writer.double(value) }
+            optional(geofence.geofenceStopDetection) { writer, value in writer.bool(value) }
+            optional(geofence.metadata) { writer, metadata in
+                writer.uint32(UInt32(metadata.count))
+                for (key, value) in metadata {
+                    writer.string(key)
+                    switch value {
+                    case .string(let v):
+                        writer.uint8(MetadataTag.string.rawValue)
+                        writer.string(v)
+                    case .int(let v):
+                        writer.uint8(MetadataTag.int.rawValue)
+                        writer.int64(Int64(v))
+                    case .double(let v):
+                        writer.uint8(MetadataTag.double.rawValue)
+                        writer.double(v)
+                    case .bool(let v):
+                        writer.uint8(MetadataTag.bool.rawValue)
+                        writer.bool(v)
+                    }
+                }
+            }
+            optional(geofence.operatingHours) { writer, operatingHours in
+                writer.uint32(UInt32(operatingHours.count))
+                for (day, ranges) in operatingHours {
+                    writer.string(day)
+                    writer.uint32(UInt32(ranges.count))
+                    for range in ranges {
+                        writer.uint32(UInt32(range.count))
+                        for value in range {
+                            writer.string(value)
+                        }
+                    }
+                }
+            }
+        }
+
+        mutating func place(_ place: RadarPlaceSwift) {
+            string(place.id)
+            string(place.name)
+            uint32(UInt32(place.categories.count))
+            for category in place.categories {
+                string(category)
+            }
+            coordinate(place.location)
+            optional(place.group) { writer, value in writer.string(value) }
+            optional(place.geometryRadius) { writer, value in writer.double(value) }
+        }
+
+        mutating func beacon(_ beacon: RadarBeaconSwift) {
+            string(beacon.id)
+            optional(beacon.description) { writer, value in writer.string(value) }
+            optional(beacon.tag) { writer, value in writer.string(value) }
+            optional(beacon.externalId) { writer, value in writer.string(value) }
+            string(beacon.uuid)
+            string(beacon.major)
+            string(beacon.minor)
+            optional(beacon.geometry) { writer, value in writer.coordinate(value) }
+        }
+    }
+
+    // MARK: - Decoding
+
+    static func decode(_ data: Data) throws -> RadarSyncRegion {
+        try data.withUnsafeBytes { raw in
+            var reader = Reader(raw)
+            guard try reader.bytes(magic.count) == magic else {
+                throw ArchiveError.badHeader
+            }
+            let fileVersion = try reader.uint16()
+            guard (1...version).contains(fileVersion) else {
+                throw ArchiveError.unsupportedVersion(fileVersion)
+            }
+
+            let center = try reader.optional { try $0.coordinate() }
+            let radius = try reader.optional { try $0.double() }
+            var regionVersion: String?
+            if fileVersion >= 2 {
+                regionVersion = try reader.optional { try $0.string() }
+            }
+            let geofences = try reader.optionalArray { try $0.geofence() }
+            let places = try reader.optionalArray { try $0.place() }
+            let beacons = try reader.optionalArray { try $0.beacon() }
+            return RadarSyncRegion(center: center, radius: radius, version: regionVersion, geofences: geofences, places: places, beacons: beacons)
+        }
+    }
+
+    private struct Reader {
+        let raw: UnsafeRawBufferPointer
+        var offset = 0
+
+        init(_ raw: UnsafeRawBufferPointer) {
+            self.raw = raw
+        }
+
+        private mutating func advance(_ count: Int) throws -> Int {
+            guard count >= 0, offset + count <= raw.count else { throw ArchiveError.truncated }
+            defer { offset += count }
+            return offset
+        }
+
+        mutating func bytes(_ count: Int) throws -> [UInt8] {
+            let start = try advance(count)
+            return Array(raw[start..<(start + count)])
+        }
+
+        mutating func uint8() throws -> UInt8 {
+            raw[try advance(1)]
+        }
+
+        mutating func uint16() throws -> UInt16 {
+            UInt16(littleEndian: raw.loadUnaligned(fromByteOffset: try advance(2), as: UInt16.self))
+        }
+
+        mutating func uint32() throws -> UInt32 {
+            UInt32(littleEndian: raw.loadUnaligned(fromByteOffset: try advance(4), as: UInt32.self))
+        }
+
+        mutating func int64() throws -> Int64 {
+            Int64(littleEndian: raw.loadUnaligned(fromByteOffset: try advance(8), as: Int64.self))
+        }
+
+        mutating func double() throws -> Double {
+            Double(bitPattern: UInt64(littleEndian: raw.loadUnaligned(fromByteOffset: try advance(8), as: UInt64.self)))
+        }
+
+        mutating func bool() throws -> Bool {
+            try uint8() != 0
+        }
+
+        mutating func count() throws -> Int {
+            let count = Int(try uint32())
+            // every record is at least one byte, so a larger count means a corrupt file
+            guard count <= raw.count - offset else { throw ArchiveError.truncated }
+            return count
+        }
+
+        mutating func string() throws -> String {
+            let length = Int(try uint32())
+            let start = try advance(length)
+            return String(decoding: UnsafeRawBufferPointer(rebasing: raw[start..<(start + length)]), as: UTF8.self)
+        }
+
+        mutating func coordinate() throws -> RadarCoordinateSwift {
+            let latitude = try double()
+            let longitude = try double()
+            return RadarCoordinateSwift(latitude: latitude, longitude: longitude)
+        }
+
+        mutating func optional<T>(_ body: (inout Reader) throws -> T) throws -> T? {
+            switch try uint8() {
+            case 0: return nil
+            case 1: return try body(&self)
+            default: throw ArchiveError.invalidValue
+            }
+        }
+
+        mutating func optionalArray<T>(_ body: (inout Reader) throws -> T) throws -> [T]? {
+            try optional { reader in
+                let count = try reader.count()
+                var values = [T]()
+                values.reserveCapacity(count)
+                for _ in 0..<count {
+                    values.append(try body(&reader))
+                }
+                return values
+            }
+        }
+
+        mutating func geofence() throws -> RadarGeofenceSwift {
+            let id = try string()
+            let description = try string()
+            let tag = try optional { try $0.string() }
+            let externalId = try optional { try $0.string() }
+
+            let geometry: RadarGeofenceGeometrySwift
+            switch GeometryTag(rawValue: try uint8()) {
+            case .circle:
+                let center = try coordinate()
+                let radius = try double()
+                geometry = .circle(center: center, radius: radius)
+            case .polygon:
+                let center = try coordinate()
+                let radius = try double()
+                let vertexCount = try count()
+                var coordinates = [RadarCoordinateSwift]()
+                coordinates.reserveCapacity(vertexCount)
+                for _ in 0..<vertexCount {
+                    coordinates.append(try coordinate())
+                }
+                geometry = .polygon(coordinates: coordinates, center: center, radius: radius)
+            case nil:
+                throw ArchiveError.invalidValue
+            }
+
+            let dwellThreshold = try optional { try $0.double() }
+            let stopDetection = try optional { try $0.bool() }
+            let metadata = try optional { reader -> [String: RadarMetadataValue] in
+                let count = try reader.count()
+                var metadata = [String: RadarMetadataValue](minimumCapacity: count)
+                for _ in 0..<count {
+                    let key = try reader.string()
+                    switch MetadataTag(rawValue: try reader.uint8()) {
+                    case .string: metadata[key] = .string(try reader.string())
+                    case .int: metadata[key] = .int(Int(try reader.int64()))
+                    case .double: metadata[key] = .double(try reader.double())
+                    case .bool: metadata[key] = .bool(try reader.bool())
+                    case nil: throw ArchiveError.invalidValue
+                    }
+                }
+                return metadata
+            }
+            let operatingHours = try optional { reader -> [String: [[String]]] in
+                let count = try reader.count()
+                var operatingHours = [String: [[String]]](minimumCapacity: count)
+                for _ in 0..<count {
+                    let day = try reader.string()
+                    let rangeCount = try reader.count()
+                    var ranges = [[String]]()
+                    ranges.reserveCapacity(rangeCount)
+                    for _ in 0..<rangeCount {
+                        let valueCount = try reader.count()
+                        var range = [String]()
+                        range.reserveCapacity(valueCount)
+                        for _ in 0..<valueCount {
+                            range.append(try reader.string())
+                        }
+                        ranges.append(range)
+                    }
+                    operatingHours[day] = ranges
+                }
+                return operatingHours
+            }
+
+            return RadarGeofenceSwift(
+                id: id, description: description, tag: tag, externalId: externalId,
+                geometry: geometry, dwellThreshold: dwellThreshold, geofenceStopDetection: stopDetection,
+                metadata: metadata, operatingHours: operatingHours
+            )
+        }
+
+        mutating func place() throws -> RadarPlaceSwift {
+            let id = try string()
+            let name = try string()
+            let categoryCount = try count()
+            var categories = [String]()
+            categories.reserveCapacity(categoryCount)
+            for _ in 0..<categoryCount {
+                categories.append(try string())
+            }
+            let location = try coordinate()
+            let group = try optional { try $0.string() }
+            let geometryRadius = try optional { try $0.double() }
+            return RadarPlaceSwift(id: id, name: name, categories: categories, location: location, group: group, geometryRadius: geometryRadius)
+        }
+
+        mutating func beacon() throws -> RadarBeaconSwift {
+            let id = try string()
+            let description = try optional { try $0.string() }
+            let tag = try optional { try $0.string() }
+            let externalId = try optional { try $0.string() }
+            let uuid = try string()
+            let major = try string()
+            let minor = try string()
+            let geometry = try optional { try $0.coordinate() }
+            return RadarBeaconSwift(
+                id: id, description: description, tag: tag, externalId: externalId,
+                uuid: uuid, major: major, minor: minor, geometry: geometry
+            )
+        }
+    }
+}
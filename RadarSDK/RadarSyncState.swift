@@ -11,6 +11,7 @@ import Foundation
 struct RadarSyncState: Codable, Sendable {
     var syncedRegionCenter: RadarCoordinateSwift?
     var syncedRegionRadius: Double?
+    var syncedRegionVersion: String?
     var syncedGeofences: [RadarGeofenceSwift]?
     var syncedPlaces: [RadarPlaceSwift]?
     var syncedBeacons: [RadarBeaconSwift]?
@@ -20,3 +21,58 @@ struct RadarSyncState: Codable, Sendable {
     var geofenceEntryTimestamps: [String: Double] = [:]
     var dwellEventsFired: [String] = []
 }
+
+/// Geometry half of `RadarSyncState`. Large, and only replaced when a new sync region is
+/// fetched; persisted with `RadarSyncRegionArchive`.
+struct RadarSyncRegion: Sendable {
+    var center: RadarCoordinateSwift?
+    var radius: Double?
+    var version: String?
+    var geofences: [RadarGeofenceSwift]?
+    var places: [RadarPlaceSwift]?
+    var beacons: [RadarBeaconSwift]?
+}
+
+/// Tracking half of `RadarSyncState`. Small, and mutated on most location updates.
+struct RadarSyncTrackingState: Codable, Sendable {
+    var lastSyncedGeofenceIds: [String] = []
+    var lastSyncedPlaceIds: [String] = []
+    var lastSyncedBeaconIds: [String] = []
+    var geofenceEntryTimestamps: [String: Double] = [:]
+    var dwellEventsFired: [String] = []
+}
+
+extension RadarSyncState {
+    init(region: RadarSyncRegion, tracking: RadarSyncTrackingState) {
+        self.init(
+            syncedRegionCenter: region.center,
+            syncedRegionRadius: region.radius,
+            syncedRegionVersion: region.version,
+            syncedGeofences: region.geofences,
+            syncedPlaces: region.places,
+            syncedBeacons: region.beacons,
+            lastSyncedGeofenceIds: tracking.lastSyncedGeofenceIds,
+            lastSyncedPlaceIds: tracking.lastSyncedPlaceIds,
+            lastSyncedBeaconIds: tracking.lastSyncedBeaconIds,
+            geofenceEntryTimestamps: tracking.geofenceEntryTimestamps,
+            dwellEventsFired: tracking.dwellEventsFired
+        )
+    }
+
+    var region: RadarSyncRegion {
+        RadarSyncRegion(
+            center: syncedRegionCenter, radius: syncedRegionRadius, version: syncedRegionVersion,
+            geofences: syncedGeofences, places: syncedPlaces, beacons: syncedBeacons
+        )
+    }
+
+    var tracking: RadarSyncTrackingState {
+        RadarSyncTrackingState(
+            lastSyncedGeofenceIds: lastSyncedGeofenceIds,
+            lastSyncedPlaceIds: lastSyncedPlaceIds,
+            lastSyncedBeaconIds: lastSyncedBeaconIds,
+            geofenceEntryTimestamps: geofenceEntryTimestamps,
+            dwellEventsFired: dwellEventsFired
+        )
+    }
+}
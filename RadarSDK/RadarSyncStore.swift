@@ -0,0 +1,202 @@
+//
+//  RadarSyncStore.swift
+//  RadarSDK
+//
+//  Copyright © 2026 Radar Labs, Inc. All rights reserved.
+//
+
+import Foundation
+
+/// Persistent store for `RadarSyncState`, with the same interface as `RadarFileStorageObject`.
+///
+/// The state is split across two files. The sync region (geofences, places, beacons) goes in
+/// a binary `RadarSyncRegionArchive` that is memory-mapped on load. It is only rewritten
+/// when a new region is stored. The tracking state (last synced ids, entry timestamps,
+/// dwell flags) goes in a small journaled `RadarFileStorageObject`, so the per-fix changes
+/// are appended in the background instead of rewriting a file on the caller's thread. The
+/// several tracking writes made while handling one location update are coalesced into one.
+final class RadarSyncStore: @unchecked Sendable {
+
+    let regionURL: URL
+    let trackingURL: URL
+    /// Single JSON file written by earlier SDK versions; migrated on first load.
+    let legacyURL: URL
+
+    private let queue: DispatchQueue
+    private let trackingStore: RadarFileStorageObject<RadarSyncTrackingState>
+    private var cache: RadarSyncState?
+    private var cacheLoaded = false
+    // bumped on every mutation so callers can cache values derived from the stored object
+    private var generation: UInt64 = 0
+    // region as last written to or loaded from disk, used to skip rewriting an unchanged region
+    private var persistedRegion: RadarSyncRegion?
+    private var regionWrites = 0
+    private var trackingWrites = 0
+
+    init(name: String = "radar_sync", trackingCoalescingInterval: TimeInterval = 1) {
+        self.queue = DispatchQueue(label: "io.radar.filestorage.\(name)", qos: .utility)
+
+        let appSupport = FileManager.default.urls(
+            for: .applicationSupportDirectory, in: .userDomainMask
+        ).first!
+        let dir = appSupport.appendingPathComponent("RadarSDK", isDirectory: true)
+
+        if !FileManager.default.fileExists(atPath: dir.path) {
+            try? FileManager.default.createDirectory(at: dir, withIntermediateDirectories: true)
+        }
+
+        var dirURL = dir
+        var values = URLResourceValues()
+        values.isExcludedFromBackup = true
+        try? dirURL.setResourceValues(values)
+
+        self.regionURL = dir.appendingPathComponent("\(name)_region.bin")
+        self.trackingURL = dir.appendingPathComponent("\(name)_tracking.json")
+        self.trackingStore = RadarFileStorageObject(
+            fileName: "\(name)_tracking.json", journaling: true, coalescingInterval: trackingCoalescingInterval
+        )
+        self.legacyURL = dir.appendingPathComponent("\(name)_state.json")
+    }
+
+    /// Number of times the region file has been written and the tracking state persisted by
+    /// this instance.
+    var writeCounts: (region: Int, tracking: Int) {
+        queue.sync { (regionWrites, trackingWrites) }
+    }
+
+    func read() -> RadarSyncState? {
+        queue.sync { loadCache() }
+    }
+
+    /// Reads the value together with the generation it was read at; the generation changes
+    /// whenever the stored value is written, modified or cleared.
+    func readVersioned() -> (value: RadarSyncState?, generation: UInt64) {
+        queue.sync { (loadCache(), generation) }
+    }
+
+    func write(_ value: RadarSyncState) {
+        queue.sync {
+            cache = value
+            cacheLoaded = true
+            generation &+= 1
+            persist(value)
+        }
+    }
+
+    func modify(_ transform: (inout RadarSyncState?) -> Void) {
+        queue.sync {
+            _ = loadCache()
+            transform(&cache)
+            generation &+= 1
+            if let cache = cache {
+                persist(cache)
+            } else {
+                removeFiles()
+            }
+        }
+    }
+
+    func clear() {
+        queue.sync {
+            cache = nil
+            cacheLoaded = true
+            generation &+= 1
+            removeFiles()
+        }
+    }
+
+    /// Tracking state writes requested and actually issued after coalescing.
+    var trackingWriteStats: (requested: Int, performed: Int) {
+        trackingStore.writeStats
+    }
+
+    /// Blocks until the tracking state written so far is on disk.
+    func flush() {
+        trackingStore.flush()
+    }
+
+    // MARK: - Persistence
+
+    private func loadCache() -> RadarSyncState? {
+        if cacheLoaded { return cache }
+        cacheLoaded = true
+
+        let storedTracking = trackingStore.read()
+        if !FileManager.default.fileExists(atPath: regionURL.path) && storedTracking == nil {
+            cache = migrateLegacyState()
+            return cache
+        }
+
+        var region = RadarSyncRegion()
+        if let data = try? Data(contentsOf: regionURL, options: .alwaysMapped) {
+            if let decoded = try? RadarSyncRegionArchive.decode(data) {
+                region = decoded
+                persistedRegion = decoded
+            } else {
+                // unreadable region, drop it so the next sync fetches a fresh one
+                try? FileManager.default.removeItem(at: regionURL)
+            }
+        }
+
+        cache = RadarSyncState(region: region, tracking: storedTracking ?? RadarSyncTrackingState())
+        return cache
+    }
+
+    private func migrateLegacyState() -> RadarSyncState? {
+        guard let data = try? Data(contentsOf: legacyURL) else { return nil }
+        let state = try? JSONDecoder().decode(RadarSyncState.self, from: data)
+        if let state {
+            persist(state)
+        }
+        try? FileManager.default.removeItem(at: legacyURL)
+        return state
+    }
+
+    private func persist(_ state: RadarSyncState) {
+        let region = state.region
+        if persistedRegion.map({ !Self.isSameRegion($0, region) }) ?? true {
+            let data = RadarSyncRegionArchive.encode(region)
+            try? data.write(to: regionURL, options: .atomic)
+            persistedRegion = region
+            regionWrites += 1
+        }
+
+        trackingStore.write(state.tracking)
+        trackingWrites += 1
+    }
+
+    private func removeFiles() {
+        persistedRegion = nil
+        try? FileManager.default.removeItem(at: regionURL)
+        trackingStore.clear()
+        try? FileManager.default.removeItem(at: legacyURL)
+    }
+
+    /// Tracking-state mutations copy the state but leave its region arrays untouched, so
+    /// comparing array storage is enough to tell whether the region needs rewriting.
+    private static func isSameRegion(_ lhs: RadarSyncRegion, _ rhs: RadarSyncRegion) -> Bool {
+        lhs.center == rhs.center && lhs.radius == rhs.radius && lhs.version == rhs.version
+            && sharesStorage(lhs.geofences, rhs.geofences)
+            && sharesStorage(lhs.places, rhs.places)
+            && sharesStorage(lhs.beacons, rhs.beacons)
+    }
+
+    private static func sharesStorage<Element>(_ lhs: [Element]?, _ rhs: [Element]?) -> Bool {
+        switch (lhs, rhs) {
+        case (nil, nil): return true
+        case (let lhs?, let rhs?): return lhs.sharesStorage(with: rhs)
+        default: return false
+        }
+    }
+}
+
+extension Array {
+    /// Whether both arrays are backed by the same copy-on-write buffer, which means their
+    /// contents are identical without comparing elements.
+    func sharesStorage(with other: [Element]) -> Bool {
+        guard count == other.count else { return false }
+        let lhs = withUnsafeBufferPointer { $0.baseAddress }
+        let rhs = other.withUnsafeBufferPointer { $0.baseAddress }
+        return lhs == rhs
+    }
+}
@@ -0,0 +1,54 @@
+//
+//  RadarTrackCoalescer.h
+//  RadarSDK
+//
+//  Copyright © 2026 Radar Labs, Inc. All rights reserved.
+//
+
+#import <CoreLocation/CoreLocation.h>
+#import <Foundation/Foundation.h>
+
+#import "RadarAPIClient.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+typedef void (^RadarTrackRequestBlock)(RadarTrackAPICompletionHandler completionHandler);
+
+/**
+ Shares one `/track` round trip between equivalent tracks requested at nearly the same time, e.g. by `trackOnce`, an indoor update and a beacon exit.
+
+ The first track for a key is sent; tracks with the same key that arrive while it is in flight, and within `window` seconds of it starting, wait for its result instead of
+ sending their own. Every completion handler gets the shared result.
+ */
+@interface RadarTrackCoalescer : NSObject
+
+@property (assign, atomic) NSTimeInterval window;
+
+/**
+ Tracks that joined a request already in flight instead of sending their own.
+ */
+@property (assign, atomic, readonly) NSUInteger coalescedCount;
+
+- (instancetype)initWithWindow:(NSTimeInterval)window;
+
+/**
+ A key equal for tracks that would send the same location, source and state, or nil for tracks that must not be shared, such as replays.
+ */
++ (NSString *_Nullable)keyForLocation:(CLLocation *)location
+                               source:(RadarLocationSource)source
+                              stopped:(BOOL)stopped
+                           foreground:(BOOL)foreground
+                             replayed:(BOOL)replayed
+                              beacons:(NSArray<RadarBeacon *> *_Nullable)beacons
+                       indoorLocation:(CLLocation *_Nullable)indoorLocation
+    NS_SWIFT_NAME(key(for:source:stopped:foreground:replayed:beacons:indoorLocation:));
+
+/**
+ Calls `request` to send the track, unless an equivalent one is in flight, and calls `completionHandler` with the result. A nil `key` always sends.
+ */
+- (void)coalesceTrackWithKey:(NSString *_Nullable)key request:(RadarTrackRequestBlock)request completionHandler:(RadarTrackAPICompletionHandler)completionHandler
+    NS_SWIFT_NAME(coalesceTrack(withKey:request:completionHandler:));
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,106 @@
+//
+//  RadarTrackCoalescer.m
+//  RadarSDK
+//
+//  Copyright © 2026 Radar Labs, Inc. All rights reserved.
+//
+
+#import "RadarTrackCoalescer.h"
+
+#import "RadarLogger.h"
+
+@interface RadarTrackFlight : NSObject
+
+@property (assign, nonatomic) NSTimeInterval startedAt;
+@property (strong, nonatomic) NSMutableArray<RadarTrackAPICompletionHandler> *completionHandlers;
+
+@end
+
+@implementation RadarTrackFlight
+@end
+
+@interface RadarTrackCoalescer ()
+
+@property (strong, nonatomic) NSMutableDictionary<NSString *, RadarTrackFlight *> *flights;
+@property (assign, atomic, readwrite) NSUInteger coalescedCount;
+
+@end
+
+@implementation RadarTrackCoalescer
+
+- (instancetype)initWithWindow:(NSTimeInterval)window {
+    self = [super init];
+    if (self) {
+        _window = window;
+        _flights = [NSMutableDictionary new];
+    }
+    return self;
+}
+
++ (NSString *)keyForLocation:(CLLocation *)location
+                      source:(RadarLocationSource)source
+                     stopped:(BOOL)stopped
+                  foreground:(BOOL)foreground
+                    replayed:(BOOL)replayed
+                     beacons:(NSArray<RadarBeacon *> *)beacons
+              indoorLocation:(CLLocation *)indoorLocation {
+    if (replayed) {
+        return nil;
+    }
+
+    // coordinates to about a meter, so two fixes of the same spot share a request
+    NSMutableString *key = [NSMutableString stringWithFormat:@"%@|%d|%d|%.5f,%.5f|%.0f", [Radar stringForLocationSource:source], stopped, foreground,
+                                                             location.coordinate.latitude, location.coordinate.longitude, location.horizontalAccuracy];
+    if (indoorLocation) {
+        [key appendFormat:@"|indoor=%.5f,%.5f", indoorLocation.coordinate.latitude, indoorLocation.coordinate.longitude];
+    }
+    if (beacons.count) {
+        NSMutableArray<NSString *> *beaconKeys = [NSMutableArray arrayWithCapacity:beacons.count];
+        for (RadarBeacon *beacon in beacons) {
+            [beaconKeys addObject:[NSString stringWithFormat:@"%@:%@:%@", beacon.uuid, beacon.major, beacon.minor]];
+        }
+        [key appendFormat:@"|beacons=%@", [[beaconKeys sortedArrayUsingSelector:@selector(compare:)] componentsJoinedByString:@","]];
+    }
+    return key;
+}
+
+- (void)coalesceTrackWithKey:(NSString *)key request:(RadarTrackRequestBlock)request completionHandler:(RadarTrackAPICompletionHandler)completionHandler {
+    if (!key) {
+        request(completionHandler);
+        return;
+    }
+
+    RadarTrackFlight *flight;
+    @synchronized(self) {
+        NSTimeInterval now = [NSProcessInfo processInfo].systemUptime;
+        RadarTrackFlight *inFlight = self.flights[key];
+        if (inFlight && now - inFlight.startedAt <= self.window) {
+            [inFlight.completionHandlers addObject:completionHandler];
+            self.coalescedCount += 1;
+            [[RadarLogger sharedInstance] logWithLevel:RadarLogLevelDebug message:[NSString stringWithFormat:@"Coalescing track with request in flight | key = %@", key]];
+            return;
+        }
+
+        flight = [RadarTrackFlight new];
+        flight.startedAt = now;
+        flight.completionHandlers = [NSMutableArray arrayWithObject:completionHandler];
+        self.flights[key] = flight;
+    }
+
+    request(^(RadarStatus status, NSDictionary *_Nullable res, NSArray<RadarEvent *> *_Nullable events, RadarTrackResponse *_Nullable response,
+              NSArray<RadarGeofence *> *_Nullable nearbyGeofences, RadarConfig *_Nullable config, RadarVerifiedLocationToken *_Nullable token) {
+        NSArray<RadarTrackAPICompletionHandler> *completionHandlers;
+        @synchronized(self) {
+            // a flight past its window may already have been replaced by a newer one
+            if (self.flights[key] == flight) {
+                [self.flights removeObjectForKey:key];
+            }
+            completionHandlers = [flight.completionHandlers copy];
+        }
+        for (RadarTrackAPICompletionHandler handler in completionHandlers) {
+            handler(status, res, events, response, nearbyGeofences, config, token);
+        }
+    });
+}
+
+@end
@@ -0,0 +1,42 @@
+//
+//  RadarTrackResponse.h
+//  RadarSDK
+//
+//  Copyright © 2026 Radar Labs, Inc. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+@class RadarUser;
+
+// a /track response whose events, user and nearby geofences are only built into model objects by the caller, when needed
+@interface RadarTrackResponse : NSObject
+
+@property (nonatomic, readonly, nullable) NSDictionary *userObject;
+@property (nonatomic, readonly, nullable) NSArray *eventsObject;
+@property (nonatomic, readonly, nullable) NSArray *nearbyGeofencesObject;
+@property (nonatomic, readonly) BOOL hasToken;
+
+// built on first read, then kept
+@property (nonatomic, readonly, nullable) RadarUser *user;
+@property (nonatomic, readonly, nullable) NSDictionary *tripObject;
+@property (nonatomic, readonly) BOOL userDebug;
+
+// ids read from the user without building a RadarUser
+@property (nonatomic, readonly) BOOL hasUser;
+@property (nonatomic, readonly) NSInteger eventCount;
+@property (nonatomic, readonly, nullable) NSString *userId;
+@property (nonatomic, readonly) NSArray<NSString *> *geofenceIds;
+@property (nonatomic, readonly, nullable) NSString *placeId;
+@property (nonatomic, readonly) NSArray<NSString *> *beaconIds;
+@property (nonatomic, readonly) NSArray<NSString *> *regionIds;
+@property (nonatomic, readonly) BOOL canExit;
+
+- (instancetype)initWithResponse:(NSDictionary *_Nullable)response;
+- (instancetype)initWithResponse:(NSDictionary *_Nullable)response locationMetadata:(NSDictionary *_Nullable)locationMetadata;
+
+@end
+
+NS_ASSUME_NONNULL_END
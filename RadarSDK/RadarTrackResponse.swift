@@ -0,0 +1,140 @@
+//
+//  RadarTrackResponse.swift
+//  RadarSDK
+//
+//  Copyright © 2026 Radar Labs, Inc. All rights reserved.
+//
+
+import Foundation
+
+/// The ids of the geofences, place, beacons and regions a `/track` user is in, which is all
+/// the SDK reads from the user to keep its own state.
+///
+/// Read straight from the parsed response, without building the geofence geometries, place
+/// chains, trip legs and metadata a full `RadarUser` carries.
+struct RadarTrackUserSummary: Equatable, Sendable {
+    static let regionKeys = ["country", "state", "dma", "postalCode"]
+
+    let id: String
+    let geofenceIds: [String]
+    let placeId: String?
+    let beaconIds: [String]
+    let regionIds: [String]
+    let hasTrip: Bool
+
+    init?(object: Any?) {
+        guard let user = object as? NSDictionary, let id = user["_id"] as? String else {
+            return nil
+        }
+        self.id = id
+        geofenceIds = Self.ids(user["geofences"])
+        placeId = Self.id(user["place"])
+        beaconIds = Self.ids(user["beacons"])
+        regionIds = Self.regionKeys.compactMap { Self.id(user[$0]) }
+        hasTrip = user["trip"] is NSDictionary
+    }
+
+    private static func id(_ object: Any?) -> String? {
+        (object as? NSDictionary)?["_id"] as? String
+    }
+
+    private static func ids(_ object: Any?) -> [String] {
+        guard let array = object as? NSArray else { return [] }
+        return array.compactMap { id($0) }
+    }
+}
+
+/// A `/track` response with its model objects left unbuilt.
+///
+/// The ids the SDK keeps state with are read up front into `summary`. Events, the user and
+/// nearby geofences stay as parsed JSON until a caller builds `RadarEvent`s, a `RadarUser`
+/// or `RadarGeofence`s from them, so a response without events or a verified token never
+/// builds them. The `RadarUser` is built on first read of `user`, once per response, and
+/// only by a completion handler or delegate that reads it.
+@objc(RadarTrackResponse)
+final class RadarTrackResponse: NSObject, @unchecked Sendable {
+
+    let summary: RadarTrackUserSummary?
+
+    @objc let userObject: NSDictionary?
+    @objc let eventsObject: NSArray?
+    @objc let nearbyGeofencesObject: NSArray?
+    /// Whether the response carries a verified location token.
+    @objc let hasToken: Bool
+
+    private let lock = NSLock()
+    private var builtUser: RadarUser??
+
+    @objc convenience init(response: NSDictionary?) {
+        self.init(response: response, locationMetadata: nil)
+    }
+
+    /// `locationMetadata` is set on the user as its `metadata`, the way the SDK reports it.
+    @objc init(response: NSDictionary?, locationMetadata: NSDictionary?) {
+        var userObject = response?["user"] as? NSDictionary
+        if let user = userObject, let locationMetadata {
+            let mutableUser = NSMutableDictionary(dictionary: user)
+            mutableUser["metadata"] = locationMetadata
+            userObject = mutableUser
+        }
+        self.userObject = userObject
+        eventsObject = response?["events"] as? NSArray
+        nearbyGeofencesObject = response?["nearbyGeofences"] as? NSArray
+        hasToken = response?["token"] is String
+        summary = RadarTrackUserSummary(object: userObject)
+        super.init()
+    }
+
+    /// The user, built from `userObject` the first time it is read.
+    @objc var user: RadarUser? {
+        lock.lock()
+        defer { lock.unlock() }
+        if let builtUser {
+            return builtUser
+        }
+        let user = summary != nil ? userObject.flatMap { RadarUser(object: $0) } : nil
+        builtUser = .some(user)
+        return user
+    }
+
+    @objc var tripObject: NSDictionary? {
+        userObject?["trip"] as? NSDictionary
+    }
+
+    @objc var userDebug: Bool {
+        (userObject?["debug"] as? NSNumber)?.boolValue ?? false
+    }
+
+    @objc var hasUser: Bool {
+        summary != nil
+    }
+
+    @objc var eventCount: Int {
+        eventsObject?.count ?? 0
+    }
+
+    @objc var userId: String? {
+        summary?.id
+    }
+
+    @objc var geofenceIds: [String] {
+        summary?.geofenceIds ?? []
+    }
+
+    @objc var placeId: String? {
+        summary?.placeId
+    }
+
+    @objc var beaconIds: [String] {
+        summary?.beaconIds ?? []
+    }
+
+    @objc var regionIds: [String] {
+        summary?.regionIds ?? []
+    }
+
+    /// Whether the user is in a geofence or at a place, so an exit can be detected.
+    @objc var canExit: Bool {
+        !geofenceIds.isEmpty || placeId != nil
+    }
+}
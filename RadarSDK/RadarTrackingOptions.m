@@ -6,6 +6,7 @@
 //
 
 #import "RadarTrackingOptions.h"
+#import "RadarEnumMapping.h"
 #import "RadarUtils.h"
 
 @implementation RadarTrackingOptions
@@ -34,6 +35,7 @@ NSString *const kUseMotion = @"useMotion";
 NSString *const kUsePressure = @"usePressure";
 NSString *const kBatchInterval = @"batchInterval";
 NSString *const kBatchSize = @"batchSize";
+NSString *const kBatchAdaptive = @"batchAdaptive";
 
 NSString *const kDesiredAccuracyHigh = @"high";
 NSString *const kDesiredAccuracyMedium = @"medium";
@@ -88,6 +90,7 @@ static const NSTimeInterval kRadarTrackingOptionsDateEpsilon = 0.001;
     options.usePressure = NO;
     options.batchInterval = 0;
     options.batchSize = 0;
+    options.batchAdaptive = NO;
     return options;
 }
 
@@ -117,6 +120,7 @@ static const NSTimeInterval kRadarTrackingOptionsDateEpsilon = 0.001;
     options.usePressure = NO;
     options.batchInterval = 0;
     options.batchSize = 0;
+    options.batchAdaptive = NO;
     return options;
 }
 
@@ -146,123 +150,98 @@ static const NSTimeInterval kRadarTrackingOptionsDateEpsilon = 0.001;
     options.usePressure = NO;
     options.batchInterval = 0;
     options.batchSize = 0;
+    options.batchAdaptive = NO;
     return options;
 }
 
++ (RadarEnumMapping *)desiredAccuracyMapping {
+    static RadarEnumMapping *mapping;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        RadarEnumMappingEntry entries[] = {
+            {RadarTrackingOptionsDesiredAccuracyHigh, kDesiredAccuracyHigh},
+            {RadarTrackingOptionsDesiredAccuracyMedium, kDesiredAccuracyMedium},
+            {RadarTrackingOptionsDesiredAccuracyLow, kDesiredAccuracyLow},
+        };
+        mapping = RadarEnumMappingMake(entries);
+    });
+    return mapping;
+}
+
 + (NSString *)stringForDesiredAccuracy:(RadarTrackingOptionsDesiredAccuracy)desiredAccuracy {
-    NSString *str;
-    switch (desiredAccuracy) {
-    case RadarTrackingOptionsDesiredAccuracyHigh:
-        str = kDesiredAccuracyHigh;
-        break;
-    case RadarTrackingOptionsDesiredAccuracyMedium:
-        str = kDesiredAccuracyMedium;
-        break;
-    case RadarTrackingOptionsDesiredAccuracyLow:
-        str = kDesiredAccuracyLow;
-        break;
-    default:
-        str = kDesiredAccuracyMedium;
-    }
-    return str;
+    return [[RadarTrackingOptions desiredAccuracyMapping] stringForValue:desiredAccuracy] ?: kDesiredAccuracyMedium;
 }
 
 + (RadarTrackingOptionsDesiredAccuracy)desiredAccuracyForString:(NSString *)str {
-    RadarTrackingOptionsDesiredAccuracy desiredAccuracy = RadarTrackingOptionsDesiredAccuracyMedium;
-    if ([str isEqualToString:kDesiredAccuracyHigh]) {
-        desiredAccuracy = RadarTrackingOptionsDesiredAccuracyHigh;
-    } else if ([str isEqualToString:kDesiredAccuracyLow]) {
-        desiredAccuracy = RadarTrackingOptionsDesiredAccuracyLow;
-    }
-    return desiredAccuracy;
+    return [[RadarTrackingOptions desiredAccuracyMapping] valueForString:str defaultValue:RadarTrackingOptionsDesiredAccuracyMedium];
+}
+
++ (RadarEnumMapping *)replayMapping {
+    static RadarEnumMapping *mapping;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        RadarEnumMappingEntry entries[] = {
+            {RadarTrackingOptionsReplayStops, kReplayStops},
+            {RadarTrackingOptionsReplayNone, kReplayNone},
+            {RadarTrackingOptionsReplayAll, kReplayAll},
+        };
+        mapping = RadarEnumMappingMake(entries);
+    });
+    return mapping;
 }
 
 + (NSString *)stringForReplay:(RadarTrackingOptionsReplay)replay {
-    NSString *str;
-    switch (replay) {
-    case RadarTrackingOptionsReplayStops:
-        str = kReplayStops;
-        break;
-    case RadarTrackingOptionsReplayAll:
-        str = kReplayAll;
-        break;
-    case RadarTrackingOptionsReplayNone:
-    default:
-        str = kReplayNone;
-    }
-    return str;
+    return [[RadarTrackingOptions replayMapping] stringForValue:replay] ?: kReplayNone;
 }
 
 + (RadarTrackingOptionsReplay)replayForString:(NSString *)str {
-    RadarTrackingOptionsReplay replay = RadarTrackingOptionsReplayNone;
-    if ([str isEqualToString:kReplayStops]) {
-        replay = RadarTrackingOptionsReplayStops;
-    } else if ([str isEqualToString:kReplayAll]) {
-        replay = RadarTrackingOptionsReplayAll;
-    }
-    return replay;
+    return [[RadarTrackingOptions replayMapping] valueForString:str defaultValue:RadarTrackingOptionsReplayNone];
+}
+
++ (RadarEnumMapping *)syncLocationsMapping {
+    static RadarEnumMapping *mapping;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        RadarEnumMappingEntry entries[] = {
+            {RadarTrackingOptionsSyncAll, kSyncAll},
+            {RadarTrackingOptionsSyncStopsAndExits, kSyncStopsAndExits},
+            {RadarTrackingOptionsSyncNone, kSyncNone},
+            {RadarTrackingOptionsSyncEvents, kSyncEvents},
+        };
+        mapping = RadarEnumMappingMake(entries);
+    });
+    return mapping;
 }
 
 + (NSString *)stringForSyncLocations:(RadarTrackingOptionsSyncLocations)sync {
-    NSString *str;
-    switch (sync) {
-    case RadarTrackingOptionsSyncNone:
-        str = kSyncNone;
-        break;
-    case RadarTrackingOptionsSyncStopsAndExits:
-        str = kSyncStopsAndExits;
-        break;
-    case RadarTrackingOptionsSyncEvents:
-        str = kSyncEvents;
-        break;
-    case RadarTrackingOptionsSyncAll:
-    default:
-        str = kSyncAll;
-    }
-    return str;
+    return [[RadarTrackingOptions syncLocationsMapping] stringForValue:sync] ?: kSyncAll;
 }
 
 + (RadarTrackingOptionsSyncLocations)syncLocationsForString:(NSString *)str {
-    RadarTrackingOptionsSyncLocations sync = RadarTrackingOptionsSyncAll;
-    if ([str isEqualToString:kSyncStopsAndExits]) {
-        sync = RadarTrackingOptionsSyncStopsAndExits;
-    } else if ([str isEqualToString:kSyncNone]) {
-        sync = RadarTrackingOptionsSyncNone;
-    } else if ([str isEqualToString:kSyncEvents]) {
-        sync = RadarTrackingOptionsSyncEvents;
-    }
-    return sync;
+    return [[RadarTrackingOptions syncLocationsMapping] valueForString:str defaultValue:RadarTrackingOptionsSyncAll];
+}
+
++ (RadarEnumMapping *)typeMapping {
+    static RadarEnumMapping *mapping;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        RadarEnumMappingEntry entries[] = {
+            {RadarTrackingOptionsTypeDefault, kTypeDefault},
+            {RadarTrackingOptionsTypeOnTrip, kTypeOnTrip},
+            {RadarTrackingOptionsTypeInGeofence, kTypeInGeofence},
+            {RadarTrackingOptionsTypeIsUser, kTypeIsUser},
+        };
+        mapping = RadarEnumMappingMake(entries);
+    });
+    return mapping;
 }
 
 + (NSString *)stringForType:(RadarTrackingOptionsType)type {
-    NSString *str;
-    switch (type) {
-        case RadarTrackingOptionsTypeOnTrip:
-            str = kTypeOnTrip;
-            break;
-        case RadarTrackingOptionsTypeInGeofence:
-            str = kTypeInGeofence;
-            break;
-        case RadarTrackingOptionsTypeIsUser:
-            str = kTypeIsUser;
-            break;
-        case RadarTrackingOptionsTypeDefault:
-        default:
-            str = kTypeDefault;
-    }
-    return str;
+    return [[RadarTrackingOptions typeMapping] stringForValue:type] ?: kTypeDefault;
 }
 
 + (RadarTrackingOptionsType)typeForString:(NSString *)str {
-    RadarTrackingOptionsType type = RadarTrackingOptionsTypeDefault;
-    if ([str isEqualToString:kTypeOnTrip]) {
-        type = RadarTrackingOptionsTypeOnTrip;
-    } else if ([str isEqualToString:kTypeInGeofence]) {
-        type = RadarTrackingOptionsTypeInGeofence;
-    } else if ([str isEqualToString:kTypeIsUser]) {
-        type = RadarTrackingOptionsTypeIsUser;
-    }
-    return type;
+    return [[RadarTrackingOptions typeMapping] valueForString:str defaultValue:RadarTrackingOptionsTypeDefault];
 }
 
 + (RadarTrackingOptions *)trackingOptionsFromDictionary:(NSDictionary *)dict {
@@ -282,7 +261,7 @@ static const NSTimeInterval kRadarTrackingOptionsDateEpsilon = 0.001;
         if ([startTrackingAfterObj isKindOfClass:[NSDate class]]) {
             options.startTrackingAfter = (NSDate *)startTrackingAfterObj;
         } else if ([startTrackingAfterObj isKindOfClass:[NSString class]]) {
-            options.startTrackingAfter = [RadarUtils.isoDateFormatter dateFromString:(NSString *)startTrackingAfterObj];
+            options.startTrackingAfter = [RadarUtils dateFromISOString:(NSString *)startTrackingAfterObj];
         } else if ([startTrackingAfterObj isKindOfClass:[NSNumber class]]) {
             double startTrackingAfterDouble = ((NSNumber *)startTrackingAfterObj).doubleValue / 1000;
             options.startTrackingAfter = [NSDate dateWithTimeIntervalSince1970:startTrackingAfterDouble];
@@ -293,7 +272,7 @@ static const NSTimeInterval kRadarTrackingOptionsDateEpsilon = 0.001;
         if ([stopTrackingAfterObj isKindOfClass:[NSDate class]]) {
             options.stopTrackingAfter = (NSDate *)stopTrackingAfterObj;
         } else if ([stopTrackingAfterObj isKindOfClass:[NSString class]]) {
-            options.stopTrackingAfter = [RadarUtils.isoDateFormatter dateFromString:(NSString *)stopTrackingAfterObj];
+            options.stopTrackingAfter = [RadarUtils dateFromISOString:(NSString *)stopTrackingAfterObj];
         } else if ([stopTrackingAfterObj isKindOfClass:[NSNumber class]]) {
             double stopTrackingAfterDouble = ((NSNumber *)stopTrackingAfterObj).doubleValue / 1000;
             options.stopTrackingAfter = [NSDate dateWithTimeIntervalSince1970:stopTrackingAfterDouble];
@@ -315,6 +294,7 @@ static const NSTimeInterval kRadarTrackingOptionsDateEpsilon = 0.001;
     options.usePressure = [dict[kUsePressure] boolValue];
     options.batchInterval = [dict[kBatchInterval] intValue];
     options.batchSize = [dict[kBatchSize] intValue];
+    options.batchAdaptive = [dict[kBatchAdaptive] boolValue];
     options.type = [RadarTrackingOptions typeForString:dict[kType]];
     return options;
 }
@@ -353,10 +333,42 @@ static const NSTimeInterval kRadarTrackingOptionsDateEpsilon = 0.001;
     dict[kUsePressure] = @(self.usePressure);
     dict[kBatchInterval] = @(self.batchInterval);
     dict[kBatchSize] = @(self.batchSize);
+    dict[kBatchAdaptive] = @(self.batchAdaptive);
     dict[kType] = [RadarTrackingOptions stringForType:self.type];
     return dict;
 }
 
+- (id)copyWithZone:(NSZone *)zone {
+    RadarTrackingOptions *options = [[[self class] allocWithZone:zone] init];
+    options.desiredStoppedUpdateInterval = self.desiredStoppedUpdateInterval;
+    options.desiredMovingUpdateInterval = self.desiredMovingUpdateInterval;
+    options.desiredSyncInterval = self.desiredSyncInterval;
+    options.desiredAccuracy = self.desiredAccuracy;
+    options.stopDuration = self.stopDuration;
+    options.stopDistance = self.stopDistance;
+    options.startTrackingAfter = self.startTrackingAfter;
+    options.stopTrackingAfter = self.stopTrackingAfter;
+    options.syncLocations = self.syncLocations;
+    options.replay = self.replay;
+    options.showBlueBar = self.showBlueBar;
+    options.useStoppedGeofence = self.useStoppedGeofence;
+    options.stoppedGeofenceRadius = self.stoppedGeofenceRadius;
+    options.useMovingGeofence = self.useMovingGeofence;
+    options.movingGeofenceRadius = self.movingGeofenceRadius;
+    options.syncGeofences = self.syncGeofences;
+    options.useVisits = self.useVisits;
+    options.useSignificantLocationChanges = self.useSignificantLocationChanges;
+    options.beacons = self.beacons;
+    options.useIndoorScan = self.useIndoorScan;
+    options.useMotion = self.useMotion;
+    options.usePressure = self.usePressure;
+    options.batchInterval = self.batchInterval;
+    options.batchSize = self.batchSize;
+    options.batchAdaptive = self.batchAdaptive;
+    options.type = self.type;
+    return options;
+}
+
 - (BOOL)isEqual:(id)object {
     if (!object) {
         return NO;
@@ -384,7 +396,7 @@ static const NSTimeInterval kRadarTrackingOptionsDateEpsilon = 0.001;
            self.useMovingGeofence == options.useMovingGeofence && self.movingGeofenceRadius == options.movingGeofenceRadius && self.syncGeofences == options.syncGeofences &&
            self.useVisits == options.useVisits && self.useSignificantLocationChanges == options.useSignificantLocationChanges && self.beacons == options.beacons &&
            self.useIndoorScan == options.useIndoorScan && self.useMotion == options.useMotion && self.usePressure == options.usePressure &&
-           self.batchInterval == options.batchInterval && self.batchSize == options.batchSize;
+           self.batchInterval == options.batchInterval && self.batchSize == options.batchSize && self.batchAdaptive == options.batchAdaptive;
 }
 
 @end
@@ -9,8 +9,12 @@
 #import "RadarTripLeg.h"
 #import <Foundation/Foundation.h>
 
+@class RadarEnumMapping;
+
 @interface RadarTrip ()
 
++ (RadarEnumMapping *_Nonnull)statusMapping;
+
 - (instancetype _Nullable)initWithId:(NSString *_Nonnull)_id
                           externalId:(NSString *_Nonnull)externalId
                             metadata:(NSDictionary *_Nullable)metadata
@@ -8,12 +8,31 @@
 #import "RadarTrip.h"
 #import "Radar.h"
 #import "RadarCoordinate+Internal.h"
+#import "RadarEnumMapping.h"
+#import "RadarRouteMode+Internal.h"
 #import "RadarTrip+Internal.h"
 #import "RadarTripLeg.h"
 #import "Include/RadarTripOrder.h"
 
 @implementation RadarTrip
 
++ (RadarEnumMapping *)statusMapping {
+    static RadarEnumMapping *mapping;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        RadarEnumMappingEntry entries[] = {
+            {RadarTripStatusStarted, @"started"},
+            {RadarTripStatusApproaching, @"approaching"},
+            {RadarTripStatusArrived, @"arrived"},
+            {RadarTripStatusExpired, @"expired"},
+            {RadarTripStatusCompleted, @"completed"},
+            {RadarTripStatusCanceled, @"canceled"},
+        };
+        mapping = RadarEnumMappingMake(entries);
+    });
+    return mapping;
+}
+
 - (instancetype _Nullable)initWithId:(NSString *_Nonnull)_id
                           externalId:(NSString *_Nonnull)externalId
                             metadata:(NSDictionary *_Nullable)metadata
@@ -125,18 +144,7 @@
 
     id modeObj = dict[@"mode"];
     if (modeObj && [modeObj isKindOfClass:[NSString class]]) {
-        NSString *modeStr = (NSString *)modeObj;
-        if ([modeStr isEqualToString:@"foot"]) {
-            mode = RadarRouteModeFoot;
-        } else if ([modeStr isEqualToString:@"bike"]) {
-            mode = RadarRouteModeBike;
-        } else if ([modeStr isEqualToString:@"truck"]) {
-            mode = RadarRouteModeTruck;
-        } else if ([modeStr isEqualToString:@"motorbike"]) {
-            mode = RadarRouteModeMotorbike;
-        } else {
-            mode = RadarRouteModeCar;
-        }
+        mode = [[RadarRouteModeUtils modeMapping] valueForString:modeObj defaultValue:RadarRouteModeCar];
     }
 
     id etaObj = dict[@"eta"];
@@ -154,20 +162,7 @@
 
     id statusObj = dict[@"status"];
     if (statusObj && [statusObj isKindOfClass:[NSString class]]) {
-        NSString *statusStr = (NSString *)statusObj;
-        if ([statusStr isEqualToString:@"started"]) {
-            status = RadarTripStatusStarted;
-        } else if ([statusStr isEqualToString:@"approaching"]) {
-            status = RadarTripStatusApproaching;
-        } else if ([statusStr isEqualToString:@"arrived"]) {
-            status = RadarTripStatusArrived;
-        } else if ([statusStr isEqualToString:@"expired"]) {
-            status = RadarTripStatusExpired;
-        } else if ([statusStr isEqualToString:@"completed"]) {
-            status = RadarTripStatusCompleted;
-        } else if ([statusStr isEqualToString:@"canceled"]) {
-            status = RadarTripStatusCanceled;
-        }
+        status = [[RadarTrip statusMapping] valueForString:statusObj defaultValue:RadarTripStatusUnknown];
     }
 
     id ordersObj = dict[@"orders"];
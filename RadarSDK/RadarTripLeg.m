@@ -6,6 +6,7 @@
 //
 
 #import "Include/RadarTripLeg.h"
+#import "RadarEnumMapping.h"
 #import "RadarUtils.h"
 
 @implementation RadarTripLeg {
@@ -39,70 +40,54 @@ static NSString *const kDistance = @"distance";
 
 #pragma mark - Status String Conversion
 
++ (RadarEnumMapping *)statusMapping {
+    static RadarEnumMapping *mapping;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        RadarEnumMappingEntry entries[] = {
+            {RadarTripLegStatusPending, @"pending"},
+            {RadarTripLegStatusStarted, @"started"},
+            {RadarTripLegStatusApproaching, @"approaching"},
+            {RadarTripLegStatusArrived, @"arrived"},
+            {RadarTripLegStatusCompleted, @"completed"},
+            {RadarTripLegStatusCanceled, @"canceled"},
+            {RadarTripLegStatusExpired, @"expired"},
+        };
+        mapping = RadarEnumMappingMake(entries);
+    });
+    return mapping;
+}
+
 + (NSString *)stringForStatus:(RadarTripLegStatus)status {
-    switch (status) {
-        case RadarTripLegStatusPending:
-            return @"pending";
-        case RadarTripLegStatusStarted:
-            return @"started";
-        case RadarTripLegStatusApproaching:
-            return @"approaching";
-        case RadarTripLegStatusArrived:
-            return @"arrived";
-        case RadarTripLegStatusCompleted:
-            return @"completed";
-        case RadarTripLegStatusCanceled:
-            return @"canceled";
-        case RadarTripLegStatusExpired:
-            return @"expired";
-        default:
-            return @"unknown";
-    }
+    return [[RadarTripLeg statusMapping] stringForValue:status] ?: @"unknown";
 }
 
 + (RadarTripLegStatus)statusForString:(NSString *)string {
-    if ([string isEqualToString:@"pending"]) {
-        return RadarTripLegStatusPending;
-    } else if ([string isEqualToString:@"started"]) {
-        return RadarTripLegStatusStarted;
-    } else if ([string isEqualToString:@"approaching"]) {
-        return RadarTripLegStatusApproaching;
-    } else if ([string isEqualToString:@"arrived"]) {
-        return RadarTripLegStatusArrived;
-    } else if ([string isEqualToString:@"completed"]) {
-        return RadarTripLegStatusCompleted;
-    } else if ([string isEqualToString:@"canceled"]) {
-        return RadarTripLegStatusCanceled;
-    } else if ([string isEqualToString:@"expired"]) {
-        return RadarTripLegStatusExpired;
-    }
-    return RadarTripLegStatusUnknown;
+    return [[RadarTripLeg statusMapping] valueForString:string defaultValue:RadarTripLegStatusUnknown];
 }
 
 #pragma mark - Destination Type String Conversion
 
++ (RadarEnumMapping *)destinationTypeMapping {
+    static RadarEnumMapping *mapping;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        RadarEnumMappingEntry entries[] = {
+            {RadarTripLegDestinationTypeGeofence, @"geofence"},
+            {RadarTripLegDestinationTypeAddress, @"address"},
+            {RadarTripLegDestinationTypeCoordinates, @"coordinates"},
+        };
+        mapping = RadarEnumMappingMake(entries);
+    });
+    return mapping;
+}
+
 + (NSString *)stringForDestinationType:(RadarTripLegDestinationType)destinationType {
-    switch (destinationType) {
-        case RadarTripLegDestinationTypeGeofence:
-            return @"geofence";
-        case RadarTripLegDestinationTypeAddress:
-            return @"address";
-        case RadarTripLegDestinationTypeCoordinates:
-            return @"coordinates";
-        default:
-            return @"unknown";
-    }
+    return [[RadarTripLeg destinationTypeMapping] stringForValue:destinationType] ?: @"unknown";
 }
 
 + (RadarTripLegDestinationType)destinationTypeForString:(NSString *)string {
-    if ([string isEqualToString:@"geofence"]) {
-        return RadarTripLegDestinationTypeGeofence;
-    } else if ([string isEqualToString:@"address"]) {
-        return RadarTripLegDestinationTypeAddress;
-    } else if ([string isEqualToString:@"coordinates"]) {
-        return RadarTripLegDestinationTypeCoordinates;
-    }
-    return RadarTripLegDestinationTypeUnknown;
+    return [[RadarTripLeg destinationTypeMapping] valueForString:string defaultValue:RadarTripLegDestinationTypeUnknown];
 }
 
 #pragma mark - Initializers
@@ -196,12 +181,12 @@ static NSString *const kDistance = @"distance";
 
     id createdAtObj = dict[kCreatedAt];
     if (createdAtObj && [createdAtObj isKindOfClass:[NSString class]]) {
-        leg->_createdAt = [RadarUtils.isoDateFormatter dateFromString:(NSString *)createdAtObj];
+        leg->_createdAt = [RadarUtils dateFromISOString:(NSString *)createdAtObj];
     }
 
     id updatedAtObj = dict[kUpdatedAt];
     if (updatedAtObj && [updatedAtObj isKindOfClass:[NSString class]]) {
-        leg->_updatedAt = [RadarUtils.isoDateFormatter dateFromString:(NSString *)updatedAtObj];
+        leg->_updatedAt = [RadarUtils dateFromISOString:(NSString *)updatedAtObj];
     }
 
     // Parse ETA object
@@ -368,10 +353,10 @@ static NSString *const kDistance = @"distance";
         dict[kStatus] = [RadarTripLeg stringForStatus:self.status];
     }
     if (self.createdAt) {
-        dict[kCreatedAt] = [RadarUtils.isoDateFormatter stringFromDate:self.createdAt];
+        dict[kCreatedAt] = [RadarUtils isoStringFromDate:self.createdAt];
     }
     if (self.updatedAt) {
-        dict[kUpdatedAt] = [RadarUtils.isoDateFormatter stringFromDate:self.updatedAt];
+        dict[kUpdatedAt] = [RadarUtils isoStringFromDate:self.updatedAt];
     }
 
     // Create nested destination structure to match API request format
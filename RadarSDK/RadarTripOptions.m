@@ -6,6 +6,8 @@
 //
 
 #import "RadarTripOptions.h"
+#import "RadarEnumMapping.h"
+#import "RadarRouteMode+Internal.h"
 #import "RadarTripLeg.h"
 #import "RadarUtils.h"
 
@@ -75,7 +77,7 @@ static NSString *const kLegs = @"legs";
     NSObject *scheduledArrivalAtObj = dict[kScheduledArrivalAt];
     if (scheduledArrivalAtObj) {
         if ([scheduledArrivalAtObj isKindOfClass:[NSString class]]) {
-            scheduledArrivalAt = [RadarUtils.isoDateFormatter dateFromString:(NSString *)scheduledArrivalAtObj];
+            scheduledArrivalAt = [RadarUtils dateFromISOString:(NSString *)scheduledArrivalAtObj];
         } else if ([scheduledArrivalAtObj isKindOfClass:[NSDate class]]) {
             scheduledArrivalAt = (NSDate *)scheduledArrivalAtObj;
         } else if ([scheduledArrivalAtObj isKindOfClass:[NSNumber class]]) {
@@ -88,18 +90,7 @@ static NSString *const kLegs = @"legs";
                                                destinationGeofenceExternalId:dict[kDestinationGeofenceExternalId]
                                                           scheduledArrivalAt:scheduledArrivalAt];
     options.metadata = dict[kMetadata];
-    NSString *modeStr = dict[kMode];
-    if ([modeStr isEqualToString:@"foot"]) {
-        options.mode = RadarRouteModeFoot;
-    } else if ([modeStr isEqualToString:@"bike"]) {
-        options.mode = RadarRouteModeBike;
-    } else if ([modeStr isEqualToString:@"truck"]) {
-        options.mode = RadarRouteModeTruck;
-    } else if ([modeStr isEqualToString:@"motorbike"]) {
-        options.mode = RadarRouteModeMotorbike;
-    } else {
-        options.mode = RadarRouteModeCar;
-    }
+    options.mode = [[RadarRouteModeUtils modeMapping] valueForString:dict[kMode] defaultValue:RadarRouteModeCar];
     options.approachingThreshold = [dict[kApproachingThreshold] intValue];
     options.startTracking = dict[kStartTracking] ? [dict[kStartTracking] boolValue] : YES;
 
@@ -118,7 +109,7 @@ static NSString *const kLegs = @"legs";
     dict[kDestinationGeofenceTag] = self.destinationGeofenceTag;
     dict[kDestinationGeofenceExternalId] = self.destinationGeofenceExternalId;
     dict[kMode] = [RadarRouteModeUtils stringForMode:self.mode];
-    dict[kScheduledArrivalAt] = [RadarUtils.isoDateFormatter stringFromDate:self.scheduledArrivalAt];
+    dict[kScheduledArrivalAt] = [RadarUtils isoStringFromDate:self.scheduledArrivalAt];
     if (self.approachingThreshold && self.approachingThreshold > 0) {
         dict[kApproachingThreshold] = @(self.approachingThreshold);
     }
@@ -131,6 +122,19 @@ static NSString *const kLegs = @"legs";
     return dict;
 }
 
+- (id)copyWithZone:(NSZone *)zone {
+    RadarTripOptions *options = [[[self class] allocWithZone:zone] initWithExternalId:self.externalId
+                                                                destinationGeofenceTag:self.destinationGeofenceTag
+                                                         destinationGeofenceExternalId:self.destinationGeofenceExternalId
+                                                                    scheduledArrivalAt:self.scheduledArrivalAt
+                                                                         startTracking:self.startTracking];
+    options.metadata = self.metadata;
+    options.mode = self.mode;
+    options.approachingThreshold = self.approachingThreshold;
+    options.legs = self.legs;
+    return options;
+}
+
 - (BOOL)isEqual:(id)object {
     if (!object) {
         return NO;
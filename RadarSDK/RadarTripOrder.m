@@ -6,6 +6,7 @@
 //
 
 #import "Include/RadarTripOrder.h"
+#import "RadarEnumMapping.h"
 #import "RadarUtils.h"
 
 @implementation RadarTripOrder
@@ -65,22 +66,13 @@
 
     id statusObj = dict[@"status"];
     if (statusObj && [statusObj isKindOfClass:[NSString class]]) {
-        NSString *statusStr = (NSString *)statusObj;
-        if ([statusStr isEqualToString:@"pending"]) {
-            status = RadarTripOrderStatusPending;
-        } else if ([statusStr isEqualToString:@"fired"]) {
-            status = RadarTripOrderStatusFired;
-        } else if ([statusStr isEqualToString:@"canceled"]) {
-            status = RadarTripOrderStatusCanceled;
-        } else if ([statusStr isEqualToString:@"completed"]) {
-            status = RadarTripOrderStatusCompleted;
-        }
+        status = [[RadarTripOrder statusMapping] valueForString:statusObj defaultValue:RadarTripOrderStatusUnknown];
     }
 
     id firedAtObj = dict[@"firedAt"];
     if (firedAtObj && [firedAtObj isKindOfClass:[NSString class]]) {
         NSString *firedAtStr = (NSString *)firedAtObj;
-        firedAt = [RadarUtils.isoDateFormatter dateFromString:firedAtStr];
+        firedAt = [RadarUtils dateFromISOString:firedAtStr];
     }
 
     id firedAttemptsObj = dict[@"firedAttempts"];
@@ -96,7 +88,7 @@
     id updatedAtObj = dict[@"updatedAt"];
     if (updatedAtObj && [updatedAtObj isKindOfClass:[NSString class]]) {
         NSString *updatedAtStr = (NSString *)updatedAtObj;
-        updatedAt = [RadarUtils.isoDateFormatter dateFromString:updatedAtStr];
+        updatedAt = [RadarUtils dateFromISOString:updatedAtStr];
     }
 
     if (_id && updatedAt) {
@@ -145,19 +137,23 @@
     return arr;
 }
 
++ (RadarEnumMapping *)statusMapping {
+    static RadarEnumMapping *mapping;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        RadarEnumMappingEntry entries[] = {
+            {RadarTripOrderStatusPending, @"pending"},
+            {RadarTripOrderStatusFired, @"fired"},
+            {RadarTripOrderStatusCanceled, @"canceled"},
+            {RadarTripOrderStatusCompleted, @"completed"},
+        };
+        mapping = RadarEnumMappingMake(entries);
+    });
+    return mapping;
+}
+
 + (NSString *)stringForStatus:(RadarTripOrderStatus)status {
-    switch (status) {
-    case RadarTripOrderStatusPending:
-        return @"pending";
-    case RadarTripOrderStatusFired:
-        return @"fired";
-    case RadarTripOrderStatusCanceled:
-        return @"canceled";
-    case RadarTripOrderStatusCompleted:
-        return @"completed";
-    default:
-        return @"unknown";
-    }
+    return [[RadarTripOrder statusMapping] stringForValue:status] ?: @"unknown";
 }
 
 - (NSDictionary *)dictionaryValue {
@@ -167,12 +163,12 @@
     [dict setValue:self.handoffMode forKey:@"handoffMode"];
     [dict setValue:[RadarTripOrder stringForStatus:self.status] forKey:@"status"];
     if (self.firedAt) {
-        NSString *firedAtString = [RadarUtils.isoDateFormatter stringFromDate:self.firedAt];
+        NSString *firedAtString = [RadarUtils isoStringFromDate:self.firedAt];
         [dict setValue:firedAtString forKey:@"firedAt"];
     }
     [dict setValue:self.firedAttempts forKey:@"firedAttempts"];
     [dict setValue:self.firedReason forKey:@"firedReason"];
-    NSString *updatedAtString = [RadarUtils.isoDateFormatter stringFromDate:self.updatedAt];
+    NSString *updatedAtString = [RadarUtils isoStringFromDate:self.updatedAt];
     [dict setValue:updatedAtString forKey:@"updatedAt"];
     return dict;
 }
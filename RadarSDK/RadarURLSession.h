@@ -0,0 +1,24 @@
+//
+//  RadarURLSession.h
+//  RadarSDK
+//
+//  Copyright © 2026 Radar Labs, Inc. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+@interface RadarURLSession : NSObject
+
+@property (class, nonatomic, readonly) RadarURLSession *shared;
+
+// the session every API request is sent through, so they share its connections; set timeouts per request
+@property (nonatomic, readonly) NSURLSession *session;
+
+// opens a connection to the API host ahead of the next request, unless one was used recently
+- (void)prewarm;
+
+@end
+
+NS_ASSUME_NONNULL_END
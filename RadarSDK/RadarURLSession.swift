@@ -0,0 +1,164 @@
+//
+//  RadarURLSession.swift
+//  RadarSDK
+//
+//  Copyright © 2026 Radar Labs, Inc. All rights reserved.
+//
+
+import Foundation
+
+/// Timings for one API request, taken from the last transaction of its `URLSessionTaskMetrics`.
+/// Phases that didn't happen, such as DNS, connect and TLS on a reused connection, are nil.
+struct RadarRequestMetrics: Equatable {
+    let path: String
+    let dns: TimeInterval?
+    let connect: TimeInterval?
+    let tls: TimeInterval?
+    let ttfb: TimeInterval?
+    let total: TimeInterval
+    let reusedConnection: Bool
+    let networkProtocol: String?
+
+    init(
+        path: String, dns: TimeInterval?, connect: TimeInterval?, tls: TimeInterval?, ttfb: TimeInterval?, total: TimeInterval, reusedConnection: Bool,
+        networkProtocol: String?
+    ) {
+        self.path = path
+        self.dns = dns
+        self.connect = connect
+        self.tls = tls
+        self.ttfb = ttfb
+        self.total = total
+        self.reusedConnection = reusedConnection
+        self.networkProtocol = networkProtocol
+    }
+
+    init?(_ metrics: URLSessionTaskMetrics) {
+        guard let transaction = metrics.transactionMetrics.last else { return nil }
+        self.init(
+            path: transaction.request.url?.path ?? "",
+            dns: Self.interval(transaction.domainLookupStartDate, transaction.domainLookupEndDate),
+            connect: Self.interval(transaction.connectStartDate, transaction.connectEndDate),
+            tls: Self.interval(transaction.secureConnectionStartDate, transaction.secureConnectionEndDate),
+            ttfb: Self.interval(transaction.requestStartDate, transaction.responseStartDate),
+            total: metrics.taskInterval.duration,
+            reusedConnection: transaction.isReusedConnection,
+            networkProtocol: transaction.networkProtocolName
+        )
+    }
+
+    static func interval(_ start: Date?, _ end: Date?) -> TimeInterval? {
+        guard let start, let end else { return nil }
+        return end.timeIntervalSince(start)
+    }
+
+    var logDescription: String {
+        func ms(_ interval: TimeInterval?) -> String {
+            interval.map { String(Int($0 * 1000)) } ?? "-"
+        }
+        return "path = \(path); protocol = \(networkProtocol ?? "unknown"); reused = \(reusedConnection); dnsMs = \(ms(dns)); connectMs = \(ms(connect)); "
+            + "tlsMs = \(ms(tls)); ttfbMs = \(ms(ttfb)); totalMs = \(ms(total))"
+    }
+}
+
+/// The one `URLSession` every API request goes through.
+///
+/// Sharing a session lets requests reuse its pooled HTTP/2 connection instead of each
+/// session opening its own, so timeouts are set per request rather than per session.
+/// `prewarm()` opens the connection ahead of the first request, and every request's
+/// timings are kept in `recentMetrics` and logged at debug level.
+@objc(RadarURLSession)
+final class RadarURLSession: NSObject, @unchecked Sendable {
+
+    @objc static let shared = RadarURLSession()
+
+    /// Requests are timed out individually: their `timeoutInterval` bounds idle time, and the API
+    /// helpers cancel a request still running after it. This only backs those up.
+    static let resourceTimeout: TimeInterval = 750
+    /// A connection used within this long is assumed to still be open, so isn't warmed again.
+    static let prewarmInterval: TimeInterval = 60
+    static let metricsCapacity = 20
+
+    @objc let session: URLSession
+
+    private let recorder: MetricsRecorder
+
+    override init() {
+        let config = URLSessionConfiguration.ephemeral
+        config.timeoutIntervalForResource = Self.resourceTimeout
+        recorder = MetricsRecorder(capacity: Self.metricsCapacity)
+        session = URLSession(configuration: config, delegate: recorder, delegateQueue: nil)
+        super.init()
+    }
+
+    /// Timings of the latest requests, oldest first.
+    var recentMetrics: [RadarRequestMetrics] {
+        recorder.recent
+    }
+
+    /// Opens a connection to the API host unless one was used recently.
+    @objc func prewarm() {
+        prewarm(host: RadarSettings.host)
+    }
+
+    /// Sends a `HEAD` to `host` to resolve, connect and complete the TLS handshake ahead of the
+    /// next request. Returns false, without sending, if a request finished or a warm-up was
+    /// sent in the last `prewarmInterval` seconds.
+    @discardableResult
+    func prewarm(host: String, now: TimeInterval = ProcessInfo.processInfo.systemUptime) -> Bool {
+        guard recorder.claimPrewarm(now: now, interval: Self.prewarmInterval), let url = URL(string: host) else {
+            return false
+        }
+
+        var request = URLRequest(url: url, cachePolicy: .reloadIgnoringLocalCacheData, timeoutInterval: 10)
+        request.httpMethod = "HEAD"
+        session.dataTask(with: request).resume()
+        return true
+    }
+
+    final class MetricsRecorder: NSObject, URLSessionTaskDelegate, @unchecked Sendable {
+
+        private let capacity: Int
+        private let lock = NSLock()
+        private var metrics = [RadarRequestMetrics]()
+        private var lastActivity: TimeInterval?
+
+        init(capacity: Int) {
+            self.capacity = max(capacity, 1)
+        }
+
+        var recent: [RadarRequestMetrics] {
+            lock.lock()
+            defer { lock.unlock() }
+            return metrics
+        }
+
+        func record(_ entry: RadarRequestMetrics, now: TimeInterval = ProcessInfo.processInfo.systemUptime) {
+            lock.lock()
+            if metrics.count == capacity {
+                metrics.removeFirst()
+            }
+            metrics.append(entry)
+            lastActivity = now
+            lock.unlock()
+        }
+
+        func claimPrewarm(now: TimeInterval, interval: TimeInterval) -> Bool {
+            lock.lock()
+            defer { lock.unlock() }
+            if let lastActivity, now - lastActivity < interval {
+                return false
+            }
+            lastActivity = now
+            return true
+        }
+
+        func urlSession(_ session: URLSession, task: URLSessionTask, didFinishCollecting metrics: URLSessionTaskMetrics) {
+            guard let entry = RadarRequestMetrics(metrics) else { return }
+            record(entry)
+            RadarLogger.shared.log(level: .debug) {
+                "📍 Radar API metrics | \(entry.logDescription)"
+            }
+        }
+    }
+}
@@ -10,8 +10,13 @@
 #import "RadarUser.h"
 #import <Foundation/Foundation.h>
 
+@class RadarEnumMapping;
+
 @interface RadarUser ()
 
++ (RadarEnumMapping *_Nonnull)activityTypeMapping;
++ (RadarEnumMapping *_Nonnull)sourceMapping;
+
 - (instancetype _Nullable)initWithId:(NSString *_Nonnull)_id
                               userId:(NSString *_Nullable)userId
                             deviceId:(NSString *_Nullable)deviceId
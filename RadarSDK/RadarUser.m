@@ -9,6 +9,7 @@
 #import "Radar.h"
 #import "RadarBeacon+Internal.h"
 #import "RadarChain+Internal.h"
+#import "RadarEnumMapping.h"
 #import "RadarFraud+Internal.h"
 #import "RadarGeofence+Internal.h"
 #import "RadarPlace+Internal.h"
@@ -72,6 +73,46 @@
 
 @implementation RadarUser
 
++ (RadarEnumMapping *)activityTypeMapping {
+    static RadarEnumMapping *mapping;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        RadarEnumMappingEntry entries[] = {
+            {RadarActivityTypeUnknown, @"unknown"},
+            {RadarActivityTypeStationary, @"stationary"},
+            {RadarActivityTypeFoot, @"foot"},
+            {RadarActivityTypeRun, @"run"},
+            {RadarActivityTypeBike, @"bike"},
+            {RadarActivityTypeCar, @"car"},
+        };
+        mapping = RadarEnumMappingMake(entries);
+    });
+    return mapping;
+}
+
++ (RadarEnumMapping *)sourceMapping {
+    static RadarEnumMapping *mapping;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        RadarEnumMappingEntry entries[] = {
+            {RadarLocationSourceForegroundLocation, @"FOREGROUND_LOCATION"},
+            {RadarLocationSourceBackgroundLocation, @"BACKGROUND_LOCATION"},
+            {RadarLocationSourceManualLocation, @"MANUAL_LOCATION"},
+            {RadarLocationSourceVisitArrival, @"VISIT_ARRIVAL"},
+            {RadarLocationSourceVisitDeparture, @"VISIT_DEPARTURE"},
+            {RadarLocationSourceGeofenceEnter, @"GEOFENCE_ENTER"},
+            {RadarLocationSourceGeofenceExit, @"GEOFENCE_EXIT"},
+            {RadarLocationSourceMockLocation, @"MOCK_LOCATION"},
+            {RadarLocationSourceBeaconEnter, @"BEACON_ENTER"},
+            {RadarLocationSourceBeaconExit, @"BEACON_EXIT"},
+            {RadarLocationSourceIndoors, @"INDOORS"},
+            {RadarLocationSourceUnknown, @"UNKNOWN"},
+        };
+        mapping = RadarEnumMappingMake(entries);
+    });
+    return mapping;
+}
+
 - (instancetype _Nullable)initWithId:(NSString *)_id
                               userId:(NSString *)userId
                             deviceId:(NSString *)deviceId
@@ -235,21 +276,7 @@
 
     id activityTypeObj = dict[@"activityType"];
     if (activityTypeObj && [activityTypeObj isKindOfClass:[NSString class]]) {
-        NSString *activityTypeStr = (NSString *)activityTypeObj;
-
-        if ([activityTypeStr isEqualToString:@"unknown"]) {
-            activityType = RadarActivityTypeUnknown;
-        } else if ([activityTypeStr isEqualToString:@"car"]) {
-            activityType = RadarActivityTypeCar;
-        } else if ([activityTypeStr isEqualToString:@"bike"]) {
-            activityType = RadarActivityTypeBike;
-        } else if ([activityTypeStr isEqualToString:@"foot"]) {
-            activityType = RadarActivityTypeFoot;
-        } else if ([activityTypeStr isEqualToString:@"run"]) {
-            activityType = RadarActivityTypeRun;
-        } else if ([activityTypeStr isEqualToString:@"stationary"]) {
-            activityType = RadarActivityTypeStationary;
-        }
+        activityType = [[RadarUser activityTypeMapping] valueForString:activityTypeObj defaultValue:RadarActivityTypeUnknown];
     }
 
 
@@ -328,25 +355,7 @@
 
     id sourceObj = dict[@"source"];
     if (sourceObj && [sourceObj isKindOfClass:[NSString class]]) {
-        NSString *sourceStr = (NSString *)sourceObj;
-
-        if ([sourceStr isEqualToString:@"FOREGROUND_LOCATION"]) {
-            source = RadarLocationSourceForegroundLocation;
-        } else if ([sourceStr isEqualToString:@"BACKGROUND_LOCATION"]) {
-            source = RadarLocationSourceBackgroundLocation;
-        } else if ([sourceStr isEqualToString:@"MANUAL_LOCATION"]) {
-            source = RadarLocationSourceManualLocation;
-        } else if ([sourceStr isEqualToString:@"GEOFENCE_ENTER"]) {
-            source = RadarLocationSourceGeofenceEnter;
-        } else if ([sourceStr isEqualToString:@"GEOFENCE_EXIT"]) {
-            source = RadarLocationSourceGeofenceExit;
-        } else if ([sourceStr isEqualToString:@"VISIT_ARRIVAL"]) {
-            source = RadarLocationSourceVisitArrival;
-        } else if ([sourceStr isEqualToString:@"VISIT_DEPARTURE"]) {
-            source = RadarLocationSourceVisitDeparture;
-        } else if ([sourceStr isEqualToString:@"MOCK_LOCATION"]) {
-            source = RadarLocationSourceMockLocation;
-        }
+        source = [[RadarUser sourceMapping] valueForString:sourceObj defaultValue:RadarLocationSourceUnknown];
     }
 
     id tripObj = dict[@"trip"];
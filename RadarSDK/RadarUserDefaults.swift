@@ -77,6 +77,9 @@ import Foundation
                 return UserDefaults.standard
             }
         }()
+        {
+            didSet { RadarSettingsCache.shared.invalidateAll() }
+        }
 
     /// The backing store the SDK persists to — the app-group suite when one is configured
     /// via `Radar.initializeWithAppGroup:`, otherwise `UserDefaults.standard`. Exposed to
@@ -98,11 +101,13 @@ import Foundation
             let value = source.value(forKey: key.rawValue)
             target.set(value, forKey: key.rawValue)
         }
+        RadarSettingsCache.shared.invalidateAll()
     }
 
     public static func set(_ value: Any?, forKey key: Key) {
         let target = userDefaults
         target.set(value, forKey: key.rawValue)
+        RadarSettingsCache.shared.invalidate(key)
         scheduleFlush(for: target)
     }
 
@@ -20,6 +20,10 @@ typedef NS_ENUM(NSInteger, RadarConnectionType) {
 
 @property (class, nonatomic, assign, readonly) NSDateFormatter *isoDateFormatter;
 
+// API timestamps, parsed and formatted without isoDateFormatter and safe to use from any thread
++ (nullable NSDate *)dateFromISOString:(nullable NSString *)string;
++ (nullable NSString *)isoStringFromDate:(nullable NSDate *)date;
+
 + (NSString *)deviceModel;
 
 + (NSString *)country;
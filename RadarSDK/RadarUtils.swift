@@ -238,6 +238,18 @@ class RadarUtils: NSObject {
         return formatter
     }()
 
+    /// Parses an API timestamp with `RadarISO8601`, which unlike `isoDateFormatter` is safe to use from any thread.
+    @objc(dateFromISOString:)
+    static func date(fromISOString string: String?) -> Date? {
+        string.flatMap(RadarISO8601.date(from:))
+    }
+
+    /// Formats `date` as `isoDateFormatter` does, with `RadarISO8601`.
+    @objc(isoStringFromDate:)
+    static func isoString(from date: Date?) -> String? {
+        date.map(RadarISO8601.string(from:))
+    }
+
     static func escapeNonAsciiCharacters(_ string: String) -> String {
         var escaped = ""
         escaped.reserveCapacity(string.utf16.count)
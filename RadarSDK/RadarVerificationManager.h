@@ -7,12 +7,17 @@
 //
 
 #import "Radar.h"
+#import "RadarStageTimings.h"
+#import "RadarVerifiedTokenCache.h"
 
 NS_ASSUME_NONNULL_BEGIN
 
 @interface RadarVerificationManager : NSObject
 
 @property (assign, nonatomic) BOOL started;
+// stage timings of the last verified track, for seeing where token latency goes
+@property (strong, atomic, readonly, nullable) RadarStageTimings *lastTrackVerifiedTimings;
+@property (strong, nonatomic, readonly) RadarVerifiedTokenCache *tokenCache;
 
 + (instancetype)sharedInstance;
 - (void)trackVerifiedWithCompletionHandler:(RadarTrackVerifiedCompletionHandler _Nullable)completionHandler;
@@ -18,8 +18,10 @@
 #import "RadarLocationManager.h"
 #import "RadarLogger.h"
 #import "RadarSettings.h"
+#import "RadarStageTimings.h"
 #import "RadarState.h"
 #import "RadarUtils.h"
+#import "RadarVerifiedTokenCache.h"
 #import "RadarSDKFraudProtocol.h"
 #import "RadarRevealRiskManager.h"
 
@@ -32,13 +34,12 @@
 @property (assign, nonatomic) BOOL startedBeacons;
 @property (strong, nonatomic) NSTimer *intervalTimer;
 @property (nonatomic, retain) nw_path_monitor_t monitor;
-@property (strong, nonatomic) RadarVerifiedLocationToken *lastToken;
-@property (assign, nonatomic) NSTimeInterval lastTokenSystemUptime;
-@property (assign, nonatomic) BOOL lastTokenBeacons;
+@property (strong, nonatomic, readwrite) RadarVerifiedTokenCache *tokenCache;
 @property (strong, nonatomic) NSString *lastIPs;
 @property (assign, nonatomic) NSTimeInterval lastIPChangeDeliveredAt;
 @property (copy, nonatomic) NSString *expectedCountryCode;
 @property (copy, nonatomic) NSString *expectedStateCode;
+@property (strong, atomic, readwrite, nullable) RadarStageTimings *lastTrackVerifiedTimings;
 
 @end
 
@@ -61,123 +62,166 @@
     return sharedInstance;
 }
 
+- (instancetype)init {
+    self = [super init];
+    if (self) {
+        _tokenCache = [RadarVerifiedTokenCache new];
+    }
+    return self;
+}
+
 - (void)trackVerifiedWithCompletionHandler:(RadarTrackVerifiedCompletionHandler)completionHandler {
     [self trackVerifiedWithBeacons:NO desiredAccuracy:RadarTrackingOptionsDesiredAccuracyMedium reason:nil transactionId:nil completionHandler:completionHandler];
 }
 
 - (void)trackVerifiedWithBeacons:(BOOL)beacons desiredAccuracy:(RadarTrackingOptionsDesiredAccuracy)desiredAccuracy reason:(NSString *)reason transactionId:(NSString *)transactionId completionHandler:(RadarTrackVerifiedCompletionHandler)completionHandler {
+    [self trackVerifiedWithBeacons:beacons desiredAccuracy:desiredAccuracy reason:reason transactionId:transactionId reportFailures:YES completionHandler:completionHandler];
+}
+
+// reportFailures is NO for background token refreshes, whose failures no caller asked about
+- (void)trackVerifiedWithBeacons:(BOOL)beacons
+                 desiredAccuracy:(RadarTrackingOptionsDesiredAccuracy)desiredAccuracy
+                          reason:(NSString *)reason
+                   transactionId:(NSString *)transactionId
+                  reportFailures:(BOOL)reportFailures
+               completionHandler:(RadarTrackVerifiedCompletionHandler)completionHandler {
     if (!reason) {
         reason = @"manual";
     }
     
     BOOL lastTokenBeacons = beacons;
-    
-    // Capture foreground state on main thread before entering background thread context
+    BOOL autoFailover = [RadarSettings initializeOptions].trackVerifiedAutoFailover;
+    RadarStageTimings *timings = [RadarStageTimings new];
+
+    void (^finish)(RadarStatus, RadarVerifiedLocationToken *_Nullable, BOOL) = ^(RadarStatus status, RadarVerifiedLocationToken *_Nullable token, BOOL notifyFailure) {
+        [timings finish];
+        self.lastTrackVerifiedTimings = timings;
+        [[RadarLogger sharedInstance] logWithLevel:RadarLogLevelDebug
+                                      messageBlock:^NSString * {
+                                          return [NSString stringWithFormat:@"Track verified timings | status = %@; %@", [Radar stringForStatus:status], [timings logDescription]];
+                                      }];
+
+        [RadarUtilsDeprecated runOnMainThread:^{
+            if (reportFailures && notifyFailure && status != RadarStatusSuccess) {
+                [[RadarDelegateHolder sharedInstance] didFailWithStatus:status];
+            }
+
+            if (completionHandler) {
+                completionHandler(status, token);
+            }
+        }];
+    };
+
+    // only the fraud payload needs both the config nonce and the location, so the config, location, foreground state and beacon ranging are
+    // all started at once and the fraud payload waits for them to finish
+    dispatch_group_t inputs = dispatch_group_create();
+    dispatch_group_t rangedBeacons = dispatch_group_create();
+
     __block BOOL foreground = NO;
-    if ([NSThread isMainThread]) {
+    dispatch_group_enter(inputs);
+    [RadarUtilsDeprecated runOnMainThread:^{
         foreground = [RadarUtilsDeprecated foreground];
-    } else {
-        dispatch_sync(dispatch_get_main_queue(), ^{
-            foreground = [RadarUtilsDeprecated foreground];
-        });
+        dispatch_group_leave(inputs);
+    }];
+
+    __block RadarStatus configStatus = RadarStatusErrorUnknown;
+    __block RadarConfig *config = nil;
+    __block BOOL useSecondaryVerifiedHost = NO;
+    dispatch_group_enter(inputs);
+    [timings startStage:@"config"];
+    [self getVerifiedConfigWithAutoFailover:autoFailover
+                          completionHandler:^(RadarStatus status, RadarConfig *_Nullable verifiedConfig, BOOL secondary) {
+                              [timings endStage:@"config"];
+                              configStatus = status;
+                              config = verifiedConfig;
+                              useSecondaryVerifiedHost = secondary;
+                              dispatch_group_leave(inputs);
+                          }];
+
+    __block RadarStatus locationStatus = RadarStatusErrorUnknown;
+    __block CLLocation *location = nil;
+    __block NSArray<RadarBeacon *> *trackBeacons = nil;
+    dispatch_group_enter(inputs);
+    if (beacons) {
+        dispatch_group_enter(rangedBeacons);
     }
-    
-    BOOL autoFailover = [RadarSettings initializeOptions].trackVerifiedAutoFailover;
+    [timings startStage:@"location"];
+    [[RadarLocationManager sharedInstance]
+     getLocationWithDesiredAccuracy:desiredAccuracy
+     completionHandler:^(RadarStatus status, CLLocation *_Nullable currentLocation, BOOL stopped) {
+        [timings endStage:@"location"];
+        locationStatus = status;
+        location = currentLocation;
+
+        if (beacons) {
+            if (status == RadarStatusSuccess) {
+                [timings startStage:@"beacons"];
+                [self rangeBeaconsNear:currentLocation
+                     completionHandler:^(NSArray<RadarBeacon *> *_Nullable ranged) {
+                         [timings endStage:@"beacons"];
+                         trackBeacons = ranged;
+                         dispatch_group_leave(rangedBeacons);
+                     }];
+            } else {
+                dispatch_group_leave(rangedBeacons);
+            }
+        }
 
-    void (^continueWithConfig)(RadarStatus, RadarConfig * _Nullable, BOOL) =
-    ^(RadarStatus status, RadarConfig * _Nullable config, BOOL useSecondaryVerifiedHost) {
-        if (status != RadarStatusSuccess || !config) {
-            [RadarUtilsDeprecated runOnMainThread:^{
-                if (status != RadarStatusSuccess) {
-                    [[RadarDelegateHolder sharedInstance] didFailWithStatus:status];
-                }
+        dispatch_group_leave(inputs);
+    }];
 
-                if (completionHandler) {
-                    completionHandler(status, nil);
-                }
-            }];
+    dispatch_group_notify(inputs, dispatch_get_main_queue(), ^{
+        if (configStatus != RadarStatusSuccess || !config) {
+            finish(configStatus, nil, YES);
+            return;
+        }
 
+        if (locationStatus != RadarStatusSuccess) {
+            finish(locationStatus, nil, YES);
             return;
         }
 
-        [[RadarLocationManager sharedInstance]
-         getLocationWithDesiredAccuracy:desiredAccuracy
-         completionHandler:^(RadarStatus status, CLLocation *_Nullable location, BOOL stopped) {
-            if (status != RadarStatusSuccess) {
-                [RadarUtilsDeprecated runOnMainThread:^{
-                    [[RadarDelegateHolder sharedInstance] didFailWithStatus:status];
-                    
-                    if (completionHandler) {
-                        completionHandler(status, nil);
-                    }
-                }];
-                
-                return;
-            }
-            
-            Class RadarSDKFraud = NSClassFromString(@"RadarSDKFraud");
-            if (!RadarSDKFraud) {
-                [RadarUtilsDeprecated runOnMainThread:^{
-                    [[RadarDelegateHolder sharedInstance] didFailWithStatus:RadarStatusErrorPlugin];
-                    
-                    if (completionHandler) {
-                        completionHandler(RadarStatusErrorPlugin, nil);
-                    }
-                }];
-                return;
-            }
+        // TODO: migrate to swift and use RadarSDKFraud in swift.
+        Class RadarSDKFraud = NSClassFromString(@"RadarSDKFraud");
+        if (!RadarSDKFraud) {
+            finish(RadarStatusErrorPlugin, nil, YES);
+            return;
+        }
+        if (![RadarSDKFraud respondsToSelector:@selector(sharedInstance)] ||
+            ![[RadarSDKFraud sharedInstance] respondsToSelector:@selector(getFraudPayloadWithOptions:completionHandler:)]) {
+            finish(RadarStatusErrorPlugin, nil, NO);
+            return;
+        }
 
-            NSMutableDictionary *options = [NSMutableDictionary dictionary];
-            if (location) {
-                options[@"location"] = location;
-            }
-            if (config.nonce) {
-                options[@"nonce"] = config.nonce;
-            }
-            // TODO: migrate to swift and use RadarSDKFraud in swift.
-            if (![RadarSDKFraud respondsToSelector:@selector(sharedInstance)]) {
-                completionHandler(RadarStatusErrorPlugin, nil);
-                return;
-            }
-            if (![[RadarSDKFraud sharedInstance] respondsToSelector:@selector(getFraudPayloadWithOptions:completionHandler:)]) {
-                completionHandler(RadarStatusErrorPlugin, nil);
+        NSMutableDictionary *options = [NSMutableDictionary dictionary];
+        if (location) {
+            options[@"location"] = location;
+        }
+        if (config.nonce) {
+            options[@"nonce"] = config.nonce;
+        }
+
+        [timings startStage:@"fraud"];
+        [[RadarSDKFraud sharedInstance] getFraudPayloadWithOptions:options completionHandler:^(NSDictionary<NSString *, id> *_Nullable result) {
+            [timings endStage:@"fraud"];
+            if (!result || result[@"error"]) {
+                finish(RadarStatusErrorUnknown, nil, YES);
                 return;
             }
-            [[RadarSDKFraud sharedInstance] getFraudPayloadWithOptions:options completionHandler:^(NSDictionary<NSString *, id> *_Nullable result) {
-                if (!result) {
-                    [RadarUtilsDeprecated runOnMainThread:^{
-                        [[RadarDelegateHolder sharedInstance] didFailWithStatus:RadarStatusErrorUnknown];
-                        
-                        if (completionHandler) {
-                            completionHandler(RadarStatusErrorUnknown, nil);
-                        }
-                    }];
-                    return;
-                }
-                
-                NSString *error = result[@"error"];
-                if (error) {
-                    [RadarUtilsDeprecated runOnMainThread:^{
-                        [[RadarDelegateHolder sharedInstance] didFailWithStatus:RadarStatusErrorUnknown];
-                        
-                        if (completionHandler) {
-                            completionHandler(RadarStatusErrorUnknown, nil);
-                        }
-                    }];
-                    return;
-                }
-                
-                NSString *fraudPayload = result[@"payload"];
+
+            NSString *fraudPayload = result[@"payload"];
+
+            dispatch_group_notify(rangedBeacons, dispatch_get_main_queue(), ^{
                 NSString *revealRiskId = [RadarRevealRiskManager shared].revealRiskId;
-                
-                void (^callTrackAPI)(NSArray<RadarBeacon *> *_Nullable) = ^(NSArray<RadarBeacon *> *_Nullable beacons) {
+
+                [timings startStage:@"track"];
                 [[RadarAPIClient sharedInstance]
                  trackWithLocation:location
                  stopped:RadarState.stopped
                  foreground:foreground
                  source:RadarLocationSourceForegroundLocation
                  replayed:NO
-                 beacons:beacons
+                 beacons:trackBeacons
                  indoorLocation:nil
                  verified:YES
                  fraudPayload:fraudPayload
@@ -188,84 +232,33 @@
                  revealRiskId:revealRiskId
                  useSecondaryVerifiedHost:useSecondaryVerifiedHost
                  completionHandler:^(RadarStatus status, NSDictionary *_Nullable res, NSArray<RadarEvent *> *_Nullable events,
-                                     RadarUser *_Nullable user, NSArray<RadarGeofence *> *_Nullable nearbyGeofences,
+                                     RadarTrackResponse *_Nullable response, NSArray<RadarGeofence *> *_Nullable nearbyGeofences,
                                      RadarConfig *_Nullable config, RadarVerifiedLocationToken *_Nullable token) {
+                    [timings endStage:@"track"];
                     if (status == RadarStatusSuccess && config != nil) {
                         [RadarRevealRiskManager shared].revealRiskId = nil;
                         [[RadarLocationManager sharedInstance] updateTrackingFromMeta:config.meta];
                     }
                     
                     if (token) {
-                        self.lastToken = token;
-                        self.lastTokenSystemUptime = [NSProcessInfo processInfo].systemUptime;
-                        self.lastTokenBeacons = lastTokenBeacons;
+                        [self.tokenCache storeToken:token beacons:lastTokenBeacons desiredAccuracy:desiredAccuracy];
                     }
                     
-                    [RadarUtilsDeprecated runOnMainThread:^{
-                        if (status != RadarStatusSuccess) {
-                            [[RadarDelegateHolder sharedInstance] didFailWithStatus:status];
-                        }
-                        
-                        if (completionHandler) {
-                            completionHandler(status, token);
-                        }
-                        }];
-                    }];
-                };
-            
-            if (beacons) {
-                [[RadarAPIClient sharedInstance]
-                     searchBeaconsNear:location
-                     radius:1000
-                     limit:10
-                     completionHandler:^(RadarStatus status, NSDictionary *_Nullable res, NSArray<RadarBeacon *> *_Nullable beacons,
-                                         NSArray<NSString *> *_Nullable beaconUUIDs) {
-                        if (beaconUUIDs && beaconUUIDs.count) {
-                            [RadarUtilsDeprecated runOnMainThread:^{
-                                [[RadarBeaconManagerSwift shared]
-                                 rangeBeaconUUIDs:beaconUUIDs
-                                 completionHandler:^(RadarStatus status, NSArray<RadarBeacon *> *_Nullable beacons) {
-                                    if (status != RadarStatusSuccess || !beacons) {
-                                        callTrackAPI(nil);
-                                        
-                                        return;
-                                    }
-                                    
-                                    callTrackAPI(beacons);
-                                }];
-                            }];
-                        } else if (beacons && beacons.count) {
-                            [RadarUtilsDeprecated runOnMainThread:^{
-                                [[RadarBeaconManagerSwift shared]
-                                 rangeBeacons:beacons
-                                 completionHandler:^(RadarStatus status, NSArray<RadarBeacon *> *_Nullable beacons) {
-                                    if (status != RadarStatusSuccess || !beacons) {
-                                        callTrackAPI(nil);
-                                        
-                                        return;
-                                    }
-                                    
-                                    callTrackAPI(beacons);
-                                }];
-                            }];
-                        } else {
-                            callTrackAPI(@[]);
-                        }
-                    }];
-                } else {
-                    callTrackAPI(nil);
-                }
-            }];
+                    finish(status, token, YES);
+                }];
+            });
         }];
-    };
+    });
+}
 
+- (void)getVerifiedConfigWithAutoFailover:(BOOL)autoFailover completionHandler:(void (^)(RadarStatus status, RadarConfig *_Nullable config, BOOL useSecondaryVerifiedHost))completionHandler {
     [[RadarAPIClient sharedInstance]
      getConfigForUsage:@"verify"
      verified:YES
      completionHandler:^(RadarStatus status, RadarConfig * _Nullable config) {
         BOOL primaryRadarResponse = (config && config.meta);
         if (!autoFailover || primaryRadarResponse) {
-            continueWithConfig(status, config, NO);
+            completionHandler(status, config, NO);
             return;
         }
 
@@ -278,11 +271,41 @@
          verified:YES
          useSecondaryVerifiedHost:YES
          completionHandler:^(RadarStatus status2, RadarConfig * _Nullable config2) {
-            continueWithConfig(status2, config2, YES);
+            completionHandler(status2, config2, YES);
         }];
     }];
 }
 
+// nil if ranging failed, empty if there were no beacons nearby to range
+- (void)rangeBeaconsNear:(CLLocation *)location completionHandler:(void (^)(NSArray<RadarBeacon *> *_Nullable beacons))completionHandler {
+    [[RadarAPIClient sharedInstance]
+         searchBeaconsNear:location
+         radius:1000
+         limit:10
+         completionHandler:^(RadarStatus status, NSDictionary *_Nullable res, NSArray<RadarBeacon *> *_Nullable beacons,
+                             NSArray<NSString *> *_Nullable beaconUUIDs) {
+            if (beaconUUIDs && beaconUUIDs.count) {
+                [RadarUtilsDeprecated runOnMainThread:^{
+                    [[RadarBeaconManagerSwift shared]
+                     rangeBeaconUUIDs:beaconUUIDs
+                     completionHandler:^(RadarStatus status, NSArray<RadarBeacon *> *_Nullable beacons) {
+                        completionHandler(status == RadarStatusSuccess ? beacons : nil);
+                    }];
+                }];
+            } else if (beacons && beacons.count) {
+                [RadarUtilsDeprecated runOnMainThread:^{
+                    [[RadarBeaconManagerSwift shared]
+                     rangeBeacons:beacons
+                     completionHandler:^(RadarStatus status, NSArray<RadarBeacon *> *_Nullable beacons) {
+                        completionHandler(status == RadarStatusSuccess ? beacons : nil);
+                    }];
+                }];
+            } else {
+                completionHandler(@[]);
+            }
+        }];
+}
+
 - (void)intervalFired {
     [[RadarLogger sharedInstance] logWithLevel:RadarLogLevelDebug message:@"Token request interval fired"];
     
@@ -292,17 +315,17 @@
 - (void)scheduleNextIntervalWithLastToken {
     NSTimeInterval minInterval = self.startedInterval;
     
-    if (self.lastToken) {
-        NSTimeInterval lastTokenElapsed = [NSProcessInfo processInfo].systemUptime - self.lastTokenSystemUptime;
+    if (self.tokenCache.token) {
+        NSTimeInterval timeUntilExpiry = [self.tokenCache timeUntilExpiry];
         
-        // if expiresIn - lastTokenElapsed is shorter than interval, override interval
-        minInterval = MIN(self.lastToken.expiresIn - lastTokenElapsed, self.startedInterval);
+        // if the token expires before interval, override interval
+        minInterval = MIN(timeUntilExpiry, self.startedInterval);
         
-        [[RadarLogger sharedInstance] logWithLevel:RadarLogLevelDebug message:[NSString stringWithFormat:@"Calculated next interval | minInterval = %f; expiresIn = %f; lastTokenElapsed = %f, startedInterval = %f", minInterval, self.lastToken.expiresIn, lastTokenElapsed,  self.startedInterval]];
+        [[RadarLogger sharedInstance] logWithLevel:RadarLogLevelDebug message:[NSString stringWithFormat:@"Calculated next interval | minInterval = %f; expiresIn = %f; timeUntilExpiry = %f, startedInterval = %f", minInterval, self.tokenCache.token.expiresIn, timeUntilExpiry,  self.startedInterval]];
     }
     
-    // re-request early to maximize the likelihood that a cached token is available
-    NSTimeInterval interval = minInterval - 10;
+    // re-request early enough, given how long recent requests took, that a cached token is available
+    NSTimeInterval interval = minInterval - [self.tokenCache refreshLeadTime];
     
     // min interval is 10 seconds
     if (interval < 10) {
@@ -325,9 +348,20 @@
         return;
     }
     
-    [self trackVerifiedWithBeacons:self.startedBeacons desiredAccuracy:RadarTrackingOptionsDesiredAccuracyHigh reason:reason transactionId:nil completionHandler:^(RadarStatus status, RadarVerifiedLocationToken *_Nullable token) {
-        [self scheduleNextIntervalWithLastToken];
-    }];
+    // joins a refresh already started by getVerifiedLocationToken instead of sending a second verified track
+    BOOL beacons = self.startedBeacons;
+    [self.tokenCache refreshWithBeacons:beacons
+                        desiredAccuracy:RadarTrackingOptionsDesiredAccuracyHigh
+                                  block:^(BOOL background, RadarTrackVerifiedCompletionHandler completionHandler) {
+                                      [self trackVerifiedWithBeacons:beacons
+                                                     desiredAccuracy:RadarTrackingOptionsDesiredAccuracyHigh
+                                                              reason:reason
+                                                       transactionId:nil
+                                                   completionHandler:completionHandler];
+                                  }
+                      completionHandler:^(RadarStatus status, RadarVerifiedLocationToken *_Nullable token) {
+                          [self scheduleNextIntervalWithLastToken];
+                      }];
 }
 
 - (void)startTrackingVerifiedWithInterval:(NSTimeInterval)interval beacons:(BOOL)beacons {
@@ -345,7 +379,7 @@
     
     [self updateMonitoringState];
 
-    if ([self isLastTokenValid]) {
+    if ([self.tokenCache validTokenWithBeacons:beacons desiredAccuracy:RadarTrackingOptionsDesiredAccuracyHigh]) {
         [self scheduleNextIntervalWithLastToken];
     } else {
         [self callTrackVerifiedWithReason:@"start"];
@@ -367,42 +401,32 @@
 }
 
 - (void)getVerifiedLocationTokenWithBeacons:(BOOL)beacons desiredAccuracy:(RadarTrackingOptionsDesiredAccuracy)desiredAccuracy completionHandler:(RadarTrackVerifiedCompletionHandler)completionHandler {
-    if ([self isLastTokenValid]) {
-        [Radar flushLogs];
-        
-        return completionHandler(RadarStatusSuccess, self.lastToken);
-    }
-    
-    [self trackVerifiedWithBeacons:beacons desiredAccuracy:desiredAccuracy reason:@"last_token_invalid" transactionId:nil completionHandler:completionHandler];
+    // a token expiring soon is still served, and refreshed in the background for the next call
+    [self.tokenCache
+        getTokenWithBeacons:beacons
+            desiredAccuracy:desiredAccuracy
+                    refresh:^(BOOL background, RadarTrackVerifiedCompletionHandler refreshCompletionHandler) {
+                        NSString *reason = background ? @"last_token_expiring" : @"last_token_invalid";
+                        [self trackVerifiedWithBeacons:beacons
+                                       desiredAccuracy:desiredAccuracy
+                                                reason:reason
+                                         transactionId:nil
+                                        reportFailures:!background
+                                     completionHandler:refreshCompletionHandler];
+                    }
+          completionHandler:^(RadarStatus status, RadarVerifiedLocationToken *_Nullable token, BOOL cached) {
+              if (cached) {
+                  [Radar flushLogs];
+              }
+
+              if (completionHandler) {
+                  completionHandler(status, token);
+              }
+          }];
 }
 
 - (void)clearVerifiedLocationToken {
-    self.lastToken = nil;
-}
-
-- (BOOL)isLastTokenValid {
-    if (!self.lastToken) {
-        return NO;
-    }
-
-    NSTimeInterval lastTokenElapsed = [NSProcessInfo processInfo].systemUptime - self.lastTokenSystemUptime;
-    double lastDistanceToStateBorder = -1;
-    if (self.lastToken.user && self.lastToken.user.state) {
-        lastDistanceToStateBorder = self.lastToken.user.state.distanceToBorder;
-    }
-
-    BOOL lastTokenValid =
-        (lastTokenElapsed < self.lastToken.expiresIn) &&
-        self.lastToken.passed &&
-        (lastDistanceToStateBorder > 1609);
-
-    if (lastTokenValid) {
-        [[RadarLogger sharedInstance] logWithLevel:RadarLogLevelDebug message:[NSString stringWithFormat:@"Last token valid | lastToken.expiresIn = %f; lastTokenElapsed = %f; lastToken.passed = %d; lastDistanceToStateBorder = %f", self.lastToken.expiresIn, lastTokenElapsed, self.lastToken.passed, lastDistanceToStateBorder]];
-    } else {
-        [[RadarLogger sharedInstance] logWithLevel:RadarLogLevelDebug message:[NSString stringWithFormat:@"Last token invalid | lastToken.expiresIn = %f; lastTokenElapsed = %f; lastToken.passed = %d; lastDistanceToStateBorder = %f", self.lastToken.expiresIn, lastTokenElapsed, self.lastToken.passed, lastDistanceToStateBorder]];
-    }
-
-    return lastTokenValid;
+    [self.tokenCache clear];
 }
 
 - (void)setExpectedJurisdictionWithCountryCode:(NSString *)countryCode stateCode:(NSString *)stateCode {
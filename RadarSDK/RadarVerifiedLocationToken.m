@@ -61,7 +61,7 @@
     id expiresAtObj = dict[@"expiresAt"];
     if (expiresAtObj && [expiresAtObj isKindOfClass:[NSString class]]) {
         NSString *expiresAtStr = (NSString *)expiresAtObj;
-        expiresAt = [RadarUtils.isoDateFormatter dateFromString:expiresAtStr];
+        expiresAt = [RadarUtils dateFromISOString:expiresAtStr];
     }
     
     id expiresInObj = dict[@"expiresIn"];
@@ -0,0 +1,120 @@
+//
+//  RadarVerifiedTokenCache.h
+//  RadarSDK
+//
+//  Copyright © 2026 Radar Labs, Inc. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+#import "Radar.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+// background is YES for a refresh started ahead of expiry that no caller is waiting on
+typedef void (^RadarVerifiedTokenRefreshBlock)(BOOL background, RadarTrackVerifiedCompletionHandler completionHandler);
+
+// cached is YES when the token was served without waiting on a refresh
+typedef void (^RadarVerifiedTokenCacheCompletionHandler)(RadarStatus status, RadarVerifiedLocationToken *_Nullable token, BOOL cached);
+
+/**
+ Holds the last verified location token and decides when to fetch a new one.
+
+ A valid token is served immediately. Once a token is within `refreshLeadTime` of expiring, serving it also starts a background refresh, so the next caller gets a
+ fresh token without waiting on a verified track. The lead time follows the measured refresh latency. Refreshes requested while one is in flight join it
+ instead of starting another verified track.
+
+ Tokens and refreshes keep the beacons and desired accuracy they were requested with. A token is only served, and a refresh only joined, when it is at least as
+ strong as the request: it ranged beacons if the request wants them, and its accuracy is no lower.
+ */
+@interface RadarVerifiedTokenCache : NSObject
+
+/**
+ The shortest lead time before expiry at which a token is refreshed, 10 seconds by default.
+ */
+@property (assign, atomic) NSTimeInterval minimumRefreshLeadTime;
+
+/**
+ Calls served a valid token without waiting.
+ */
+@property (assign, atomic, readonly) NSUInteger hits;
+
+/**
+ Calls that had to wait for a refresh.
+ */
+@property (assign, atomic, readonly) NSUInteger misses;
+
+/**
+ Refreshes started, and refreshes requested while one was already in flight.
+ */
+@property (assign, atomic, readonly) NSUInteger refreshes;
+@property (assign, atomic, readonly) NSUInteger joinedRefreshes;
+
+/**
+ Seconds taken by the last successful refresh, and a moving average of them, or 0 before the first.
+ */
+@property (assign, atomic, readonly) NSTimeInterval lastRefreshLatency;
+@property (assign, atomic, readonly) NSTimeInterval refreshLatency;
+
+@property (strong, atomic, readonly, nullable) RadarVerifiedLocationToken *token;
+@property (assign, atomic, readonly) BOOL tokenBeacons;
+@property (assign, atomic, readonly) RadarTrackingOptionsDesiredAccuracy tokenDesiredAccuracy;
+
+/**
+ Whether a refresh is in flight.
+ */
+@property (assign, atomic, readonly) BOOL refreshing;
+
+- (void)storeToken:(RadarVerifiedLocationToken *)token
+           beacons:(BOOL)beacons
+   desiredAccuracy:(RadarTrackingOptionsDesiredAccuracy)desiredAccuracy NS_SWIFT_NAME(store(_:beacons:desiredAccuracy:));
+- (void)clear;
+
+/**
+ The stored token if it hasn't expired, passed, and is more than a mile from a state border, otherwise nil.
+ */
+- (RadarVerifiedLocationToken *_Nullable)validToken;
+
+/**
+ The valid token if it is at least as strong as a request with `beacons` and `desiredAccuracy`, otherwise nil.
+ */
+- (RadarVerifiedLocationToken *_Nullable)validTokenWithBeacons:(BOOL)beacons
+                                               desiredAccuracy:(RadarTrackingOptionsDesiredAccuracy)desiredAccuracy NS_SWIFT_NAME(validToken(beacons:desiredAccuracy:));
+
+/**
+ Seconds until the stored token expires, or 0 if there is none.
+ */
+- (NSTimeInterval)timeUntilExpiry;
+
+/**
+ How long before expiry a token is refreshed: twice the measured refresh latency, and at least `minimumRefreshLeadTime`.
+ */
+- (NSTimeInterval)refreshLeadTime;
+
+/**
+ Whether there is no valid token, or it expires within `refreshLeadTime`.
+ */
+- (BOOL)needsRefresh;
+
+/**
+ Calls `completionHandler` with the valid token right away if it is strong enough for the request, refreshing in the background if it expires soon, or with the
+ result of a refresh if there is no such token.
+ */
+- (void)getTokenWithBeacons:(BOOL)beacons
+            desiredAccuracy:(RadarTrackingOptionsDesiredAccuracy)desiredAccuracy
+                    refresh:(RadarVerifiedTokenRefreshBlock)refresh
+          completionHandler:(RadarVerifiedTokenCacheCompletionHandler _Nullable)completionHandler NS_SWIFT_NAME(getToken(beacons:desiredAccuracy:refresh:completionHandler:));
+
+/**
+ Calls `refresh` unless a refresh at least as strong as the request is in flight, and calls `completionHandler` with the result of whichever refresh it joined.
+ */
+- (void)refreshWithBeacons:(BOOL)beacons
+           desiredAccuracy:(RadarTrackingOptionsDesiredAccuracy)desiredAccuracy
+                     block:(RadarVerifiedTokenRefreshBlock)refresh
+         completionHandler:(RadarTrackVerifiedCompletionHandler _Nullable)completionHandler NS_SWIFT_NAME(refresh(beacons:desiredAccuracy:block:completionHandler:));
+
+- (NSString *)metricsDescription;
+
+@end
+
+NS_ASSUME_NONNULL_END
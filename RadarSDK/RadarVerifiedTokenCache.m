@@ -0,0 +1,237 @@
+//
+//  RadarVerifiedTokenCache.m
+//  RadarSDK
+//
+//  Copyright © 2026 Radar Labs, Inc. All rights reserved.
+//
+
+#import "RadarVerifiedTokenCache.h"
+
+#import "RadarLogger.h"
+
+// tokens this close to a state border may be on the wrong side of it by the time they are used
+static const double kRadarVerifiedTokenMinDistanceToBorder = 1609;
+static const double kRadarVerifiedTokenLatencyWeight = 0.3;
+
+// whether a token or refresh with one strength serves a request with another; a lower accuracy value is more accurate
+static BOOL RadarVerifiedTokenCovers(BOOL beacons, RadarTrackingOptionsDesiredAccuracy desiredAccuracy, BOOL requestedBeacons,
+                                     RadarTrackingOptionsDesiredAccuracy requestedDesiredAccuracy) {
+    return (beacons || !requestedBeacons) && desiredAccuracy <= requestedDesiredAccuracy;
+}
+
+// a refresh in flight, and the callers waiting on it
+@interface RadarVerifiedTokenRefresh : NSObject
+
+@property (assign, nonatomic) BOOL beacons;
+@property (assign, nonatomic) RadarTrackingOptionsDesiredAccuracy desiredAccuracy;
+@property (strong, nonatomic) NSMutableArray<RadarTrackVerifiedCompletionHandler> *completionHandlers;
+
+@end
+
+@implementation RadarVerifiedTokenRefresh
+@end
+
+@interface RadarVerifiedTokenCache ()
+
+@property (assign, atomic, readwrite) NSUInteger hits;
+@property (assign, atomic, readwrite) NSUInteger misses;
+@property (assign, atomic, readwrite) NSUInteger refreshes;
+@property (assign, atomic, readwrite) NSUInteger joinedRefreshes;
+@property (assign, atomic, readwrite) NSTimeInterval lastRefreshLatency;
+@property (assign, atomic, readwrite) NSTimeInterval refreshLatency;
+@property (strong, atomic, readwrite, nullable) RadarVerifiedLocationToken *token;
+@property (assign, atomic, readwrite) BOOL tokenBeacons;
+@property (assign, atomic, readwrite) RadarTrackingOptionsDesiredAccuracy tokenDesiredAccuracy;
+@property (assign, atomic, readwrite) BOOL refreshing;
+@property (assign, nonatomic) NSTimeInterval tokenSystemUptime;
+@property (strong, nonatomic) NSMutableArray<RadarVerifiedTokenRefresh *> *refreshesInFlight;
+
+@end
+
+@implementation RadarVerifiedTokenCache
+
+- (instancetype)init {
+    self = [super init];
+    if (self) {
+        _minimumRefreshLeadTime = 10;
+        _refreshesInFlight = [NSMutableArray new];
+    }
+    return self;
+}
+
+- (void)storeToken:(RadarVerifiedLocationToken *)token beacons:(BOOL)beacons desiredAccuracy:(RadarTrackingOptionsDesiredAccuracy)desiredAccuracy {
+    @synchronized(self) {
+        self.token = token;
+        self.tokenBeacons = beacons;
+        self.tokenDesiredAccuracy = desiredAccuracy;
+        self.tokenSystemUptime = [NSProcessInfo processInfo].systemUptime;
+    }
+}
+
+- (void)clear {
+    @synchronized(self) {
+        self.token = nil;
+    }
+}
+
+- (RadarVerifiedLocationToken *)validToken {
+    RadarVerifiedLocationToken *token;
+    NSTimeInterval elapsed;
+    @synchronized(self) {
+        token = self.token;
+        elapsed = [NSProcessInfo processInfo].systemUptime - self.tokenSystemUptime;
+    }
+    if (!token) {
+        return nil;
+    }
+
+    double distanceToStateBorder = -1;
+    if (token.user && token.user.state) {
+        distanceToStateBorder = token.user.state.distanceToBorder;
+    }
+
+    BOOL valid = (elapsed < token.expiresIn) && token.passed && (distanceToStateBorder > kRadarVerifiedTokenMinDistanceToBorder);
+
+    [[RadarLogger sharedInstance] logWithLevel:RadarLogLevelDebug
+                                  messageBlock:^NSString * {
+                                      return [NSString stringWithFormat:@"Last token %@ | lastToken.expiresIn = %f; lastTokenElapsed = %f; lastToken.passed = %d; lastDistanceToStateBorder = %f",
+                                                                        valid ? @"valid" : @"invalid", token.expiresIn, elapsed, token.passed, distanceToStateBorder];
+                                  }];
+
+    return valid ? token : nil;
+}
+
+- (RadarVerifiedLocationToken *)validTokenWithBeacons:(BOOL)beacons desiredAccuracy:(RadarTrackingOptionsDesiredAccuracy)desiredAccuracy {
+    RadarVerifiedLocationToken *token = [self validToken];
+    @synchronized(self) {
+        if (token != self.token || !RadarVerifiedTokenCovers(self.tokenBeacons, self.tokenDesiredAccuracy, beacons, desiredAccuracy)) {
+            return nil;
+        }
+    }
+    return token;
+}
+
+- (NSTimeInterval)timeUntilExpiry {
+    @synchronized(self) {
+        if (!self.token) {
+            return 0;
+        }
+        return MAX(self.token.expiresIn - ([NSProcessInfo processInfo].systemUptime - self.tokenSystemUptime), 0);
+    }
+}
+
+- (NSTimeInterval)refreshLeadTime {
+    return MAX(self.minimumRefreshLeadTime, 2 * self.refreshLatency);
+}
+
+- (BOOL)needsRefresh {
+    return ![self validToken] || [self timeUntilExpiry] < [self refreshLeadTime];
+}
+
+- (void)getTokenWithBeacons:(BOOL)beacons
+            desiredAccuracy:(RadarTrackingOptionsDesiredAccuracy)desiredAccuracy
+                    refresh:(RadarVerifiedTokenRefreshBlock)refresh
+          completionHandler:(RadarVerifiedTokenCacheCompletionHandler)completionHandler {
+    RadarVerifiedLocationToken *token = [self validTokenWithBeacons:beacons desiredAccuracy:desiredAccuracy];
+    if (!token) {
+        @synchronized(self) {
+            self.misses++;
+        }
+        [self refreshWithBeacons:beacons
+                 desiredAccuracy:desiredAccuracy
+                           block:refresh
+                      background:NO
+               completionHandler:^(RadarStatus status, RadarVerifiedLocationToken *_Nullable token) {
+                   if (completionHandler) {
+                       completionHandler(status, token, NO);
+                   }
+               }];
+        return;
+    }
+
+    @synchronized(self) {
+        self.hits++;
+    }
+    if ([self timeUntilExpiry] < [self refreshLeadTime]) {
+        [[RadarLogger sharedInstance] logWithLevel:RadarLogLevelDebug
+                                      messageBlock:^NSString * {
+                                          return [NSString stringWithFormat:@"Refreshing token ahead of expiry | timeUntilExpiry = %f; refreshLeadTime = %f", [self timeUntilExpiry],
+                                                                            [self refreshLeadTime]];
+                                      }];
+        [self refreshWithBeacons:beacons desiredAccuracy:desiredAccuracy block:refresh background:YES completionHandler:nil];
+    }
+
+    if (completionHandler) {
+        completionHandler(RadarStatusSuccess, token, YES);
+    }
+}
+
+- (void)refreshWithBeacons:(BOOL)beacons
+           desiredAccuracy:(RadarTrackingOptionsDesiredAccuracy)desiredAccuracy
+                     block:(RadarVerifiedTokenRefreshBlock)refresh
+         completionHandler:(RadarTrackVerifiedCompletionHandler)completionHandler {
+    [self refreshWithBeacons:beacons desiredAccuracy:desiredAccuracy block:refresh background:NO completionHandler:completionHandler];
+}
+
+- (void)refreshWithBeacons:(BOOL)beacons
+           desiredAccuracy:(RadarTrackingOptionsDesiredAccuracy)desiredAccuracy
+                     block:(RadarVerifiedTokenRefreshBlock)refresh
+                background:(BOOL)background
+         completionHandler:(RadarTrackVerifiedCompletionHandler)completionHandler {
+    RadarVerifiedTokenRefresh *inFlight = [RadarVerifiedTokenRefresh new];
+    @synchronized(self) {
+        for (RadarVerifiedTokenRefresh *joined in self.refreshesInFlight) {
+            if (RadarVerifiedTokenCovers(joined.beacons, joined.desiredAccuracy, beacons, desiredAccuracy)) {
+                if (completionHandler) {
+                    [joined.completionHandlers addObject:completionHandler];
+                }
+                self.joinedRefreshes++;
+                return;
+            }
+        }
+
+        inFlight.beacons = beacons;
+        inFlight.desiredAccuracy = desiredAccuracy;
+        inFlight.completionHandlers = [NSMutableArray new];
+        if (completionHandler) {
+            [inFlight.completionHandlers addObject:completionHandler];
+        }
+        [self.refreshesInFlight addObject:inFlight];
+        self.refreshing = YES;
+        self.refreshes++;
+    }
+
+    NSTimeInterval startedAt = [NSProcessInfo processInfo].systemUptime;
+    refresh(background, ^(RadarStatus status, RadarVerifiedLocationToken *_Nullable token) {
+        NSArray<RadarTrackVerifiedCompletionHandler> *completionHandlers;
+        @synchronized(self) {
+            if (status == RadarStatusSuccess && token) {
+                NSTimeInterval latency = [NSProcessInfo processInfo].systemUptime - startedAt;
+                self.lastRefreshLatency = latency;
+                self.refreshLatency = self.refreshLatency > 0 ? (1 - kRadarVerifiedTokenLatencyWeight) * self.refreshLatency + kRadarVerifiedTokenLatencyWeight * latency : latency;
+            }
+            completionHandlers = [inFlight.completionHandlers copy];
+            [self.refreshesInFlight removeObject:inFlight];
+            self.refreshing = self.refreshesInFlight.count > 0;
+        }
+
+        [[RadarLogger sharedInstance] logWithLevel:RadarLogLevelDebug
+                                      messageBlock:^NSString * {
+                                          return [NSString stringWithFormat:@"Verified token refreshed | status = %@; %@", [Radar stringForStatus:status], [self metricsDescription]];
+                                      }];
+
+        for (RadarTrackVerifiedCompletionHandler completionHandler in completionHandlers) {
+            completionHandler(status, token);
+        }
+    });
+}
+
+- (NSString *)metricsDescription {
+    @synchronized(self) {
+        return [NSString stringWithFormat:@"hits = %lu; misses = %lu; refreshes = %lu; joinedRefreshes = %lu; lastRefreshLatency = %.0f ms; refreshLatency = %.0f ms",
+                                          (unsigned long)self.hits, (unsigned long)self.misses, (unsigned long)self.refreshes, (unsigned long)self.joinedRefreshes,
+                                          self.lastRefreshLatency * 1000, self.refreshLatency * 1000];
+    }
+}
+
+@end
@@ -14,4 +14,112 @@ struct SyncRegionResponse {
     let beacons: [RadarBeaconSwift]?
     let regionCenter: RadarCoordinateSwift?
     let regionRadius: Double?
+    /// Server version of the region contents, echoed back on the next fetch.
+    var version: String? = nil
+    /// Set when the server answered with changes relative to the version we sent, in
+    /// which case `geofences`, `places` and `beacons` are nil.
+    var delta: SyncRegionDelta? = nil
+    /// Set when the server answered `304 Not Modified` to the version we sent.
+    var notModified = false
+}
+
+/// Changes to apply to the synced region, keyed by entity id.
+struct SyncRegionDelta {
+    struct Changes<Element> {
+        /// Entities that were added or whose contents changed.
+        var upserted: [Element] = []
+        var removed: [String] = []
+
+        var isEmpty: Bool { upserted.isEmpty && removed.isEmpty }
+    }
+
+    var geofences = Changes<RadarGeofenceSwift>()
+    var places = Changes<RadarPlaceSwift>()
+    var beacons = Changes<RadarBeaconSwift>()
+
+    var isEmpty: Bool { geofences.isEmpty && places.isEmpty && beacons.isEmpty }
+}
+
+/// Wire shape of the sync/region response, decoded in a single `JSONDecoder` pass.
+///
+/// A collection that fails to decode is treated as missing rather than failing the whole
+/// response, matching how each array used to be decoded on its own.
+struct SyncRegionEnvelope: Decodable {
+    struct Region: Decodable {
+        let latitude: Double?
+        let longitude: Double?
+        let radius: Double?
+    }
+
+    struct Changes<Element: Decodable>: Decodable {
+        let upserted: [Element]?
+        let removed: [String]?
+
+        enum CodingKeys: String, CodingKey {
+            case upserted
+            case removed
+        }
+
+        init(from decoder: Decoder) throws {
+            let container = try decoder.container(keyedBy: CodingKeys.self)
+            upserted = try? container.decodeIfPresent([Element].self, forKey: .upserted)
+            removed = try? container.decodeIfPresent([String].self, forKey: .removed)
+        }
+
+        var changes: SyncRegionDelta.Changes<Element> {
+            SyncRegionDelta.Changes(upserted: upserted ?? [], removed: removed ?? [])
+        }
+    }
+
+    struct Delta: Decodable {
+        let geofences: Changes<RadarGeofenceSwift>?
+        let places: Changes<RadarPlaceSwift>?
+        let beacons: Changes<RadarBeaconSwift>?
+    }
+
+    let region: Region?
+    let version: String?
+    let geofences: [RadarGeofenceSwift]?
+    let places: [RadarPlaceSwift]?
+    let beacons: [RadarBeaconSwift]?
+    let delta: Delta?
+
+    enum CodingKeys: String, CodingKey {
+        case region
+        case version
+        case geofences
+        case places
+        case beacons
+        case delta
+    }
+
+    init(from decoder: Decoder) throws {
+        let container = try decoder.container(keyedBy: CodingKeys.self)
+        region = try? container.decodeIfPresent(Region.self, forKey: .region)
+        version = try? container.decodeIfPresent(String.self, forKey: .version)
+        geofences = try? container.decodeIfPresent([RadarGeofenceSwift].self, forKey: .geofences)
+        places = try? container.decodeIfPresent([RadarPlaceSwift].self, forKey: .places)
+        beacons = try? container.decodeIfPresent([RadarBeaconSwift].self, forKey: .beacons)
+        delta = try? container.decodeIfPresent(Delta.self, forKey: .delta)
+    }
+
+    var regionCenter: RadarCoordinateSwift? {
+        guard let region, let latitude = region.latitude, let longitude = region.longitude, let radius = region.radius, radius > 0 else {
+            return nil
+        }
+        return RadarCoordinateSwift(latitude: latitude, longitude: longitude)
+    }
+
+    var regionRadius: Double? {
+        regionCenter == nil ? nil : region?.radius
+    }
+
+    var syncDelta: SyncRegionDelta? {
+        guard let delta else { return nil }
+        return SyncRegionDelta(
+            geofences: delta.geofences?.changes ?? SyncRegionDelta.Changes(),
+            places: delta.places?.changes ?? SyncRegionDelta.Changes(),
+            beacons: delta.beacons?.changes ?? SyncRegionDelta.Changes()
+        )
+    }
 }
@@ -5,29 +5,36 @@
 //  Copyright © 2026 Radar Labs, Inc. All rights reserved.
 //
 
+import Compression
+import Foundation
+
 @testable import RadarSDK
 
 final class MockURLSession: RadarURLSessionProtocol, @unchecked Sendable {
     struct Handler {
         let on: (URLRequest) -> Bool  // swiftlint:disable:this identifier_name
         let response: Data
+        var statusCode = 200
+        var headerFields = [String: String]()
     }
 
     var handlers = [Handler]()
+    var requests = [URLRequest]()
 
     func data(for request: URLRequest) async throws -> (Data, URLResponse) {
-        let ok = HTTPURLResponse(url: request.url!, statusCode: 200, httpVersion: "1.0", headerFields: [:])!  // swiftlint:disable:this identifier_name
+        requests.append(request)
         for handler in handlers {
             if handler.on(request) {  // swiftlint:disable:this for_where
-                return (handler.response, ok as URLResponse)
+                let response = HTTPURLResponse(url: request.url!, statusCode: handler.statusCode, httpVersion: "1.0", headerFields: handler.headerFields)!
+                return (handler.response, response as URLResponse)
             }
         }
         let notFound = HTTPURLResponse(url: request.url!, statusCode: 400, httpVersion: "1.0", headerFields: [:])!
         return (Data(), notFound)
     }
 
-    func on(_ request: @escaping (URLRequest) -> Bool, _ response: Data) {
-        handlers.append(Handler(on: request, response: response))
+    func on(_ request: @escaping (URLRequest) -> Bool, _ response: Data, statusCode: Int = 200, headerFields: [String: String] = [:]) {
+        handlers.append(Handler(on: request, response: response, statusCode: statusCode, headerFields: headerFields))
     }
 
     func on(_ request: String, _ response: [String: Any]) {
@@ -37,3 +44,24 @@ final class MockURLSession: RadarURLSessionProtocol, @unchecked Sendable {
         on({ req in req.url?.absoluteString == request }, json)
     }
 }
+
+/// Decodes a gzip body written by `RadarGzip`, checking its CRC-32 and length trailer.
+func gunzip(_ data: Data) -> Data? {
+    guard data.count > 18, data.prefix(3) == Data([0x1F, 0x8B, 0x08]) else { return nil }
+    let deflated = data.subdata(in: 10..<(data.count - 8))
+    let length = data.suffix(4).withUnsafeBytes { Int(UInt32(littleEndian: $0.loadUnaligned(as: UInt32.self))) }
+    let crc = data.suffix(8).prefix(4).withUnsafeBytes { UInt32(littleEndian: $0.loadUnaligned(as: UInt32.self)) }
+
+    var inflated = Data(count: length)
+    let count = inflated.withUnsafeMutableBytes { destination in
+        deflated.withUnsafeBytes { source in
+            compression_decode_buffer(
+                destination.bindMemory(to: UInt8.self).baseAddress!, length,
+                source.bindMemory(to: UInt8.self).baseAddress!, deflated.count,
+                nil, COMPRESSION_ZLIB
+            )
+        }
+    }
+    guard count == length, RadarGzip.crc32(inflated) == crc else { return nil }
+    return inflated
+}
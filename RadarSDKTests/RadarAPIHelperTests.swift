@@ -62,4 +62,35 @@ struct RadarAPIHelperTests {
         #expect(message.contains("errorDescription ="))
         #expect(!message.contains("errorDescription = ;"))
     }
+
+    @Test func compressedBodyIsGzipEncoded() async throws {
+        let session = MockURLSession()
+        session.on({ _ in true }, Data())
+        let helper = RadarAPIHelper(session: session)
+        let body: [String: Any?] = ["logs": (0..<50).map { ["message": "Request | method = POST; url = https://api.radar.io/v1/track; index = \($0)"] }]
+
+        _ = try await helper.request(method: "POST", url: "https://api.radar.io/v1/logs", body: body, compressBody: true)
+
+        let request = try #require(session.requests.first)
+        let sent = try #require(request.httpBody)
+        #expect(request.value(forHTTPHeaderField: "Content-Encoding") == "gzip")
+        let json = try #require(gunzip(sent))
+        #expect(json == (try JSONSerialization.data(withJSONObject: body, options: [])))
+        #expect(sent.count < json.count / 4)
+    }
+
+    @Test func smallOrUncompressedBodiesAreSentAsIs() async throws {
+        let session = MockURLSession()
+        session.on({ _ in true }, Data())
+        let helper = RadarAPIHelper(session: session)
+
+        _ = try await helper.request(method: "POST", url: "https://api.radar.io/v1/logs", body: ["id": "abc"], compressBody: true)
+        _ = try await helper.request(method: "POST", url: "https://api.radar.io/v1/logs", body: ["message": String(repeating: "a", count: 2048)])
+
+        #expect(session.requests.count == 2)
+        for request in session.requests {
+            #expect(request.value(forHTTPHeaderField: "Content-Encoding") == nil)
+            #expect(request.httpBody.flatMap { try? JSONSerialization.jsonObject(with: $0) } != nil)
+        }
+    }
 }
@@ -0,0 +1,79 @@
+//
+//  RadarAdaptiveBatchPolicyTests.swift
+//  RadarSDKTests
+//
+//  Copyright © 2026 Radar Labs, Inc. All rights reserved.
+//
+
+import Foundation
+import Testing
+
+@testable import RadarSDK
+
+@Suite
+struct RadarAdaptiveBatchPolicyTests {
+
+    @Test("cellular batches hold more fixes for longer than wifi")
+    func limitsFollowNetwork() {
+        let policy = RadarAdaptiveBatchPolicy()
+        let wifi = policy.limits(network: .wifi, foreground: false)
+        let lte = policy.limits(network: .cellularLte, foreground: false)
+        let edge = policy.limits(network: .cellular2g, foreground: false)
+        let offline = policy.limits(network: .unknown, foreground: false)
+
+        #expect(wifi.size < lte.size && lte.size < edge.size)
+        #expect(wifi.interval < lte.interval && lte.interval < edge.interval)
+        #expect(offline.interval == RadarAdaptiveBatchPolicy.maxInterval)
+    }
+
+    @Test("foreground halves the batch")
+    func foregroundFlushesSooner() {
+        let policy = RadarAdaptiveBatchPolicy()
+        let background = policy.limits(network: .cellularLte, foreground: false)
+        let foreground = policy.limits(network: .cellularLte, foreground: true)
+
+        #expect(foreground == RadarAdaptiveBatchPolicy.Limits(size: background.size / 2, interval: background.interval / 2))
+    }
+
+    @Test("slow and failing flushes stretch the interval until one succeeds")
+    func backsOffOnSlowOrFailedFlushes() {
+        let policy = RadarAdaptiveBatchPolicy()
+        let base = policy.limits(network: .wifi, foreground: false).interval
+
+        policy.recordFlush(latency: 0.2, success: true)
+        #expect(policy.limits(network: .wifi, foreground: false).interval == base)
+
+        policy.recordFlush(latency: 0, success: false)
+        policy.recordFlush(latency: 0, success: false)
+        #expect(policy.limits(network: .wifi, foreground: false).interval == base * 4)
+        for _ in 0..<5 {
+            policy.recordFlush(latency: 0, success: false)
+        }
+        #expect(policy.limits(network: .cellularLte, foreground: false).interval == RadarAdaptiveBatchPolicy.maxInterval)
+
+        policy.recordFlush(latency: 0.2, success: true)
+        #expect(policy.limits(network: .wifi, foreground: false).interval == base)
+
+        for _ in 0..<10 {
+            policy.recordFlush(latency: 5, success: true)
+        }
+        #expect(policy.limits(network: .wifi, foreground: false).interval == base * 2)
+    }
+
+    @Test("event marks are consumed once and stay bounded")
+    func eventMarks() {
+        let policy = RadarAdaptiveBatchPolicy()
+        let timestamp = Date(timeIntervalSince1970: 1_000)
+
+        policy.markEvent(at: timestamp)
+        #expect(!policy.consumeEvent(at: timestamp.addingTimeInterval(1)))
+        #expect(policy.consumeEvent(at: timestamp))
+        #expect(!policy.consumeEvent(at: timestamp))
+
+        for offset in 0...RadarAdaptiveBatchPolicy.maxEventMarks {
+            policy.markEvent(at: timestamp.addingTimeInterval(TimeInterval(offset)))
+        }
+        #expect(!policy.consumeEvent(at: timestamp))
+        #expect(policy.consumeEvent(at: timestamp.addingTimeInterval(TimeInterval(RadarAdaptiveBatchPolicy.maxEventMarks))))
+    }
+}
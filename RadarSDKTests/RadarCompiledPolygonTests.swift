@@ -0,0 +1,197 @@
+//
+//  RadarCompiledPolygonTests.swift
+//  RadarSDK
+//
+//  Copyright © 2026 Radar Labs, Inc. All rights reserved.
+//
+
+import CoreLocation
+import Foundation
+import Testing
+import XCTest
+
+@testable import RadarSDK
+
+@Suite
+struct RadarCompiledPolygonTests {
+
+    // MARK: - Helpers
+
+    /// Irregular star-shaped ring around a center, closed like the API's GeoJSON rings.
+    func makeRing(latitude: Double, longitude: Double, radius: Double, vertexCount: Int, generator: inout SplitMix64) -> [RadarCoordinateSwift] {
+        let latDelta = radius / 111_320.0
+        let lngDelta = radius / (111_320.0 * cos(latitude * .pi / 180.0))
+        var ring = (0..<vertexCount).map { v -> RadarCoordinateSwift in
+            let angle = Double(v) / Double(vertexCount) * 2 * .pi
+            let scale = Double.random(in: 0.4...1.0, using: &generator)
+            return RadarCoordinateSwift(latitude: latitude + latDelta * scale * sin(angle), longitude: longitude + lngDelta * scale * cos(angle))
+        }
+        ring.append(ring[0])
+        return ring
+    }
+
+    func randomPoint(near latitude: Double, _ longitude: Double, within meters: Double, generator: inout SplitMix64) -> CLLocationCoordinate2D {
+        let latDelta = meters / 111_320.0
+        let lngDelta = meters / (111_320.0 * cos(latitude * .pi / 180.0))
+        return CLLocationCoordinate2D(
+            latitude: latitude + Double.random(in: -latDelta...latDelta, using: &generator),
+            longitude: longitude + Double.random(in: -lngDelta...lngDelta, using: &generator)
+        )
+    }
+
+    // MARK: - Tests
+
+    @Test("compiled polygon requires at least three vertices")
+    func requiresThreeVertices() {
+        let coords = [
+            RadarCoordinateSwift(latitude: 40.0, longitude: -73.0),
+            RadarCoordinateSwift(latitude: 40.001, longitude: -73.0),
+        ]
+        #expect(RadarCompiledPolygon(coordinates: coords) == nil)
+    }
+
+    @Test("decoded polygon geofences carry a compiled polygon")
+    func decodedGeofenceIsCompiled() throws {
+        let json = """
+            {
+              "_id": "poly1",
+              "type": "polygon",
+              "geometryRadius": 150,
+              "geometryCenter": { "type": "Point", "coordinates": [-73.97536, 40.78382] },
+              "geometry": {
+                "type": "Polygon",
+                "coordinates": [[[-73.97636, 40.78482], [-73.97436, 40.78482], [-73.97436, 40.78282], [-73.97636, 40.78282], [-73.97636, 40.78482]]]
+              }
+            }
+            """
+        let geofence = try JSONDecoder().decode(RadarGeofenceSwift.self, from: Data(json.utf8))
+
+        #expect(geofence.compiledPolygon?.vertexCount == 5)
+        #expect(geofence.compiledPolygon?.contains(CLLocationCoordinate2D(latitude: 40.78382, longitude: -73.97536)) == true)
+    }
+
+    @Test("containment matches the great-circle implementation", arguments: [40.78382, -33.8688, 64.1466])
+    func containmentMatchesGreatCircle(latitude: Double) {
+        var generator = SplitMix64(seed: 3)
+        let longitude = 12.5
+
+        for _ in 0..<50 {
+            let radius = Double.random(in: 50...2_000, using: &generator)
+            let ring = makeRing(latitude: latitude, longitude: longitude, radius: radius, vertexCount: 24, generator: &generator)
+            let polygon = RadarCompiledPolygon(coordinates: ring)!
+
+            for _ in 0..<50 {
+                let point = randomPoint(near: latitude, longitude, within: radius * 1.2, generator: &generator)
+                #expect(polygon.contains(point) == RadarSyncManager.isPoint(point, insidePolygon: ring))
+            }
+        }
+    }
+
+    @Test("edge distance stays within 1% of the great-circle implementation", arguments: [40.78382, -33.8688, 64.1466])
+    func edgeDistanceMatchesGreatCircle(latitude: Double) {
+        var generator = SplitMix64(seed: 11)
+        let longitude = -73.97536
+
+        for _ in 0..<50 {
+            let radius = Double.random(in: 50...2_000, using: &generator)
+            let ring = makeRing(latitude: latitude, longitude: longitude, radius: radius, vertexCount: 24, generator: &generator)
+            let polygon = RadarCompiledPolygon(coordinates: ring)!
+
+            for _ in 0..<20 {
+                let point = randomPoint(near: latitude, longitude, within: radius * 1.5, generator: &generator)
+                let planar = polygon.distanceToEdge(from: point)
+                let greatCircle = RadarSyncManager.distanceToPolygonEdge(from: point, polygon: ring)
+
+                #expect(abs(planar - greatCircle) <= max(1.0, greatCircle * 0.01))
+            }
+        }
+    }
+
+    /// Isochrone-shaped ring: a drive-time contour with many vertices and jagged radial noise.
+    func makeIsochrone(vertexCount: Int, generator: inout SplitMix64) -> [RadarCoordinateSwift] {
+        let latitude = 40.78382
+        let longitude = -73.97536
+        let radius = 3_000.0
+        let latDelta = radius / 111_320.0
+        let lngDelta = radius / (111_320.0 * cos(latitude * .pi / 180.0))
+        var scale = 1.0
+        var ring = (0..<vertexCount).map { v -> RadarCoordinateSwift in
+            let angle = Double(v) / Double(vertexCount) * 2 * .pi
+            scale = min(1.2, max(0.3, scale + Double.random(in: -0.08...0.08, using: &generator)))
+            return RadarCoordinateSwift(latitude: latitude + latDelta * scale * sin(angle), longitude: longitude + lngDelta * scale * cos(angle))
+        }
+        ring.append(ring[0])
+        return ring
+    }
+
+    @Test("vectorized kernels match the scalar kernels exactly", arguments: [16, 17, 18, 19, 250, 803])
+    func vectorizedMatchesScalar(vertexCount: Int) {
+        var generator = SplitMix64(seed: UInt64(vertexCount))
+        let polygon = RadarCompiledPolygon(coordinates: makeIsochrone(vertexCount: vertexCount, generator: &generator))!
+
+        for _ in 0..<500 {
+            let x = Double.random(in: (polygon.minX - 500)...(polygon.maxX + 500), using: &generator)
+            let y = Double.random(in: (polygon.minY - 500)...(polygon.maxY + 500), using: &generator)
+            #expect(polygon.containsVectorized(x: x, y: y) == polygon.containsScalar(x: x, y: y))
+            #expect(polygon.distanceToEdgeVectorized(x: x, y: y) == polygon.distanceToEdgeScalar(x: x, y: y))
+        }
+    }
+
+    @Test("bounding box rejects distant points")
+    func boundingBoxRejectsDistantPoints() {
+        var generator = SplitMix64(seed: 5)
+        let ring = makeRing(latitude: 40.78382, longitude: -73.97536, radius: 200, vertexCount: 12, generator: &generator)
+        let polygon = RadarCompiledPolygon(coordinates: ring)!
+
+        let (x, y) = polygon.project(CLLocationCoordinate2D(latitude: 40.80, longitude: -73.97536))
+        #expect(!polygon.boundingBoxContains(x: x, y: y))
+        #expect(!polygon.boundingBoxContains(x: x, y: y, margin: 100))
+        #expect(polygon.boundingBoxContains(x: x, y: y, margin: 2_000))
+    }
+}
+
+/// Per-point cost of the polygon kernels on a 400-vertex isochrone, scalar vs vectorized.
+final class RadarCompiledPolygonBenchmarks: XCTestCase {
+    private var polygon: RadarCompiledPolygon!
+    private var points: [(Double, Double)] = []
+
+    override func setUp() {
+        super.setUp()
+        var generator = SplitMix64(seed: 99)
+        polygon = RadarCompiledPolygon(coordinates: RadarCompiledPolygonTests().makeIsochrone(vertexCount: 400, generator: &generator))
+        points = (0..<2_000).map { _ in
+            (
+                Double.random(in: polygon.minX...polygon.maxX, using: &generator),
+                Double.random(in: polygon.minY...polygon.maxY, using: &generator)
+            )
+        }
+    }
+
+    // accumulates results so the kernels can't be optimized away
+    private func measureKernel(_ kernel: @escaping (RadarCompiledPolygon, Double, Double) -> Double) {
+        let (polygon, points) = (polygon!, points)
+        var sink = 0.0
+        measure(metrics: [XCTClockMetric()]) {
+            for (x, y) in points {
+                sink += kernel(polygon, x, y)
+            }
+        }
+        XCTAssertFalse(sink.isNaN)
+    }
+
+    func testContainsScalar() {
+        measureKernel { polygon, x, y in polygon.containsScalar(x: x, y: y) ? 1 : 0 }
+    }
+
+    func testContainsVectorized() {
+        measureKernel { polygon, x, y in polygon.containsVectorized(x: x, y: y) ? 1 : 0 }
+    }
+
+    func testDistanceToEdgeScalar() {
+        measureKernel { polygon, x, y in polygon.distanceToEdgeScalar(x: x, y: y) }
+    }
+
+    func testDistanceToEdgeVectorized() {
+        measureKernel { polygon, x, y in polygon.distanceToEdgeVectorized(x: x, y: y) }
+    }
+}
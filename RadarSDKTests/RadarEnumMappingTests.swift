@@ -0,0 +1,110 @@
+//
+//  RadarEnumMappingTests.swift
+//  RadarSDKTests
+//
+//  Copyright © 2026 Radar Labs, Inc. All rights reserved.
+//
+
+import Foundation
+import Testing
+import XCTest
+
+@testable import RadarSDK
+
+@Suite
+struct RadarEnumMappingTests {
+
+    private final class Fixtures {}
+
+    private static let mappings: [(name: String, mapping: RadarEnumMapping)] = [
+        ("event type", RadarEvent.typeMapping()),
+        ("trip status", RadarTrip.statusMapping()),
+        ("route mode", RadarRouteModeUtils.modeMapping()),
+        ("activity type", RadarUser.activityTypeMapping()),
+        ("location source", RadarUser.sourceMapping()),
+    ]
+
+    // the table's strings, in table order for the enums above, which all fit in 0...64
+    static func strings(_ mapping: RadarEnumMapping) -> [String] {
+        (0...64).compactMap { mapping.string(for: $0) }
+    }
+
+    /// `count` track.json events cycling through every event type, plus a conversion.
+    static func trackEvents(count: Int) throws -> [Any] {
+        guard let url = Bundle(for: Fixtures.self).url(forResource: "track", withExtension: "json"),
+            let response = try JSONSerialization.jsonObject(with: Data(contentsOf: url)) as? [String: Any],
+            let fixtureEvents = response["events"] as? [[String: Any]]
+        else {
+            throw CocoaError(.fileReadCorruptFile)
+        }
+        let types = strings(RadarEvent.typeMapping()) + ["conversion.purchase"]
+        return (0..<count).map { index in
+            var event = fixtureEvents[index % fixtureEvents.count]
+            event["type"] = types[index % types.count]
+            return event
+        }
+    }
+
+    @Test("every value round trips through its string")
+    func mappingsRoundTrip() {
+        for (name, mapping) in Self.mappings {
+            #expect(!Self.strings(mapping).isEmpty, "\(name)")
+            for value in 0...64 {
+                guard let string = mapping.string(for: value) else { continue }
+                #expect(mapping.value(for: string, defaultValue: -1) == value, "\(name): \(string)")
+            }
+        }
+    }
+
+    @Test("strings outside the table, and non-strings, parse as the default")
+    func parsesDefault() {
+        let mapping = RadarEvent.typeMapping()
+        #expect(mapping.value(for: "conversion.purchase", defaultValue: RadarEventType.conversion.rawValue) == RadarEventType.conversion.rawValue)
+        #expect(mapping.value(for: nil, defaultValue: RadarEventType.conversion.rawValue) == RadarEventType.conversion.rawValue)
+        #expect(mapping.value(for: NSNumber(value: 2), defaultValue: RadarEventType.conversion.rawValue) == RadarEventType.conversion.rawValue)
+        #expect(mapping.string(for: RadarEventType.conversion.rawValue) == nil)
+    }
+
+    @Test("event types in a large /track response decode")
+    func decodesTrackResponseEventTypes() throws {
+        let decoded = RadarEvent.events(from: try Self.trackEvents(count: 500)) ?? []
+
+        #expect(!decoded.isEmpty)
+        for event in decoded where event.type == .conversion {
+            #expect(event.conversionName == "conversion.purchase")
+        }
+    }
+}
+
+/// Looking up the event types of a 500-event /track response, comparison chain vs
+/// RadarEnumMapping.
+final class RadarEnumMappingBenchmarks: XCTestCase {
+
+    private func measureLookup(_ lookup: @escaping (NSString) -> Int) throws {
+        // bridged through NSString, as they are when read off the network
+        let typeStrings = try RadarEnumMappingTests.trackEvents(count: 500).compactMap { ($0 as? NSDictionary)?["type"] as? NSString }
+        measure(metrics: [XCTClockMetric()]) {
+            var checksum = 0
+            for type in typeStrings {
+                checksum &+= lookup(type)
+            }
+            XCTAssertNotEqual(checksum, 0)
+        }
+    }
+
+    // the comparison chain RadarEnumMapping replaced checked the table in order
+    func testComparisonChain() throws {
+        let table = RadarEnumMappingTests.strings(RadarEvent.typeMapping())
+        try measureLookup { type in
+            for (index, string) in table.enumerated() where type.isEqual(to: string) {
+                return index
+            }
+            return RadarEventType.conversion.rawValue
+        }
+    }
+
+    func testEnumMapping() throws {
+        let mapping = RadarEvent.typeMapping()
+        try measureLookup { mapping.value(for: $0, defaultValue: RadarEventType.conversion.rawValue) }
+    }
+}
@@ -5,7 +5,9 @@
 //  Copyright © 2026 Radar Labs, Inc. All rights reserved.
 //
 
+import Foundation
 import Testing
+import UIKit
 
 @testable import RadarSDK
 
@@ -88,4 +90,162 @@ struct RadarFileStorageTests {
 
         file.delete()
     }
+
+    // MARK: - Journaling
+
+    struct JournalValue: Codable, Sendable, Equatable {
+        var counter = 0
+        var timestamps: [String: Double] = [:]
+        var note: String?
+    }
+
+    func journalURL(_ fileName: String) -> URL {
+        FileManager.default.urls(for: .applicationSupportDirectory, in: .userDomainMask).first!
+            .appendingPathComponent("RadarSDK/\(fileName).journal")
+    }
+
+    @Test func journaledMutationsReloadInFreshObject() {
+        let fileName = "journal_reload_\(UUID().uuidString).json"
+        let store = RadarFileStorageObject<JournalValue>(fileName: fileName, journaling: true)
+        defer { store.clear(); store.flush() }
+
+        store.write(JournalValue(counter: 1, note: "first"))
+        for i in 0..<20 {
+            store.modify { value in
+                value?.counter += 1
+                value?.timestamps["g\(i)"] = Double(i)
+            }
+        }
+        store.modify { value in value?.note = nil }
+        store.flush()
+
+        let reloaded = RadarFileStorageObject<JournalValue>(fileName: fileName, journaling: true)
+        #expect(reloaded.read() == store.read())
+        #expect(reloaded.read()?.counter == 21)
+        #expect(reloaded.read()?.note == nil)
+        reloaded.flush()
+    }
+
+    @Test func journalRecordsOnlyChangedKeys() throws {
+        let fileName = "journal_patch_\(UUID().uuidString).json"
+        let store = RadarFileStorageObject<JournalValue>(fileName: fileName, journaling: true)
+        defer { store.clear(); store.flush() }
+
+        store.write(JournalValue(counter: 1, timestamps: ["a": 1, "b": 2], note: "note"))
+        store.modify { value in value?.counter = 2 }
+        store.flush()
+
+        let lines = try Data(contentsOf: journalURL(fileName)).split(separator: UInt8(ascii: "\n"))
+        #expect(lines.count == 2)
+        let last = try JSONSerialization.jsonObject(with: Data(lines[1])) as? [String: Any]
+        #expect((last?["set"] as? [String: Any])?.keys.sorted() == ["counter"])
+    }
+
+    @Test func journalReplayStopsAtTornRecord() throws {
+        let fileName = "journal_torn_\(UUID().uuidString).json"
+        let store = RadarFileStorageObject<JournalValue>(fileName: fileName, journaling: true)
+        defer { store.clear(); store.flush() }
+
+        store.write(JournalValue(counter: 1))
+        store.modify { value in value?.counter = 2 }
+        store.flush()
+
+        // simulate a crash partway through appending the next record
+        let handle = try FileHandle(forWritingTo: journalURL(fileName))
+        handle.seekToEndOfFile()
+        handle.write(Data("{\"set\":{\"coun".utf8))
+        handle.closeFile()
+
+        let reloaded = RadarFileStorageObject<JournalValue>(fileName: fileName, journaling: true)
+        #expect(reloaded.read()?.counter == 2)
+        reloaded.flush()
+    }
+
+    @Test func journalWriteBeforeReadDropsTornRecord() throws {
+        let fileName = "journal_torn_write_\(UUID().uuidString).json"
+        let store = RadarFileStorageObject<JournalValue>(fileName: fileName, journaling: true)
+        defer { store.clear(); store.flush() }
+
+        store.write(JournalValue(counter: 1))
+        store.flush()
+
+        let handle = try FileHandle(forWritingTo: journalURL(fileName))
+        handle.seekToEndOfFile()
+        handle.write(Data("{\"set\":{\"coun".utf8))
+        handle.closeFile()
+
+        // a fresh object that writes without reading first appends after the torn record
+        let writer = RadarFileStorageObject<JournalValue>(fileName: fileName, journaling: true)
+        writer.write(JournalValue(counter: 5, note: "after"))
+        writer.flush()
+
+        let reloaded = RadarFileStorageObject<JournalValue>(fileName: fileName, journaling: true)
+        #expect(reloaded.read() == JournalValue(counter: 5, note: "after"))
+        reloaded.flush()
+    }
+
+    @Test func journalCompactsIntoSnapshot() throws {
+        let fileName = "journal_compact_\(UUID().uuidString).json"
+        let store = RadarFileStorageObject<JournalValue>(fileName: fileName, journaling: true)
+        defer { store.clear(); store.flush() }
+
+        store.write(JournalValue())
+        for i in 0..<2_000 {
+            store.modify { value in value?.note = String(repeating: "x", count: 64) + "\(i)" }
+        }
+        store.flush()
+
+        let journalSize = (try? FileManager.default.attributesOfItem(atPath: journalURL(fileName).path)[.size] as? Int) ?? 0
+        #expect(journalSize <= RadarFileStorageObject<JournalValue>.journalCompactionBytes)
+
+        let reloaded = RadarFileStorageObject<JournalValue>(fileName: fileName, journaling: true)
+        #expect(reloaded.read()?.note == String(repeating: "x", count: 64) + "1999")
+        reloaded.flush()
+    }
+
+    // MARK: - Coalescing
+
+    @Test func coalescedMutationsWriteOnceOnFlush() {
+        let fileName = "coalesce_flush_\(UUID().uuidString).json"
+        let store = RadarFileStorageObject<JournalValue>(fileName: fileName, coalescingInterval: 60)
+        defer { store.clear(); store.flush() }
+
+        store.write(JournalValue())
+        for i in 0..<10 {
+            store.modify { value in value?.counter = i }
+        }
+        #expect(store.writeStats.requested == 11)
+        #expect(store.writeStats.performed == 0)
+        #expect(RadarFileStorageObject<JournalValue>(fileName: fileName).read() == nil)
+
+        store.flush()
+        #expect(store.writeStats.performed == 1)
+        #expect(RadarFileStorageObject<JournalValue>(fileName: fileName).read()?.counter == 9)
+    }
+
+    @Test func coalescedMutationsWriteAfterInterval() async {
+        let fileName = "coalesce_interval_\(UUID().uuidString).json"
+        let store = RadarFileStorageObject<JournalValue>(fileName: fileName, coalescingInterval: 0.05)
+        defer { store.clear(); store.flush() }
+
+        store.write(JournalValue(counter: 1))
+        store.modify { value in value?.counter = 2 }
+        try? await Task.sleep(nanoseconds: 300_000_000)
+
+        #expect(store.writeStats.performed == 1)
+        #expect(RadarFileStorageObject<JournalValue>(fileName: fileName).read()?.counter == 2)
+    }
+
+    @Test func coalescedMutationsFlushOnBackground() {
+        let fileName = "coalesce_background_\(UUID().uuidString).json"
+        let store = RadarFileStorageObject<JournalValue>(fileName: fileName, journaling: true, coalescingInterval: 60)
+        defer { store.clear(); store.flush() }
+
+        store.write(JournalValue(counter: 3))
+        NotificationCenter.default.post(name: UIApplication.didEnterBackgroundNotification, object: nil)
+        #expect(store.writeStats.performed == 1)
+
+        store.flush()
+        #expect(RadarFileStorageObject<JournalValue>(fileName: fileName, journaling: true).read()?.counter == 3)
+    }
 }
@@ -0,0 +1,191 @@
+//
+//  RadarGeofenceIndexTests.swift
+//  RadarSDK
+//
+//  Copyright © 2026 Radar Labs, Inc. All rights reserved.
+//
+
+import CoreLocation
+import Foundation
+import Testing
+import XCTest
+
+@testable import RadarSDK
+
+@Suite
+struct RadarGeofenceIndexTests {
+
+    let originLat = 40.78382
+    let originLng = -73.97536
+
+    // MARK: - Helpers
+
+    /// Deterministic mix of circles and polygons scattered over a ~20 km square.
+    func makeGeofences(count: Int, seed: UInt64 = 42) -> [RadarGeofenceSwift] {
+        var generator = SplitMix64(seed: seed)
+        return (0..<count).map { i in
+            let lat = originLat + Double.random(in: -0.1...0.1, using: &generator)
+            let lng = originLng + Double.random(in: -0.1...0.1, using: &generator)
+            let radius = Double.random(in: 30...400, using: &generator)
+            let center = RadarCoordinateSwift(latitude: lat, longitude: lng)
+
+            let geometry: RadarGeofenceGeometrySwift
+            if i % 2 == 0 {
+                geometry = .circle(center: center, radius: radius)
+            } else {
+                let vertexCount = 12
+                let latDelta = radius / 111_320.0
+                let lngDelta = radius / (111_320.0 * cos(lat * .pi / 180.0))
+                let coords = (0..<vertexCount).map { v -> RadarCoordinateSwift in
+                    let angle = Double(v) / Double(vertexCount) * 2 * .pi
+                    return RadarCoordinateSwift(latitude: lat + latDelta * sin(angle), longitude: lng + lngDelta * cos(angle))
+                }
+                geometry = .polygon(coordinates: coords, center: center, radius: radius)
+            }
+            return RadarGeofenceSwift(
+                id: "geofence\(i)", description: "Geofence \(i)", tag: nil, externalId: nil,
+                geometry: geometry, dwellThreshold: nil, geofenceStopDetection: nil, metadata: nil
+            )
+        }
+    }
+
+    func makeLocations(count: Int, seed: UInt64 = 7) -> [CLLocation] {
+        var generator = SplitMix64(seed: seed)
+        return (0..<count).map { _ in
+            CLLocation(
+                coordinate: CLLocationCoordinate2D(
+                    latitude: originLat + Double.random(in: -0.1...0.1, using: &generator),
+                    longitude: originLng + Double.random(in: -0.1...0.1, using: &generator)
+                ),
+                altitude: 0,
+                horizontalAccuracy: Double.random(in: 5...150, using: &generator),
+                verticalAccuracy: -1,
+                timestamp: Date()
+            )
+        }
+    }
+
+    func linearMatches(_ geofences: [RadarGeofenceSwift], location: CLLocation, checkingForExit: Bool) -> [String] {
+        let accuracy = max(location.horizontalAccuracy, 0)
+        return geofences.filter {
+            RadarSyncManager.isLocationInside(geofence: $0, location: location, accuracy: accuracy, checkingForExit: checkingForExit, sdkConfig: nil)
+        }.map { $0.id }
+    }
+
+    func indexedMatches(_ index: RadarGeofenceIndex, location: CLLocation, checkingForExit: Bool) -> [String] {
+        let accuracy = max(location.horizontalAccuracy, 0)
+        return index.candidates(near: location.coordinate, radius: accuracy).filter {
+            RadarSyncManager.isLocationInside(geofence: $0, location: location, accuracy: accuracy, checkingForExit: checkingForExit, sdkConfig: nil)
+        }.map { $0.id }
+    }
+
+    // MARK: - Correctness
+
+    @Test("index returns the same geofences as a linear scan")
+    func matchesLinearScan() {
+        let geofences = makeGeofences(count: 500)
+        let index = RadarGeofenceIndex(geofences: geofences)
+
+        for location in makeLocations(count: 500) {
+            #expect(indexedMatches(index, location: location, checkingForExit: false) == linearMatches(geofences, location: location, checkingForExit: false))
+            #expect(indexedMatches(index, location: location, checkingForExit: true) == linearMatches(geofences, location: location, checkingForExit: true))
+        }
+    }
+
+    @Test("candidates exclude geofences far from the query")
+    func candidatesExcludeFarGeofences() {
+        let near = RadarGeofenceSwift(
+            id: "near", description: "", tag: nil, externalId: nil,
+            geometry: .circle(center: RadarCoordinateSwift(latitude: originLat, longitude: originLng), radius: 100),
+            dwellThreshold: nil, geofenceStopDetection: nil, metadata: nil
+        )
+        let far = RadarGeofenceSwift(
+            id: "far", description: "", tag: nil, externalId: nil,
+            geometry: .circle(center: RadarCoordinateSwift(latitude: originLat + 0.5, longitude: originLng), radius: 100),
+            dwellThreshold: nil, geofenceStopDetection: nil, metadata: nil
+        )
+        let index = RadarGeofenceIndex(geofences: [near, far])
+
+        let candidates = index.candidates(near: CLLocationCoordinate2D(latitude: originLat, longitude: originLng), radius: 50)
+        #expect(candidates.map { $0.id } == ["near"])
+    }
+
+    @Test("oversized geofences are always candidates")
+    func oversizedGeofencesAlwaysCandidates() {
+        let huge = RadarGeofenceSwift(
+            id: "huge", description: "", tag: nil, externalId: nil,
+            geometry: .circle(center: RadarCoordinateSwift(latitude: originLat, longitude: originLng), radius: 200_000),
+            dwellThreshold: nil, geofenceStopDetection: nil, metadata: nil
+        )
+        let index = RadarGeofenceIndex(geofences: [huge])
+
+        let candidates = index.candidates(near: CLLocationCoordinate2D(latitude: originLat + 1, longitude: originLng), radius: 10)
+        #expect(candidates.map { $0.id } == ["huge"])
+    }
+
+    @Test("polygon bounding box covers every vertex")
+    func polygonBoundingBoxCoversVertices() {
+        let coords = [
+            RadarCoordinateSwift(latitude: originLat, longitude: originLng),
+            RadarCoordinateSwift(latitude: originLat + 0.02, longitude: originLng),
+            RadarCoordinateSwift(latitude: originLat + 0.02, longitude: originLng + 0.03),
+        ]
+        let box = RadarGeofenceIndex.boundingBox(
+            for: .polygon(coordinates: coords, center: RadarCoordinateSwift(latitude: originLat, longitude: originLng), radius: 10))
+
+        for coord in coords {
+            #expect(box.minLatitude <= coord.latitude && coord.latitude <= box.maxLatitude)
+            #expect(box.minLongitude <= coord.longitude && coord.longitude <= box.maxLongitude)
+        }
+    }
+}
+
+/// Per-fix containment cost over 5,000 geofences, scanning every geofence vs querying the index.
+final class RadarGeofenceIndexBenchmarks: XCTestCase {
+    private let fixtures = RadarGeofenceIndexTests()
+    private lazy var geofences = fixtures.makeGeofences(count: 5_000)
+    private lazy var locations = fixtures.makeLocations(count: 200)
+
+    func testIndexBuild() {
+        let geofences = geofences
+        measure(metrics: [XCTClockMetric()]) {
+            _ = RadarGeofenceIndex(geofences: geofences)
+        }
+    }
+
+    func testLinearScan() {
+        let (fixtures, geofences, locations) = (fixtures, geofences, locations)
+        measure(metrics: [XCTClockMetric()]) {
+            for location in locations {
+                _ = fixtures.linearMatches(geofences, location: location, checkingForExit: false)
+            }
+        }
+    }
+
+    func testIndexedQuery() {
+        let (fixtures, locations) = (fixtures, locations)
+        let index = RadarGeofenceIndex(geofences: geofences)
+        measure(metrics: [XCTClockMetric()]) {
+            for location in locations {
+                _ = fixtures.indexedMatches(index, location: location, checkingForExit: false)
+            }
+        }
+    }
+}
+
+/// Small seeded generator so benchmark inputs are reproducible across runs.
+struct SplitMix64: RandomNumberGenerator {
+    private var state: UInt64
+
+    init(seed: UInt64) {
+        state = seed
+    }
+
+    mutating func next() -> UInt64 {
+        state &+= 0x9E37_79B9_7F4A_7C15
+        var z = state
+        z = (z ^ (z >> 30)) &* 0xBF58_476D_1CE4_E5B9
+        z = (z ^ (z >> 27)) &* 0x94D0_49BB_1331_11EB
+        return z ^ (z >> 31)
+    }
+}
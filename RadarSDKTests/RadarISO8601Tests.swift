@@ -0,0 +1,144 @@
+//
+//  RadarISO8601Tests.swift
+//  RadarSDKTests
+//
+//  Copyright © 2026 Radar Labs, Inc. All rights reserved.
+//
+
+import Foundation
+import Testing
+import XCTest
+
+@testable import RadarSDK
+
+@Suite
+struct RadarISO8601Tests {
+
+    private final class Fixtures {}
+
+    /// The track.json fixture with `count` events, each with its own dates.
+    static func trackResponse(events count: Int) throws -> [String: Any] {
+        guard let url = Bundle(for: Fixtures.self).url(forResource: "track", withExtension: "json"),
+            var response = try JSONSerialization.jsonObject(with: Data(contentsOf: url)) as? [String: Any],
+            let events = response["events"] as? [[String: Any]]
+        else {
+            throw CocoaError(.fileReadCorruptFile)
+        }
+        response["events"] = (0..<count).map { index in
+            var event = events[index % events.count]
+            let createdAt = Date(timeIntervalSince1970: 1_700_000_000 + Double(index) * 37.125)
+            event["createdAt"] = RadarUtils.isoDateFormatter.string(from: createdAt)
+            event["actualCreatedAt"] = RadarUtils.isoDateFormatter.string(from: createdAt.addingTimeInterval(-1.5))
+            return event
+        }
+        // round trip so the events are Foundation objects, as they are when read off the network
+        guard let roundTripped = try JSONSerialization.jsonObject(with: JSONSerialization.data(withJSONObject: response)) as? [String: Any] else {
+            throw CocoaError(.fileReadCorruptFile)
+        }
+        return roundTripped
+    }
+
+    /// Every `createdAt` and `actualCreatedAt` string in a track response.
+    static func eventDateStrings(_ response: [String: Any]) -> [String] {
+        let events = response["events"] as? [[String: Any]] ?? []
+        return events.flatMap { [$0["createdAt"] as? String, $0["actualCreatedAt"] as? String].compactMap { $0 } }
+    }
+
+    @Test("formats exactly as the date formatter")
+    func formatMatchesDateFormatter() {
+        // eighths of a second are exact in binary, so neither side can truncate a representation error differently
+        let dates = [Date(timeIntervalSince1970: 0), Date(timeIntervalSince1970: -1.5), Date(timeIntervalSince1970: 951_782_400.875)]
+            + (0..<2000).map { _ in Date(timeIntervalSince1970: Double(Int.random(in: -2_000_000_000...4_000_000_000)) + Double(Int.random(in: 0..<8)) / 8) }
+
+        for date in dates {
+            #expect(RadarISO8601.string(from: date) == RadarUtils.isoDateFormatter.string(from: date))
+        }
+    }
+
+    @Test("parses what the date formatter parses, to the millisecond")
+    func parseMatchesDateFormatter() throws {
+        for string in ["2019-11-15T17:31:18.454Z", "2018-10-06T15:30:03.713+0000", "2024-02-29T23:59:59.999-0500", "1969-12-31T23:59:59.001Z"] {
+            let expected = try #require(RadarUtils.isoDateFormatter.date(from: string))
+            let parsed = try #require(RadarISO8601.date(from: string))
+            #expect(abs(parsed.timeIntervalSince(expected)) < 0.0005)
+            #expect(RadarISO8601.string(from: parsed) == RadarUtils.isoDateFormatter.string(from: expected))
+        }
+    }
+
+    @Test("accepts fraction and offset variants")
+    func parsesVariants() throws {
+        let reference = try #require(RadarISO8601.date(from: "2026-03-01T12:00:00.000Z"))
+
+        #expect(RadarISO8601.date(from: "2026-03-01T12:00:00Z") == reference)
+        #expect(RadarISO8601.date(from: "2026-03-01T14:00:00+02:00") == reference)
+        #expect(RadarISO8601.date(from: "2026-03-01T07:00:00-05") == reference)
+        #expect(RadarISO8601.date(from: "2026-03-01T12:00:00.250000Z") == reference.addingTimeInterval(0.25))
+        #expect(RadarUtils.date(fromISOString: "2026-03-01T12:00:00.000Z") == reference)
+        #expect(RadarUtils.date(fromISOString: nil) == nil)
+        #expect(RadarUtils.isoString(from: nil) == nil)
+    }
+
+    @Test("rejects malformed timestamps", arguments: [
+        "", "2026-03-01", "2026-03-01T12:00:00", "2026-13-01T12:00:00Z", "2026-02-29T12:00:00Z", "2026-03-01T24:00:00Z", "2026-03-01T12:00:00.Z",
+        "2026-03-01T12:00:00Zjunk", "2026-03-01 12:00:00Z", "2026-03-01T12:00:00+2", "२०२६-03-01T12:00:00Z",
+    ])
+    func rejectsMalformed(_ string: String) {
+        #expect(RadarISO8601.date(from: string) == nil)
+    }
+
+    @Test("bridged strings parse the same as native ones")
+    func parsesBridgedStrings() {
+        func utf16Backed(_ string: String) -> String {
+            let characters = Array(string.utf16)
+            return NSString(characters: characters, length: characters.count) as String
+        }
+
+        let bridged = NSString(string: "2019-11-15T17:31:18.454Z") as String
+        #expect(RadarISO8601.date(from: bridged) == RadarISO8601.date(from: "2019-11-15T17:31:18.454Z"))
+        #expect(RadarISO8601.date(from: utf16Backed("2019-11-15T17:31:18.454Z")) == RadarISO8601.date(from: "2019-11-15T17:31:18.454Z"))
+
+        let longFraction = "2019-11-15T17:31:18.454" + String(repeating: "0", count: RadarISO8601.stackLength) + "Z"
+        #expect(RadarISO8601.date(from: utf16Backed(longFraction)) == RadarISO8601.date(from: "2019-11-15T17:31:18.454Z"))
+        #expect(RadarISO8601.date(from: utf16Backed("2019-11-15T17:31:18.454Z\u{00e9}")) == nil)
+    }
+
+    @Test("parses every event date in a large /track response")
+    func parsesTrackResponseDates() throws {
+        let response = try Self.trackResponse(events: 500)
+        let strings = Self.eventDateStrings(response)
+
+        #expect(strings.count == 1_000)
+        for string in strings {
+            let expected = try #require(RadarUtils.isoDateFormatter.date(from: string))
+            let parsed = try #require(RadarISO8601.date(from: string))
+            #expect(abs(parsed.timeIntervalSince(expected)) < 0.0005)
+        }
+
+        let decoded = RadarEvent.events(from: response["events"] as Any) ?? []
+        #expect(!decoded.isEmpty)
+        #expect(decoded.first?.createdAt == RadarUtils.isoDateFormatter.date(from: strings[0]))
+    }
+}
+
+/// Parsing the 1,000 event dates of a 500-event /track response, DateFormatter vs RadarISO8601.
+final class RadarISO8601Benchmarks: XCTestCase {
+
+    private func measureParsing(_ parse: @escaping (String) -> Date?) throws {
+        let strings = RadarISO8601Tests.eventDateStrings(try RadarISO8601Tests.trackResponse(events: 500))
+        measure(metrics: [XCTClockMetric()]) {
+            var parsed = 0
+            for string in strings where parse(string) != nil {
+                parsed += 1
+            }
+            XCTAssertEqual(parsed, strings.count)
+        }
+    }
+
+    func testDateFormatter() throws {
+        try measureParsing { RadarUtils.isoDateFormatter.date(from: $0) }
+    }
+
+    func testRadarISO8601() throws {
+        try measureParsing { RadarISO8601.date(from: $0) }
+    }
+}
@@ -0,0 +1,164 @@
+//
+//  RadarJSONWriterTests.swift
+//  RadarSDKTests
+//
+//  Copyright © 2026 Radar Labs, Inc. All rights reserved.
+//
+
+import Foundation
+import Testing
+import XCTest
+
+@testable import RadarSDK
+
+@Suite
+struct RadarJSONWriterTests {
+
+    let nowMs: Int64 = 1_760_000_000_000
+
+    func trackParams(locationMs: Int64, replayCount: Int = 0) -> NSMutableDictionary {
+        let params: NSMutableDictionary = [
+            "id": "5f1b2c3d4e5f6a7b8c9d0e1f",
+            "installId": "A1B2C3D4-E5F6-7890-ABCD-EF1234567890",
+            "description": "Line one\nLine \"two\"\t\\",
+            "latitude": 40.78382,
+            "longitude": -73.97536,
+            "accuracy": 65.0,
+            "altitude": 12.345678901,
+            "speed": -1.0,
+            "foreground": true,
+            "stopped": false,
+            "locationMs": NSNumber(value: locationMs),
+            "updatedAtMsDiff": 0,
+            "source": "FOREGROUND_LOCATION",
+            "lang": "日本語",
+            "geofenceIds": ["a", "b"],
+            "tripOptions": ["version": "2", "metadata": ["key": NSNull()]],
+            "trackingOptions": RadarTrackingOptions.presetResponsive.dictionaryValue(),
+        ]
+        if replayCount > 0 {
+            params["replays"] = (0..<replayCount).map { index -> NSDictionary in
+                let replay = params.mutableCopy() as! NSMutableDictionary  // swiftlint:disable:this force_cast
+                replay["locationMs"] = NSNumber(value: locationMs - Int64(index) * 60_000)
+                replay["replayed"] = true
+                replay.removeObject(forKey: "updatedAtMsDiff")
+                return replay
+            }
+        }
+        return params
+    }
+
+    /// The body as built before `RadarJSONWriter`: copy the params and every replay to stamp
+    /// `updatedAtMsDiff`, then serialize through `RadarUtils.jsonData`.
+    func legacyBody(_ params: NSDictionary, nowMs: Int64) -> (body: Data?, copies: Int) {
+        var copies = 0
+        guard params["updatedAtMsDiff"] != nil || params["replays"] != nil else {
+            return (RadarUtils.jsonData(params), copies)
+        }
+        let requestParams = params.mutableCopy() as! NSMutableDictionary  // swiftlint:disable:this force_cast
+        copies += 1
+        if let locationMs = params["locationMs"] as? NSNumber, params["updatedAtMsDiff"] != nil {
+            requestParams["updatedAtMsDiff"] = NSNumber(value: nowMs - locationMs.int64Value)
+        }
+        if let replays = params["replays"] as? [NSDictionary] {
+            requestParams["replays"] = replays.map { replay -> NSDictionary in
+                let updated = replay.mutableCopy() as! NSMutableDictionary  // swiftlint:disable:this force_cast
+                copies += 1
+                if let locationMs = replay["locationMs"] as? NSNumber {
+                    updated["updatedAtMsDiff"] = NSNumber(value: nowMs - locationMs.int64Value)
+                }
+                return updated
+            }
+        }
+        return (RadarUtils.jsonData(requestParams), copies)
+    }
+
+    func parse(_ data: Data?) -> NSDictionary? {
+        data.flatMap { try? JSONSerialization.jsonObject(with: $0) as? NSDictionary }
+    }
+
+    @Test func bodyMatchesLegacySerialization() throws {
+        let params = trackParams(locationMs: nowMs - 5_000, replayCount: 3)
+
+        let body = RadarJSONWriter.requestBody(params: params, nowMs: nowMs)
+
+        let written = try #require(parse(body))
+        let legacy = try #require(parse(legacyBody(params, nowMs: nowMs).body))
+        #expect(written.isEqual(legacy))
+    }
+
+    @Test func stampsUpdatedAtMsDiffAtSendTime() throws {
+        let params = trackParams(locationMs: nowMs - 5_000, replayCount: 2)
+
+        let written = try #require(parse(RadarJSONWriter.requestBody(params: params, nowMs: nowMs)))
+
+        #expect(written["updatedAtMsDiff"] as? Int == 5_000)
+        let replays = try #require(written["replays"] as? [NSDictionary])
+        #expect(replays.map { $0["updatedAtMsDiff"] as? Int } == [5_000, 65_000])
+        // the params themselves are left alone
+        #expect(params["updatedAtMsDiff"] as? Int == 0)
+    }
+
+    @Test func requestWithoutUpdatedAtMsDiffIsNotStamped() throws {
+        let params = trackParams(locationMs: nowMs - 5_000)
+        params.removeObject(forKey: "updatedAtMsDiff")
+
+        let written = try #require(parse(RadarJSONWriter.requestBody(params: params, nowMs: nowMs)))
+
+        #expect(written["updatedAtMsDiff"] == nil)
+        #expect(written["locationMs"] as? Int64 == nowMs - 5_000)
+    }
+
+    @Test func skipsValuesJSONCannotEncode() throws {
+        let params: NSDictionary = [
+            "valid": 1,
+            "nan": Double.nan,
+            "infinite": Double.infinity,
+            "date": Date(),
+            "nested": ["values": [1, Double.nan, "two", Date()] as [Any]],
+            1: "numeric key",
+            "large": UInt64.max,
+            "negative": Int64.min,
+        ]
+
+        let body = RadarJSONWriter.requestBody(params: params, nowMs: nowMs)
+
+        let written = try #require(parse(body))
+        #expect(Set(written.allKeys.compactMap { $0 as? String }) == ["valid", "nested", "large", "negative"])
+        #expect((written["nested"] as? NSDictionary)?["values"] as? [AnyHashable] == [1, "two"])
+        #expect(written.isEqual(parse(RadarUtils.jsonData(params))))
+    }
+
+    @Test("writer body matches the legacy body's size", arguments: [0, 120])
+    func bodySizeMatchesLegacy(replayCount: Int) {
+        let params = trackParams(locationMs: nowMs - 5_000, replayCount: replayCount)
+
+        let legacySize = legacyBody(params, nowMs: nowMs).body?.count ?? 0
+        let size = RadarJSONWriter.requestBody(params: params, nowMs: nowMs).count
+
+        #expect(size > 0)
+        #expect(abs(size - legacySize) < legacySize / 10 + 64)
+    }
+}
+
+/// Building a /track body with 120 replays, by copying and serializing dictionaries vs the
+/// streaming writer.
+final class RadarJSONWriterBenchmarks: XCTestCase {
+    private let fixtures = RadarJSONWriterTests()
+
+    func testLegacyBody() {
+        let fixtures = fixtures
+        let params = fixtures.trackParams(locationMs: fixtures.nowMs - 5_000, replayCount: 120)
+        measure(metrics: [XCTClockMetric(), XCTMemoryMetric()]) {
+            XCTAssertNotNil(fixtures.legacyBody(params, nowMs: fixtures.nowMs).body)
+        }
+    }
+
+    func testWriterBody() {
+        let nowMs = fixtures.nowMs
+        let params = fixtures.trackParams(locationMs: nowMs - 5_000, replayCount: 120)
+        measure(metrics: [XCTClockMetric(), XCTMemoryMetric()]) {
+            XCTAssertFalse(RadarJSONWriter.requestBody(params: params, nowMs: nowMs).isEmpty)
+        }
+    }
+}
@@ -6,6 +6,7 @@
 //
 
 import Testing
+import XCTest
 
 @testable import RadarSDK
 
@@ -32,6 +33,17 @@ struct RadarLogBufferTests {
         return documents.appendingPathComponent("RadarSDK/\(file)")
     }
 
+    // persisted logs live in numbered segment files next to the legacy logs file
+    func segments(_ file: String) -> URL? {
+        self.file("\(file).segments")
+    }
+
+    func logsFrom(segments directory: URL) -> [String] {
+        let names = (try? FileManager.default.contentsOfDirectory(atPath: directory.path)) ?? []
+        let ids = names.compactMap { Int($0.replacingOccurrences(of: ".log", with: "")) }.sorted()
+        return ids.flatMap { logsFrom(url: directory.appendingPathComponent("\($0).log")) }
+    }
+
     func logsFrom(url: URL) -> [String] {
         do {
             let data = try Data(contentsOf: url)
@@ -60,12 +72,13 @@ struct RadarLogBufferTests {
 
         #expect(await buffer.logs.count == 3)
 
-        guard let file = file(logsFile) else {
+        guard let file = segments(logsFile) else {
             Issue.record("logsFile should not produce invalid URL")
             return
         }
 
-        let fileLogs = logsFrom(url: file)
+        await buffer.commitPendingLogs()
+        let fileLogs = logsFrom(segments: file)
         #expect(fileLogs.count == 3)
 
         try? FileManager.default.removeItem(at: file)
@@ -91,12 +104,13 @@ struct RadarLogBufferTests {
 
         #expect(await buffer.logs.count == 0)
 
-        guard let file = file(logsFile) else {
+        guard let file = segments(logsFile) else {
             Issue.record("logsFile should not produce invalid URL")
             return
         }
 
-        let fileLogs = logsFrom(url: file)
+        await buffer.commitPendingLogs()
+        let fileLogs = logsFrom(segments: file)
         #expect(fileLogs.count == 0)
 
         try? FileManager.default.removeItem(at: file)
@@ -121,7 +135,12 @@ struct RadarLogBufferTests {
         try? await Task.sleep(nanoseconds: 200_000_000)
         #expect(await buffer.logs.count == 3)
 
-        file?.delete()
+        // the legacy file is migrated into segments
+        #expect(file.map { FileManager.default.fileExists(atPath: $0.file.path) } == false)
+        if let segments = segments(logsFile) {
+            #expect(logsFrom(segments: segments).count == 3)
+            try? FileManager.default.removeItem(at: segments)
+        }
     }
 
     @Test func purgesBufferWhenFilled() async throws {
@@ -130,7 +149,7 @@ struct RadarLogBufferTests {
         // buffer initialization is async, wait for logs to be loaded
         try? await Task.sleep(nanoseconds: 1_000_000_000)
 
-        guard let file = file(logsFile) else {
+        guard let file = segments(logsFile) else {
             Issue.record("logsFile should not produce invalid URL")
             return
         }
@@ -147,7 +166,8 @@ struct RadarLogBufferTests {
         await buffer.log(simpleLog("test10"))
 
         #expect(await buffer.logs.count == 10)
-        let fileLogs = logsFrom(url: file)
+        await buffer.commitPendingLogs()
+        let fileLogs = logsFrom(segments: file)
         #expect(fileLogs.count == 10)
 
         // 11th log should trigger a purge
@@ -155,9 +175,237 @@ struct RadarLogBufferTests {
 
         #expect((await buffer.logs.count) == 5)
 
-        let fileLogsAfterPurge = logsFrom(url: file)
+        await buffer.commitPendingLogs()
+        let fileLogsAfterPurge = logsFrom(segments: file)
         #expect(fileLogsAfterPurge.count == 5)
 
         try? FileManager.default.removeItem(at: file)
     }
+
+    @Test func logsAreCommittedInBatches() async throws {
+        let logsFile = "test/logs5.txt"
+        let buffer = RadarLogBuffer(logsFile: logsFile, maxLogs: 100, keep: 50, logPersistence: true)
+        try? await Task.sleep(nanoseconds: 1_000_000_000)
+
+        guard let file = segments(logsFile) else {
+            Issue.record("logsFile should not produce invalid URL")
+            return
+        }
+        defer { try? FileManager.default.removeItem(at: file) }
+
+        await buffer.log(contentsOf: (1...20).map { simpleLog("test\($0)") })
+        #expect(logsFrom(segments: file).count == 0)
+
+        // segments hold 25 logs; filling the first commits it in one write, the rest waits
+        await buffer.log(contentsOf: (21...30).map { simpleLog("test\($0)") })
+        #expect(logsFrom(segments: file).count == 25)
+
+        await buffer.commitPendingLogs()
+        #expect(logsFrom(segments: file).count == 30)
+
+        let reloaded = RadarLogBuffer(logsFile: logsFile, maxLogs: 100, keep: 50, logPersistence: true)
+        await waitUntil { await reloaded.logs.count >= 30 }
+        #expect(await reloaded.logs.map(\.message) == (1...30).map { "test\($0)" })
+    }
+
+    @Test func purgeDropsWholeSegments() async throws {
+        let logsFile = "test/logs6.txt"
+        let buffer = RadarLogBuffer(logsFile: logsFile, maxLogs: 20, keep: 8, logPersistence: true)
+        try? await Task.sleep(nanoseconds: 1_000_000_000)
+
+        guard let file = segments(logsFile) else {
+            Issue.record("logsFile should not produce invalid URL")
+            return
+        }
+        defer { try? FileManager.default.removeItem(at: file) }
+
+        for index in 1...21 {
+            await buffer.log(simpleLog("test\(index)"))
+        }
+        await buffer.commitPendingLogs()
+
+        // segments hold 6 logs, so the 8 kept logs span the last two segments
+        #expect(await buffer.logs.count == 8)
+        let fileLogs = logsFrom(segments: file)
+        #expect(fileLogs.count == 9)
+        let names = (try? FileManager.default.contentsOfDirectory(atPath: file.path)) ?? []
+        #expect(Set(names) == ["2.log", "3.log", "head"])
+
+        // the extra log in the oldest segment is skipped on load
+        let reloaded = RadarLogBuffer(logsFile: logsFile, maxLogs: 20, keep: 8, logPersistence: true)
+        await waitUntil { await reloaded.logs.count >= 8 }
+        try? await Task.sleep(nanoseconds: 200_000_000)
+        #expect(await reloaded.logs.map(\.message) == (14...21).map { "test\($0)" })
+    }
+
+    func sentMessages(_ request: URLRequest) -> [String] {
+        guard let body = request.httpBody,
+            let json = try? JSONSerialization.jsonObject(with: gunzip(body) ?? body) as? [String: Any],
+            let logs = json["logs"] as? [[String: Any]]
+        else {
+            return []
+        }
+        // uploaded messages carry the date and battery suffixes from RadarLog.description
+        return logs.compactMap { ($0["message"] as? String)?.components(separatedBy: " | at ").first }
+    }
+
+    @Test func flushSendsChunksAndKeepsUnacknowledgedLogs() async throws {
+        RadarSettings.publishableKey = "test-key"
+        let session = MockURLSession()
+        let client = RadarAPIClient(apiHelper: RadarAPIHelper(session: session))
+
+        // the second chunk fails once
+        var attempts = 0
+        session.on(
+            { _ in
+                attempts += 1
+                return attempts == 2
+            }, Data(), statusCode: 500)
+        session.on("\(RadarSettings.host)/v1/logs", [:])
+
+        let buffer = RadarLogBuffer(logsFile: "test/logs7.txt", chunkSize: 100, logPersistence: false, apiClient: client)
+        try? await Task.sleep(nanoseconds: 1_000_000_000)
+
+        await buffer.log(contentsOf: (1...250).map { simpleLog("test\($0)") })
+        await buffer.flush()
+
+        #expect(session.requests.count == 2)
+        #expect(sentMessages(session.requests[0]) == (1...100).map { "test\($0)" })
+        #expect(await buffer.logs.map(\.message) == (101...250).map { "test\($0)" })
+
+        await buffer.flush()
+
+        #expect(await buffer.logs.isEmpty)
+        #expect(session.requests.count == 4)
+        let resent = session.requests[2...].flatMap { sentMessages($0) }
+        #expect(resent == (101...250).map { "test\($0)" })
+    }
+
+    @Test func repeatedLoadsObserveTheLifecycleOnce() async throws {
+        let buffer = RadarLogBuffer(logsFile: "test/logs10.txt", logPersistence: true)
+        await waitUntil { await !buffer.lifecycleObservers.isEmpty }
+
+        await buffer.loadLogs()
+        await buffer.loadLogs()
+        #expect(await buffer.lifecycleObservers.count == 2)
+    }
+
+    @Test func acknowledgedLogsAreNotLoadedAgain() async throws {
+        RadarSettings.publishableKey = "test-key"
+        let session = MockURLSession()
+        let client = RadarAPIClient(apiHelper: RadarAPIHelper(session: session))
+
+        // the third chunk fails, so the first two are acknowledged
+        var attempts = 0
+        session.on(
+            { _ in
+                attempts += 1
+                return attempts == 3
+            }, Data(), statusCode: 500)
+        session.on("\(RadarSettings.host)/v1/logs", [:])
+
+        let logsFile = "test/logs8.txt"
+        guard let file = segments(logsFile) else {
+            Issue.record("logsFile should not produce invalid URL")
+            return
+        }
+        defer { try? FileManager.default.removeItem(at: file) }
+
+        let buffer = RadarLogBuffer(logsFile: logsFile, chunkSize: 10, logPersistence: true, apiClient: client)
+        try? await Task.sleep(nanoseconds: 1_000_000_000)
+
+        await buffer.log(contentsOf: (1...30).map { simpleLog("test\($0)") })
+        await buffer.commitPendingLogs()
+        await buffer.flush()
+        #expect(await buffer.logs.map(\.message) == (21...30).map { "test\($0)" })
+
+        // all 30 logs share one segment, so only the head offset records what was sent
+        let reloaded = RadarLogBuffer(logsFile: logsFile, chunkSize: 10, logPersistence: true, apiClient: client)
+        await waitUntil { await reloaded.logs.count >= 10 }
+        try? await Task.sleep(nanoseconds: 200_000_000)
+        #expect(await reloaded.logs.map(\.message) == (21...30).map { "test\($0)" })
+    }
+
+    /// Logs to the buffer while each upload is in flight, the way the API metrics log does.
+    final class LoggingURLSession: RadarURLSessionProtocol, @unchecked Sendable {
+        var buffer: RadarLogBuffer?
+        var requests = [URLRequest]()
+
+        func data(for request: URLRequest) async throws -> (Data, URLResponse) {
+            requests.append(request)
+            await buffer?.log(RadarLog(level: .debug, message: "upload \(requests.count)", type: .none, createdAt: Date(), includeDate: true, battery: 1.0))
+            let response = HTTPURLResponse(url: request.url!, statusCode: 200, httpVersion: "1.0", headerFields: [:])!
+            return (Data("{}".utf8), response as URLResponse)
+        }
+    }
+
+    @Test func flushStopsAtLogsAddedDuringUpload() async throws {
+        RadarSettings.publishableKey = "test-key"
+        let session = LoggingURLSession()
+        let client = RadarAPIClient(apiHelper: RadarAPIHelper(session: session))
+
+        let buffer = RadarLogBuffer(logsFile: "test/logs9.txt", chunkSize: 2, logPersistence: false, apiClient: client)
+        session.buffer = buffer
+        try? await Task.sleep(nanoseconds: 1_000_000_000)
+
+        await buffer.log(contentsOf: (1...3).map { simpleLog("test\($0)") })
+        await buffer.flush()
+
+        #expect(session.requests.count == 2)
+        #expect(await buffer.logs.map(\.message) == ["upload 1", "upload 2"])
+    }
+
+    /// Track-handling debug logs, the bulk of what a buffer flush uploads.
+    static func uploadLogs(count: Int) -> [RadarLog] {
+        (0..<count).map {
+            RadarLog(
+                level: .debug, message: "Handling location | source = foregroundLocation; location = 40.78382, -73.97536; accuracy = 65.0; index = \($0)",
+                type: .sdkCall, createdAt: Date(), includeDate: true, battery: 0.8)
+        }
+    }
+
+    @Test("log uploads are sent gzip compressed", arguments: [100, 500])
+    func logUploadIsCompressed(count: Int) async throws {
+        RadarSettings.publishableKey = "test-key"
+        let session = MockURLSession()
+        session.on("\(RadarSettings.host)/v1/logs", [:])
+        let client = RadarAPIClient(apiHelper: RadarAPIHelper(session: session))
+
+        let logs = Self.uploadLogs(count: count)
+        let uncompressed = try JSONSerialization.data(withJSONObject: ["logs": logs.map(\.dict)], options: [])
+        try await client.sendLogs(logs: logs)
+
+        let sent = session.requests.first?.httpBody?.count ?? 0
+        #expect(session.requests.first?.value(forHTTPHeaderField: "Content-Encoding") == "gzip")
+        #expect(sent > 0)
+        #expect(sent < uncompressed.count / 3)
+    }
+}
+
+/// Sending a 500-log upload through the API helper, with the body as plain JSON vs gzip.
+final class RadarLogUploadBenchmarks: XCTestCase {
+
+    private func measureUpload(compressBody: Bool) {
+        let session = MockURLSession()
+        session.on({ _ in true }, Data("{}".utf8))
+        let helper = RadarAPIHelper(session: session)
+        let logs = RadarLogBufferTests.uploadLogs(count: 500)
+
+        measure(metrics: [XCTClockMetric()]) {
+            let sent = expectation(description: "upload sent")
+            Task {
+                _ = try? await helper.request(method: "POST", url: "https://api.radar.io/v1/logs", body: ["logs": logs.map(\.dict)], compressBody: compressBody)
+                sent.fulfill()
+            }
+            wait(for: [sent], timeout: 5)
+        }
+    }
+
+    func testUploadUncompressed() {
+        measureUpload(compressBody: false)
+    }
+
+    func testUploadGzip() {
+        measureUpload(compressBody: true)
+    }
 }
@@ -5,6 +5,7 @@
 //  Copyright © 2026 Radar Labs, Inc. All rights reserved.
 //
 
+import Foundation
 import Testing
 
 @testable import RadarSDK
@@ -112,4 +113,87 @@ struct RadarLoggerTests {
         await logger.awaitPendingLogs()
         #expect(delegate.messages.count == 4)
     }
+
+    @Test func messagesBelowLogLevelAreNotBuilt() async throws {
+        let logger = RadarLogger()
+        let delegate = MockRadarDelegate()
+
+        await logger.setDelegate(delegate)
+        logger.logLevelOverride = .info
+
+        var evaluated = [String]()
+        func message(_ text: String) -> String {
+            evaluated.append(text)
+            return text
+        }
+
+        logger.debug(message("debugLog"))
+        logger.info(message("infoLog"))
+        logger.log(level: .debug) { message("debugBlock") }
+        logger.log(level: .warning) { message("warningBlock") }
+
+        await logger.awaitPendingLogs()
+        #expect(evaluated == ["infoLog", "warningBlock"])
+        #expect(delegate.messages.count == 2)
+        #expect(!logger.isLoggable(.debug))
+        #expect(logger.isLoggable(.error))
+    }
+
+    @Test func logsAreDeliveredInOrderInBatches() async throws {
+        let logger = RadarLogger()
+        let delegate = MockRadarDelegate()
+
+        await logger.setDelegate(delegate)
+        logger.logLevelOverride = .debug
+
+        for i in 0..<200 {
+            logger.debug("log\(i)")
+        }
+
+        await logger.awaitPendingLogs()
+        #expect(delegate.messages.map { $0.components(separatedBy: " | ")[0] } == (0..<200).map { "log\($0)" })
+        #expect(logger.queueStats.enqueued == 200)
+        #expect(logger.queueStats.dropped == 0)
+        #expect(logger.queueStats.batches < 200)
+    }
+
+    @Test func batchesReachTheLogBufferInOrder() async throws {
+        let logger = RadarLogger()
+        logger.logLevelOverride = .debug
+        let prefix = "ordered-\(UUID().uuidString)"
+
+        // yield between small groups so the logs are drained as many batches
+        for i in 0..<300 {
+            logger.debug("\(prefix) \(i)", includeBattery: i % 2 == 0)
+            if i % 10 == 9 {
+                try await Task.sleep(nanoseconds: 1_000_000)
+            }
+        }
+
+        await logger.awaitPendingLogs()
+        let buffered = await RadarLogBuffer.shared.logs.map(\.message).filter { $0.hasPrefix(prefix) }
+        #expect(buffered == (0..<300).map { "\(prefix) \($0)" })
+        #expect(logger.queueStats.batches > 1)
+    }
+
+    @Test func logQueueDropsOldestWhenFull() {
+        let queue = RadarLogQueue(capacity: 3)
+        func entry(_ message: String) -> RadarLogQueue.Entry {
+            RadarLogQueue.Entry(level: .debug, message: message, type: .none, createdAt: Date(), includeDate: false, includeBattery: false)
+        }
+
+        #expect(queue.enqueue(entry("a")))
+        for message in ["b", "c", "d", "e"] {
+            #expect(!queue.enqueue(entry(message)))
+        }
+
+        let (entries, dropped) = queue.drain()
+        #expect(entries.map(\.message) == ["c", "d", "e"])
+        #expect(dropped == 2)
+        #expect(queue.stats == RadarLogQueue.Stats(enqueued: 5, dropped: 2, batches: 1))
+
+        // the next log after a drain schedules a new one
+        #expect(queue.enqueue(entry("f")))
+        #expect(queue.drain().dropped == 0)
+    }
 }
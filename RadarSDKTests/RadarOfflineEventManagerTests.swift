@@ -139,6 +139,27 @@ extension RadarSerializedTests {
             #expect(result != nil)
         }
 
+        @Test("updateTrackingOptions doesn't change the cached remote options")
+        func updateTrackingOptions_leavesCachedOptionsUnchanged() {
+            let config = RadarSdkConfiguration(dict: [
+                "useOfflineRTOUpdates": true,
+                "remoteTrackingOptions": [
+                    makeRemoteTrackingOptions(type: "default", preset: "responsive"),
+                    makeRemoteTrackingOptions(type: "inGeofence", preset: "continuous", geofenceTags: ["neighborhood"]),
+                ],
+            ])
+            RadarSettings.sdkConfiguration = config
+
+            let first = RadarOfflineEventManager.updateTrackingOptions(geofenceTags: ["neighborhood"])
+            #expect(first?.type == .inGeofence)
+            first?.desiredStoppedUpdateInterval = 1
+
+            let cached = RadarRemoteTrackingOptions.trackingOptions(forKey: "inGeofence", in: RadarSettings.sdkConfiguration?.remoteTrackingOptions)
+            #expect(cached?.type == .default)
+            #expect(cached?.desiredStoppedUpdateInterval == RadarTrackingOptions.presetContinuous.desiredStoppedUpdateInterval)
+            #expect(cached !== first)
+        }
+
         @Test("updateTrackingOptions returns default options when tags don't match")
         func updateTrackingOptions_noGeofenceMatch() {
             let config = RadarSdkConfiguration(dict: [
@@ -172,4 +172,174 @@ final class RadarReplayBufferTests: XCTestCase {
         XCTAssertEqual(captured, .errorServer)
         XCTAssertEqual(buffer.batchCount(), 1)  // failed replay written back
     }
+
+    // MARK: - Ring buffer and log
+
+    func test_ring_wrapsAndRemovesBySequence() {
+        var ring = RadarReplayRing(capacity: 4)
+        for index in 0..<6 {
+            ring.append(RadarReplay(params: ["i": index]))
+        }
+        XCTAssertEqual(ring.count, 4)
+        XCTAssertEqual(ring.entries.map(\.sequence), [3, 4, 5, 6])
+        XCTAssertEqual(ring.first?.replay.replayParams as NSDictionary?, ["i": 2] as NSDictionary)
+
+        ring.removeThrough(sequence: 4)
+        XCTAssertEqual(ring.entries.map(\.sequence), [5, 6])
+
+        ring.append(RadarReplay(params: ["i": 6]))
+        XCTAssertEqual(ring.entries.map(\.sequence), [5, 6, 7])
+        XCTAssertEqual(ring.nextSequence, 8)
+    }
+
+    func test_flushReplays_successDoesNotResurrectFlushedReplays() {
+        setPersistence(true)
+        let buffer = RadarReplayBuffer.sharedInstance
+        buffer.writeNewReplayToBuffer(["i": 1])
+        buffer.writeNewReplayToBuffer(["i": 2])
+
+        let mock = MockRadarSwiftBridge()
+        mock.flushStatus = .success
+        let original = RadarSwift.bridge
+        RadarSwift.bridge = mock
+        defer { RadarSwift.bridge = original }
+
+        buffer.flushReplays(withCompletionHandler: nil, completionHandler: nil)
+        buffer.writeNewReplayToBuffer(["i": 3])
+
+        buffer.mutableReplayBuffer = []
+        buffer.loadReplaysFromPersistentStore()
+        XCTAssertEqual(buffer.batchCount(), 1)
+        XCTAssertEqual(buffer.flushableReplays.first?.replayParams as NSDictionary?, ["i": 3] as NSDictionary)
+    }
+
+    func test_persistence_keepsNewestReplaysAcrossCompaction() {
+        setPersistence(true)
+        let buffer = RadarReplayBuffer.sharedInstance
+        for index in 0..<300 {
+            buffer.writeNewReplayToBuffer(["i": index])
+        }
+        XCTAssertEqual(buffer.batchCount(), 120)
+
+        buffer.mutableReplayBuffer = []
+        buffer.loadReplaysFromPersistentStore()
+        XCTAssertEqual(buffer.batchCount(), 96)  // newest 120, every 5th pruned
+        XCTAssertEqual(buffer.flushableReplays.last?.replayParams as NSDictionary?, ["i": 299] as NSDictionary)
+    }
+
+    func test_log_ignoresTornRecord() throws {
+        let name = "radar_replays_test_\(UUID().uuidString)"
+        let log = RadarReplayLog(name: name, capacity: 10)
+        log.clear(tail: 1)
+        log.append(RadarReplayRing.Entry(sequence: 1, replay: RadarReplay(params: ["i": 1])))
+        log.append(RadarReplayRing.Entry(sequence: 2, replay: RadarReplay(params: ["i": 2])))
+
+        // length prefix promising more bytes than were written
+        let file = try XCTUnwrap(RadarFileStorage(fileName: "\(name).log"))
+        file.append(data: Data([200, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 123]))
+
+        let reloaded = RadarReplayLog(name: name, capacity: 10)
+        XCTAssertEqual(reloaded.load().map(\.sequence), [1, 2])
+        XCTAssertEqual(reloaded.index.tail, 3)
+
+        file.delete()
+        RadarFileStorage(fileName: "\(name).index")?.delete()
+    }
+
+    func test_log_appendsAfterTornRecord() throws {
+        let name = "radar_replays_test_\(UUID().uuidString)"
+        let log = RadarReplayLog(name: name, capacity: 10)
+        log.clear(tail: 1)
+        log.append(RadarReplayRing.Entry(sequence: 1, replay: RadarReplay(params: ["i": 1])))
+
+        // a torn header whose length would swallow the records appended after it
+        let file = try XCTUnwrap(RadarFileStorage(fileName: "\(name).log"))
+        file.append(data: Data([60, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 123]))
+
+        let reloaded = RadarReplayLog(name: name, capacity: 10)
+        XCTAssertEqual(reloaded.load().map(\.sequence), [1])
+        reloaded.append(RadarReplayRing.Entry(sequence: 2, replay: RadarReplay(params: ["i": 2])))
+        reloaded.append(RadarReplayRing.Entry(sequence: 3, replay: RadarReplay(params: ["i": 3])))
+
+        let again = RadarReplayLog(name: name, capacity: 10)
+        let entries = again.load()
+        XCTAssertEqual(entries.map(\.sequence), [1, 2, 3])
+        XCTAssertEqual(entries.last?.replay.replayParams as NSDictionary?, ["i": 3] as NSDictionary)
+        XCTAssertEqual(again.index.tail, 4)
+
+        file.delete()
+        RadarFileStorage(fileName: "\(name).index")?.delete()
+    }
+
+    func test_log_stopsAtSequenceThatDoesNotGrow() throws {
+        let name = "radar_replays_test_\(UUID().uuidString)"
+        let log = RadarReplayLog(name: name, capacity: 10)
+        log.clear(tail: 1)
+        log.append(RadarReplayRing.Entry(sequence: 1, replay: RadarReplay(params: ["i": 1])))
+
+        // a complete header with a garbage sequence must not trap or inflate the tail
+        let file = try XCTUnwrap(RadarFileStorage(fileName: "\(name).log"))
+        file.append(data: Data([1, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 123]))
+
+        let reloaded = RadarReplayLog(name: name, capacity: 10)
+        XCTAssertEqual(reloaded.load().map(\.sequence), [1])
+        XCTAssertEqual(reloaded.index.tail, 2)
+        XCTAssertEqual(reloaded.recordCount, 1)
+
+        file.delete()
+        RadarFileStorage(fileName: "\(name).index")?.delete()
+    }
+
+    func test_loadReplays_migratesLegacyUserDefaults() throws {
+        let replays = [RadarReplay(params: ["i": 1]), RadarReplay(params: ["i": 2])]
+        let data = try NSKeyedArchiver.archivedData(withRootObject: replays, requiringSecureCoding: true)
+        UserDefaults.standard.set(data, forKey: "radar-replays")
+
+        let buffer = RadarReplayBuffer.sharedInstance
+        buffer.loadReplaysFromPersistentStore()
+        XCTAssertEqual(buffer.batchCount(), 2)
+        XCTAssertNil(UserDefaults.standard.object(forKey: "radar-replays"))
+
+        buffer.mutableReplayBuffer = []
+        buffer.loadReplaysFromPersistentStore()
+        XCTAssertEqual(buffer.batchCount(), 2)
+    }
+
+    func test_batchLimits_adaptiveOverridesFixedOptions() {
+        setPersistence(false)
+        let buffer = RadarReplayBuffer.sharedInstance
+        buffer.adaptiveBatch.reset()
+        let options = RadarTrackingOptions.presetResponsive
+        options.batchSize = 3
+        options.batchInterval = 45
+
+        XCTAssertEqual(buffer.batchLimits(for: options, foreground: false), RadarAdaptiveBatchPolicy.Limits(size: 3, interval: 45))
+
+        options.batchAdaptive = true
+        let limits = buffer.batchLimits(for: options, foreground: false)
+        XCTAssertEqual(limits, buffer.adaptiveBatch.limits(network: RadarUtils.networkType, foreground: false))
+
+        for index in 0..<limits.size {
+            XCTAssertFalse(buffer.shouldFlushBatch(withOptions: options))
+            buffer.addToBatch(["i": index, "foreground": false], options: options)
+        }
+        XCTAssertTrue(buffer.shouldFlushBatch(withOptions: options))
+
+        // timers are scheduled on the main queue; let that happen before canceling
+        let scheduled = expectation(description: "batch timer scheduled")
+        DispatchQueue.main.async { scheduled.fulfill() }
+        wait(for: [scheduled], timeout: 1)
+        buffer.cancelBatchTimer()
+    }
+
+    func test_batchEvent_markedLocationIsConsumedOnce() {
+        let buffer = RadarReplayBuffer.sharedInstance
+        buffer.adaptiveBatch.reset()
+        let location = CLLocation(latitude: 40.78382, longitude: -73.97536)
+
+        XCTAssertFalse(buffer.consumeBatchEvent(for: location))
+        buffer.markBatchEvent(for: location)
+        XCTAssertTrue(buffer.consumeBatchEvent(for: location))
+        XCTAssertFalse(buffer.consumeBatchEvent(for: location))
+    }
 }
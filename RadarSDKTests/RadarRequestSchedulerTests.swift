@@ -0,0 +1,157 @@
+//
+//  RadarRequestSchedulerTests.swift
+//  RadarSDKTests
+//
+//  Copyright © 2026 Radar Labs, Inc. All rights reserved.
+//
+
+import Foundation
+import Testing
+import XCTest
+
+@testable import RadarSDK
+
+@Suite
+struct RadarRequestSchedulerTests {
+
+    struct Run {
+        let index: Int
+        let startedAt: TimeInterval
+        let queueLatency: TimeInterval
+    }
+
+    /// Schedules `count` blocks at once and returns when they have all run, in run order.
+    func burst(_ scheduler: RadarRequestScheduler, count: Int) async -> [Run] {
+        await withCheckedContinuation { continuation in
+            // blocks run on the scheduler's serial queue, so `runs` needs no lock
+            nonisolated(unsafe) var runs = [Run]()
+            for index in 0..<count {
+                scheduler.schedule { queueLatency, deliver in
+                    deliver {}
+                    runs.append(Run(index: index, startedAt: ProcessInfo.processInfo.systemUptime, queueLatency: queueLatency))
+                    if runs.count == count {
+                        continuation.resume(returning: runs)
+                    }
+                }
+            }
+        }
+    }
+
+    @Test func burstRunsInOrderWithSpacing() async {
+        let scheduler = RadarRequestScheduler(queue: DispatchQueue(label: "test.scheduler"), spacing: 0.05)
+
+        let runs = await burst(scheduler, count: 4)
+
+        #expect(runs.map(\.index) == [0, 1, 2, 3])
+        #expect(runs[0].queueLatency < 0.05)
+        for (previous, next) in zip(runs, runs.dropFirst()) {
+            #expect(next.startedAt - previous.startedAt >= 0.045)
+        }
+    }
+
+    @Test func blockAfterQuietPeriodRunsImmediately() async throws {
+        let scheduler = RadarRequestScheduler(queue: DispatchQueue(label: "test.scheduler"), spacing: 0.05)
+
+        _ = await burst(scheduler, count: 1)
+        try await Task.sleep(nanoseconds: 100_000_000)
+        let runs = await burst(scheduler, count: 1)
+
+        #expect(runs[0].queueLatency < 0.05)
+    }
+
+    @Test func zeroSpacingRunsBurstWithoutWaiting() async {
+        let scheduler = RadarRequestScheduler(queue: DispatchQueue(label: "test.scheduler"), spacing: 0)
+
+        let runs = await burst(scheduler, count: 20)
+
+        #expect(runs.map(\.index) == Array(0..<20))
+        #expect(runs.allSatisfy { $0.queueLatency < 0.05 })
+    }
+
+    @Test func completionsAreDeliveredInScheduleOrder() async {
+        let scheduler = RadarRequestScheduler(queue: DispatchQueue(label: "test.scheduler"), spacing: 0)
+        let count = 4
+
+        let delivered: [Int] = await withCheckedContinuation { continuation in
+            // completions run on the main queue, one at a time
+            nonisolated(unsafe) var delivered = [Int]()
+            for index in 0..<count {
+                scheduler.schedule { _, deliver in
+                    // earlier requests take longer, so their responses arrive last
+                    let delay = Double(count - index) * 0.02
+                    DispatchQueue.global().asyncAfter(deadline: .now() + delay) {
+                        deliver {
+                            delivered.append(index)
+                            if delivered.count == count {
+                                continuation.resume(returning: delivered)
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        #expect(delivered == [0, 1, 2, 3])
+    }
+
+    @Test("the last request in a burst waits only for the spacing", arguments: [5, 20])
+    func burstQueueingLatency(count: Int) async {
+        let spacing = 0.02
+        let scheduler = RadarRequestScheduler(queue: DispatchQueue(label: "test.scheduler"), spacing: spacing)
+
+        let runs = await burst(scheduler, count: count)
+
+        let max = runs.map(\.queueLatency).max() ?? 0
+        #expect(max >= Double(count - 1) * spacing * 0.9)
+        #expect(max < Double(count - 1) * spacing + 0.5)
+    }
+}
+
+/// Time for a burst of 10 requests with 50 ms responses to all complete, spaced 20 ms apart.
+final class RadarRequestSchedulerBenchmarks: XCTestCase {
+    private let count = 10
+    private let spacing = 0.02
+    private let responseTime = 0.05
+
+    /// What RadarAPIHelper did before the scheduler: each request held a semaphore until its
+    /// response arrived, then slept for the spacing before releasing it.
+    func testSemaphoreBurst() {
+        let (count, spacing, responseTime) = (count, spacing, responseTime)
+        measure(metrics: [XCTClockMetric()]) {
+            let queue = DispatchQueue(label: "test.semaphore")
+            let semaphore = DispatchSemaphore(value: 1)
+            let completed = expectation(description: "burst completed")
+            completed.expectedFulfillmentCount = count
+            for _ in 0..<count {
+                queue.async {
+                    semaphore.wait()
+                    DispatchQueue.global().asyncAfter(deadline: .now() + responseTime) {
+                        completed.fulfill()
+                        Thread.sleep(forTimeInterval: spacing)
+                        semaphore.signal()
+                    }
+                }
+            }
+            wait(for: [completed], timeout: 10)
+        }
+    }
+
+    func testSchedulerBurst() {
+        let (count, spacing, responseTime) = (count, spacing, responseTime)
+        measure(metrics: [XCTClockMetric()]) {
+            let scheduler = RadarRequestScheduler(queue: DispatchQueue(label: "test.scheduler"), spacing: spacing)
+            let completed = expectation(description: "burst completed")
+            completed.expectedFulfillmentCount = count
+            for _ in 0..<count {
+                scheduler.schedule { _, deliver in
+                    DispatchQueue.global().asyncAfter(deadline: .now() + responseTime) {
+                        deliver {
+                            completed.fulfill()
+                        }
+                    }
+                }
+            }
+            wait(for: [completed], timeout: 10)
+        }
+    }
+}
@@ -5,6 +5,11 @@
 #import "RadarSyncTestHelper.h"
 #import "../RadarSDK/RadarAPIClient.h"
 #import "../RadarSDK/RadarLocationManager.h"
+#import "../RadarSDK/RadarRequestScheduler.h"
+#import "../RadarSDK/RadarTrackCoalescer.h"
+#import "../RadarSDK/RadarStageTimings.h"
+#import "../RadarSDK/RadarVerifiedTokenCache.h"
+#import "../RadarSDK/RadarVerifiedLocationToken+Internal.h"
 #import "../RadarSDK/RadarGeofence+Internal.h"
 #import "../RadarSDK/RadarCircleGeometry+Internal.h"
 #import "../RadarSDK/RadarPolygonGeometry+Internal.h"
@@ -16,3 +21,6 @@
 #import "../RadarSDK/RadarTrip+Internal.h"
 #import "../RadarSDK/RadarBeacon+Internal.h"
 #import "../RadarSDK/RadarSegment+Internal.h"
+#import "../RadarSDK/RadarEnumMapping.h"
+#import "../RadarSDK/RadarRouteMode+Internal.h"
+#import "../RadarSDK/RadarUser+Internal.h"
@@ -29,6 +29,8 @@
 #import "RadarTripOptions.h"
 #import "RadarReplayBuffer.h"
 #import "../RadarSDK/RadarTrip+Internal.h"
+#import "../RadarSDK/RadarEnumMapping.h"
+#import "../RadarSDK/RadarUser+Internal.h"
 #import "../RadarSDK/Include/RadarTripLeg.h"
 #import <os/log.h>
 
@@ -2131,20 +2133,27 @@ static NSString *const kPublishableKey = @"prj_test_pk_0000000000000000000000000
     b.batchInterval = 0;
     b.batchSize = 5;
     XCTAssertNotEqualObjects(a, b);
+
+    b.batchSize = 0;
+    b.batchAdaptive = YES;
+    XCTAssertNotEqualObjects(a, b);
 }
 
 - (void)test_RadarTrackingOptions_batchingSerialization {
     RadarTrackingOptions *options = RadarTrackingOptions.presetEfficient;
     options.batchInterval = 30;
     options.batchSize = 5;
+    options.batchAdaptive = YES;
     
     NSDictionary *dict = [options dictionaryValue];
     XCTAssertEqualObjects(dict[@"batchInterval"], @30);
     XCTAssertEqualObjects(dict[@"batchSize"], @5);
+    XCTAssertEqualObjects(dict[@"batchAdaptive"], @YES);
     
     RadarTrackingOptions *roundTripped = [RadarTrackingOptions trackingOptionsFromDictionary:dict];
     XCTAssertEqual(roundTripped.batchInterval, 30);
     XCTAssertEqual(roundTripped.batchSize, 5);
+    XCTAssertTrue(roundTripped.batchAdaptive);
     XCTAssertEqualObjects(options, roundTripped);
 }
 
@@ -2155,6 +2164,9 @@ static NSString *const kPublishableKey = @"prj_test_pk_0000000000000000000000000
     XCTAssertEqual(RadarTrackingOptions.presetResponsive.batchSize, 0);
     XCTAssertEqual(RadarTrackingOptions.presetEfficient.batchInterval, 0);
     XCTAssertEqual(RadarTrackingOptions.presetEfficient.batchSize, 0);
+    XCTAssertFalse(RadarTrackingOptions.presetContinuous.batchAdaptive);
+    XCTAssertFalse(RadarTrackingOptions.presetResponsive.batchAdaptive);
+    XCTAssertFalse(RadarTrackingOptions.presetEfficient.batchAdaptive);
 }
 
 - (void)test_RadarReplayBuffer_addToBatchIncrementsCount {
@@ -2277,4 +2289,35 @@ static NSString *const kPublishableKey = @"prj_test_pk_0000000000000000000000000
     }];
     XCTAssertTrue(explicitTrue.skipForegroundCheck);
 }
+
+- (void)test_RadarEnumMapping_firstStringWins {
+    RadarEnumMappingEntry entries[] = {
+        {1, @"one"},
+        {1, @"uno"},
+        {2, @"two"},
+    };
+    RadarEnumMapping *mapping = RadarEnumMappingMake(entries);
+
+    XCTAssertEqualObjects([mapping stringForValue:1], @"one");
+    XCTAssertEqual([mapping valueForString:@"uno" defaultValue:0], 1);
+    XCTAssertEqual([mapping valueForString:@"three" defaultValue:0], 0);
+    XCTAssertEqual([mapping valueForString:nil defaultValue:0], 0);
+    XCTAssertNil([mapping stringForValue:3]);
+}
+
+- (void)test_RadarEnumMapping_modelDefaults {
+    XCTAssertEqualObjects([RadarEvent stringForType:RadarEventTypeConversion], @"custom");
+    XCTAssertEqualObjects([RadarEvent stringForType:RadarEventTypeUnknown], @"unknown");
+    XCTAssertEqualObjects([Radar stringForTripStatus:RadarTripStatusUnknown], @"unknown");
+    XCTAssertEqualObjects([Radar stringForMode:RadarRouteModeCar | RadarRouteModeTruck], @"unknown");
+    XCTAssertEqualObjects([Radar stringForLocationSource:RadarLocationSourceBeaconEnter], @"BEACON_ENTER");
+    XCTAssertEqual([[RadarUser sourceMapping] valueForString:@"INDOORS" defaultValue:RadarLocationSourceUnknown], RadarLocationSourceIndoors);
+
+    XCTAssertEqual([RadarTrackingOptions desiredAccuracyForString:@"medium"], RadarTrackingOptionsDesiredAccuracyMedium);
+    XCTAssertEqual([RadarTrackingOptions desiredAccuracyForString:@"bogus"], RadarTrackingOptionsDesiredAccuracyMedium);
+    XCTAssertEqual([RadarTrackingOptions replayForString:@"bogus"], RadarTrackingOptionsReplayNone);
+    XCTAssertEqual([RadarTrackingOptions syncLocationsForString:@"bogus"], RadarTrackingOptionsSyncAll);
+    XCTAssertEqual([RadarTrackingOptions typeForString:@"bogus"], RadarTrackingOptionsTypeDefault);
+    XCTAssertEqualObjects([RadarTrackingOptions stringForSyncLocations:RadarTrackingOptionsSyncEvents], @"events");
+}
 @end
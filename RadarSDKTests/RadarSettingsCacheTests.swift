@@ -0,0 +1,190 @@
+//
+//  RadarSettingsCacheTests.swift
+//  RadarSDKTests
+//
+//  Copyright © 2026 Radar Labs, Inc. All rights reserved.
+//
+
+import CoreLocation
+import Foundation
+import Testing
+import XCTest
+
+@testable import RadarSDK
+
+extension RadarSerializedTests {
+    @Suite(.serialized)
+    actor RadarSettingsCacheTests {
+
+        @Test("settings decode once and are re-decoded after a write")
+        func decodesOnceUntilWritten() {
+            RadarLocationManagerSwiftTestHelpers.clearState()
+            defer { RadarLocationManagerSwiftTestHelpers.clearState() }
+            RadarSettings.sdkConfiguration = RadarSdkConfiguration(dict: ["useSyncRegion": true])
+
+            let first = RadarSettings.sdkConfiguration
+            let second = RadarSettings.sdkConfiguration
+            #expect(first === second)
+            #expect(second?.useSyncRegion == true)
+
+            RadarSettings.sdkConfiguration = RadarSdkConfiguration(dict: ["useSyncRegion": false])
+            let third = RadarSettings.sdkConfiguration
+            #expect(third !== first)
+            #expect(third?.useSyncRegion == false)
+        }
+
+        @Test("nil settings are cached and invalidated like any other value")
+        func cachesMissingValues() {
+            RadarLocationManagerSwiftTestHelpers.clearState()
+            defer { RadarLocationManagerSwiftTestHelpers.clearState() }
+
+            #expect(RadarSettings.remoteTrackingOptions == nil)
+            #expect(RadarSettings.effectiveTrackingOptions == RadarSettings.trackingOptions)
+
+            RadarSettings.remoteTrackingOptions = .presetContinuous
+            #expect(RadarSettings.remoteTrackingOptions == .presetContinuous)
+            #expect(RadarSettings.effectiveTrackingOptions == RadarSettings.remoteTrackingOptions)
+        }
+
+        @Test("switching the backing UserDefaults drops cached settings")
+        func userDefaultsSwapInvalidates() {
+            RadarLocationManagerSwiftTestHelpers.clearState()
+            let original = RadarUserDefaults.userDefaults
+            let suite = UserDefaults(suiteName: "test.settings.cache")!
+            suite.set(RadarTrackingOptions.presetContinuous.dictionaryValue(), forKey: RadarUserDefaults.Key.trackingOptions.rawValue)
+            defer {
+                RadarUserDefaults.userDefaults = original
+                suite.removePersistentDomain(forName: "test.settings.cache")
+                RadarLocationManagerSwiftTestHelpers.clearState()
+            }
+
+            #expect(RadarSettings.trackingOptions == .presetEfficient)
+            RadarUserDefaults.userDefaults = suite
+            #expect(RadarSettings.trackingOptions == .presetContinuous)
+        }
+
+        @Test("writes that bypass RadarUserDefaults drop cached settings")
+        func directWriteInvalidates() {
+            RadarLocationManagerSwiftTestHelpers.clearState()
+            defer { RadarLocationManagerSwiftTestHelpers.clearState() }
+            RadarSettings.trackingOptions = .presetResponsive
+            #expect(RadarSettings.trackingOptions == .presetResponsive)
+
+            RadarUserDefaults.userDefaults.set(
+                RadarTrackingOptions.presetContinuous.dictionaryValue(), forKey: RadarUserDefaults.Key.trackingOptions.rawValue)
+            #expect(RadarSettings.trackingOptions == .presetContinuous)
+
+            RadarUserDefaults.userDefaults.removeObject(forKey: RadarUserDefaults.Key.trackingOptions.rawValue)
+            #expect(RadarSettings.trackingOptions == .presetEfficient)
+        }
+
+        @Test("cloning into the backing UserDefaults drops cached settings")
+        func cloneInvalidates() {
+            RadarLocationManagerSwiftTestHelpers.clearState()
+            let suite = UserDefaults(suiteName: "test.settings.cache.clone")!
+            suite.set(RadarTrackingOptions.presetContinuous.dictionaryValue(), forKey: RadarUserDefaults.Key.trackingOptions.rawValue)
+            defer {
+                suite.removePersistentDomain(forName: "test.settings.cache.clone")
+                RadarLocationManagerSwiftTestHelpers.clearState()
+            }
+
+            #expect(RadarSettings.trackingOptions == .presetEfficient)
+            RadarUserDefaults.clone(from: suite, to: RadarUserDefaults.userDefaults)
+            #expect(RadarSettings.trackingOptions == .presetContinuous)
+        }
+
+        @Test("public getters return copies callers can mutate")
+        func publicGettersReturnCopies() {
+            RadarLocationManagerSwiftTestHelpers.clearState()
+            defer { RadarLocationManagerSwiftTestHelpers.clearState() }
+            RadarSettings.trackingOptions = .presetResponsive
+
+            let options = Radar.getTrackingOptions()
+            #expect(options !== RadarSettings.trackingOptions)
+            options.desiredSyncInterval = 1
+
+            #expect(RadarSettings.trackingOptions == .presetResponsive)
+        }
+
+        @Test("object-typed getters hand out copies of the cached value")
+        func objectGettersReturnCopies() {
+            RadarLocationManagerSwiftTestHelpers.clearState()
+            defer { RadarLocationManagerSwiftTestHelpers.clearState() }
+            RadarSettings.trackingOptions = .presetResponsive
+            RadarSettings.tripOptions = RadarTripOptions(externalId: "trip", destinationGeofenceTag: nil, destinationGeofenceExternalId: nil)
+
+            let options = RadarSettings.trackingOptions!
+            options.type = .onTrip
+            options.desiredSyncInterval = 1
+            let tripOptions = RadarSettings.tripOptions!
+            tripOptions.externalId = "other"
+
+            RadarSettingsCache.shared.resetStats()
+            #expect(RadarSettings.trackingOptions !== options)
+            #expect(RadarSettings.trackingOptions?.type == .default)
+            #expect(RadarSettings.trackingOptions == .presetResponsive)
+            #expect(RadarSettings.tripOptions?.externalId == "trip")
+            #expect(RadarSettingsCache.shared.stats.decodes == 0)
+        }
+
+        @Test("handleLocation decodes settings only while uncached")
+        func handleLocationDecodes() {
+            RadarSettingsCacheBenchmarks.withHandleLocationSetup { handleLocation in
+                RadarSettingsCache.shared.isEnabled = false
+                RadarSettingsCache.shared.resetStats()
+                handleLocation()
+                let uncached = RadarSettingsCache.shared.stats
+                #expect(uncached.reads > 0)
+                #expect(uncached.decodes == uncached.reads)
+
+                RadarSettingsCache.shared.isEnabled = true
+                handleLocation()
+                RadarSettingsCache.shared.resetStats()
+                handleLocation()
+                #expect(RadarSettingsCache.shared.stats.decodes < uncached.decodes)
+            }
+        }
+    }
+}
+
+/// Cost of the settings reads made while handling a location, with the cache off vs on.
+final class RadarSettingsCacheBenchmarks: XCTestCase {
+
+    /// Runs `body` with a foreground-tracking setup whose handleLocation doesn't touch
+    /// Core Location, then restores the manager, the cache and the stored settings.
+    nonisolated static func withHandleLocationSetup(_ body: (_ handleLocation: () -> Void) -> Void) {
+        RadarLocationManagerSwiftTestHelpers.clearState()
+        let manager = RadarLocationManager.sharedInstance()
+        let originalLocationManager = manager.locationManager
+        manager.locationManager = TrackingCLLocationManager()
+        defer {
+            manager.locationManager = originalLocationManager
+            RadarSettingsCache.shared.isEnabled = true
+            RadarLocationManagerSwiftTestHelpers.clearState()
+        }
+        RadarSettings.sdkConfiguration = RadarSdkConfiguration(dict: ["logLevel": "warning"])
+        RadarSettings.trackingOptions = .presetResponsive
+        let location = CLLocation(latitude: 40.78382, longitude: -73.97536)
+
+        body { manager.handleLocation(location, source: .foregroundLocation) }
+    }
+
+    private func measureHandleLocation(cacheEnabled: Bool) {
+        Self.withHandleLocationSetup { handleLocation in
+            RadarSettingsCache.shared.isEnabled = cacheEnabled
+            measure(metrics: [XCTClockMetric()]) {
+                for _ in 0..<200 {
+                    handleLocation()
+                }
+            }
+        }
+    }
+
+    func testHandleLocationUncached() {
+        measureHandleLocation(cacheEnabled: false)
+    }
+
+    func testHandleLocationCached() {
+        measureHandleLocation(cacheEnabled: true)
+    }
+}
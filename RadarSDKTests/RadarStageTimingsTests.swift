@@ -0,0 +1,76 @@
+//
+//  RadarStageTimingsTests.swift
+//  RadarSDKTests
+//
+//  Copyright © 2026 Radar Labs, Inc. All rights reserved.
+//
+
+import Foundation
+import Testing
+
+@testable import RadarSDK
+
+@Suite
+struct RadarStageTimingsTests {
+
+    @Test func overlappingStagesAreTimedSeparately() async throws {
+        let timings = RadarStageTimings()
+        timings.startStage("config")
+        timings.startStage("location")
+        try await Task.sleep(nanoseconds: 20_000_000)
+        timings.endStage("config")
+        try await Task.sleep(nanoseconds: 20_000_000)
+        timings.endStage("location")
+        timings.startStage("fraud")
+        timings.finish()
+
+        #expect(timings.durationOfStage("config") >= 0.02)
+        #expect(timings.durationOfStage("location") > timings.durationOfStage("config"))
+        #expect(timings.offsetOfStage("fraud") >= timings.durationOfStage("location"))
+        #expect(timings.durationOfStage("fraud") == -1)
+        #expect(timings.durationOfStage("track") == -1)
+        #expect(timings.offsetOfStage("track") == -1)
+        // overlapping stages, so the total is less than their sum
+        #expect(timings.total < timings.durationOfStage("config") + timings.durationOfStage("location"))
+    }
+
+    @Test func logDescriptionListsStagesInStartOrder() {
+        let timings = RadarStageTimings()
+        timings.startStage("location")
+        timings.startStage("config")
+        timings.endStage("config")
+        timings.endStage("location")
+        timings.startStage("track")
+        timings.finish()
+
+        let description = timings.logDescription()
+        let parts = description.components(separatedBy: "; ")
+        #expect(parts.count == 4)
+        #expect(parts[0].hasPrefix("location = "))
+        #expect(parts[1].hasPrefix("config = "))
+        #expect(parts[2].hasPrefix("track = unfinished"))
+        #expect(parts[3].hasPrefix("total = "))
+    }
+
+    @Test func totalStopsAtFinish() async throws {
+        let timings = RadarStageTimings()
+        timings.finish()
+        let total = timings.total
+        try await Task.sleep(nanoseconds: 10_000_000)
+        #expect(timings.total == total)
+    }
+
+    @Test func stagesCanBeTimedFromAnyThread() {
+        let timings = RadarStageTimings()
+        DispatchQueue.concurrentPerform(iterations: 100) { index in
+            timings.startStage("stage \(index)")
+            timings.endStage("stage \(index)")
+        }
+        timings.finish()
+
+        for index in 0..<100 {
+            #expect(timings.durationOfStage("stage \(index)") >= 0)
+        }
+        #expect(timings.logDescription().components(separatedBy: "; ").count == 101)
+    }
+}
@@ -217,6 +217,80 @@ extension RadarSerializedTests {
             #expect(geofences.count == 0)
         }
 
+        // MARK: - evaluateGeofences
+
+        @Test("evaluateGeofences returns entries, exits and dwells from one pass")
+        func evaluateGeofences_entriesExitsAndDwells() {
+            let entering = makeCircleGeofence(id: "entering", lat: testLat, lng: testLng, radius: 100)
+            let dwelling = makeCircleGeofence(id: "dwelling", lat: testLat, lng: testLng, radius: 100, dwellThreshold: 2)
+            let exiting = makeCircleGeofence(id: "exiting", lat: testLatFar, lng: testLng, radius: 50)
+            var state = RadarSyncState()
+            state.syncedGeofences = [entering, dwelling, exiting]
+            state.lastSyncedGeofenceIds = ["dwelling", "exiting"]
+            state.geofenceEntryTimestamps = ["dwelling": Date(timeIntervalSinceNow: -180).timeIntervalSince1970]
+            setState(state)
+
+            let location = CLLocation(latitude: testLat, longitude: testLng)
+            let evaluation = RadarSyncManager.evaluateGeofences(for: location, against: Set(state.lastSyncedGeofenceIds))
+
+            #expect(Set(evaluation.insideEntry.map { $0.id }) == ["entering", "dwelling"])
+            #expect(Set(evaluation.insideExit.map { $0.id }) == ["entering", "dwelling"])
+            #expect(evaluation.entered.map { $0.id } == ["entering"])
+            #expect(evaluation.exited.map { $0.id } == ["exiting"])
+            #expect(evaluation.dwells.map { $0.id } == ["dwelling"])
+        }
+
+        @Test("containment is reused across tracking state writes for the same fix")
+        func geofenceContainment_memoizedForFix() {
+            let geofence = makeCircleGeofence(id: "geofence1", lat: testLat, lng: testLng, radius: 100)
+            var state = RadarSyncState()
+            state.syncedGeofences = [geofence]
+            setState(state)
+
+            let location = CLLocation(latitude: testLat, longitude: testLng)
+            let indexBefore = RadarSyncManager.geofenceIndex()
+            let before = RadarSyncManager.geofenceContainment(for: location)
+            let key = RadarSyncManager.memoizedContainmentKey
+            #expect(key?.timestamp == location.timestamp)
+
+            RadarSyncManager.recordGeofenceEntryTimestamps(["geofence1"])
+
+            // the write kept the index, so its version and the memo for this fix survive it
+            let indexAfter = RadarSyncManager.geofenceIndex()
+            #expect(RadarSyncManager.memoizedContainmentKey == key)
+            let after = RadarSyncManager.geofenceContainment(for: location)
+            #expect(RadarSyncManager.memoizedContainmentKey == key)
+            #expect(indexBefore?.isBuilt(from: indexAfter?.geofences ?? []) == true)
+            #expect(before.insideEntry.map { $0.id } == after.insideEntry.map { $0.id })
+
+            // a new fix at the same coordinate is evaluated again
+            let nextFix = CLLocation(
+                coordinate: location.coordinate, altitude: 0, horizontalAccuracy: location.horizontalAccuracy, verticalAccuracy: -1,
+                timestamp: location.timestamp.addingTimeInterval(1)
+            )
+            _ = RadarSyncManager.geofenceContainment(for: nextFix)
+            #expect(RadarSyncManager.memoizedContainmentKey?.timestamp == nextFix.timestamp)
+            #expect(RadarSyncManager.memoizedContainmentKey?.indexVersion == key?.indexVersion)
+        }
+
+        @Test("containment is recomputed when buffering config changes")
+        func geofenceContainment_recomputedForConfigChange() {
+            let geofence = makeCircleGeofence(id: "geofence1", lat: testLat, lng: testLng, radius: 100)
+            var state = RadarSyncState()
+            state.syncedGeofences = [geofence]
+            setState(state)
+
+            let location = CLLocation(
+                coordinate: CLLocationCoordinate2D(latitude: testLat + 0.001, longitude: testLng),
+                altitude: 0, horizontalAccuracy: 20, verticalAccuracy: 10, timestamp: Date()
+            )
+            RadarSettings.sdkConfiguration = RadarSdkConfiguration(dict: ["bufferGeofenceEntries": true])
+            #expect(RadarSyncManager.geofenceContainment(for: location).insideEntry.count == 1)
+
+            RadarSettings.sdkConfiguration = RadarSdkConfiguration(dict: ["bufferGeofenceEntries": false])
+            #expect(RadarSyncManager.geofenceContainment(for: location).insideEntry.isEmpty)
+        }
+
         // MARK: - geofenceStateChanged
 
         @Test("geofenceStateChanged detects entry")
@@ -872,5 +946,130 @@ extension RadarSerializedTests {
             let location = CLLocation(latitude: testLat, longitude: testLng)
             #expect(!RadarSyncManager.isNearSyncedRegionBoundary(location: location))
         }
+
+        // MARK: - Delta sync
+
+        static let syncRegionURL = "\(RadarSettings.host)/v1/sync/region"
+
+        func geofenceJSON(id: String, lat: Double, lng: Double, radius: Double) -> [String: Any] {
+            [
+                "_id": id, "type": "circle", "geometryRadius": radius,
+                "geometryCenter": ["type": "Point", "coordinates": [lng, lat]] as [String: Any],
+            ]
+        }
+
+        func syncBody(of request: URLRequest) -> [String: Any]? {
+            guard request.url?.absoluteString == Self.syncRegionURL, let body = request.httpBody else { return nil }
+            return try? JSONSerialization.jsonObject(with: body) as? [String: Any]
+        }
+
+        /// Stub sync/region backend that serves v1 in full, then a v2 delta, then 304s.
+        func makeSyncRegionServer() throws -> MockURLSession {
+            let session = MockURLSession()
+            let region: [String: Any] = ["latitude": testLat, "longitude": testLng, "radius": 10_000]
+
+            let fullBody: [String: Any] = [
+                "region": region,
+                "geofences": [
+                    geofenceJSON(id: "g1", lat: testLat, lng: testLng, radius: 100),
+                    geofenceJSON(id: "g2", lat: testLat, lng: testLng, radius: 100),
+                    geofenceJSON(id: "g3", lat: testLatFar, lng: testLng, radius: 100),
+                ],
+                "places": [Any](),
+            ]
+            session.on(
+                { request in
+                    guard let body = syncBody(of: request) else { return false }
+                    return body["syncVersion"] == nil
+                }, try JSONSerialization.data(withJSONObject: fullBody), headerFields: ["ETag": "W/\"v1\""])
+
+            let geofenceChanges: [String: Any] = [
+                "upserted": [
+                    geofenceJSON(id: "g2", lat: testLat, lng: testLng, radius: 300),
+                    geofenceJSON(id: "g4", lat: testLatNearby, lng: testLng, radius: 50),
+                ],
+                "removed": ["g1"],
+            ]
+            let deltaBody: [String: Any] = ["region": region, "version": "v2", "delta": ["geofences": geofenceChanges]]
+            session.on(
+                { request in
+                    syncBody(of: request)?["syncVersion"] as? String == "v1" && request.value(forHTTPHeaderField: "If-None-Match") == "\"v1\""
+                }, try JSONSerialization.data(withJSONObject: deltaBody))
+
+            session.on({ syncBody(of: $0)?["syncVersion"] as? String == "v2" }, Data(), statusCode: 304)
+            return session
+        }
+
+        @Test("sync region applies full, delta and not-modified responses")
+        func syncRegionDelta() async throws {
+            let client = RadarAPIClient(apiHelper: RadarAPIHelper(session: try makeSyncRegionServer()))
+
+            try await RadarSyncManager.syncRegion(latitude: testLat, longitude: testLng, apiClient: client)
+            var state = try #require(RadarSyncManager.syncStore.read())
+            #expect(state.syncedRegionVersion == "v1")
+            #expect(state.syncedGeofences?.map(\.id) == ["g1", "g2", "g3"])
+            #expect(state.syncedPlaces?.isEmpty == true)
+            #expect(state.syncedBeacons == nil)
+
+            try await RadarSyncManager.syncRegion(latitude: testLat, longitude: testLng, apiClient: client)
+            state = try #require(RadarSyncManager.syncStore.read())
+            #expect(state.syncedRegionVersion == "v2")
+            #expect(state.syncedGeofences?.map(\.id) == ["g2", "g3", "g4"])
+            #expect(state.syncedGeofences?.first?.geometry.radius == 300)
+            #expect(state.syncedPlaces?.isEmpty == true)
+
+            let writes = RadarSyncManager.syncStore.writeCounts
+            try await RadarSyncManager.syncRegion(latitude: testLat, longitude: testLng, apiClient: client)
+            #expect(RadarSyncManager.syncStore.writeCounts.region == writes.region)
+            #expect(RadarSyncManager.syncStore.writeCounts.tracking == writes.tracking)
+            #expect(RadarSyncManager.syncStore.read()?.syncedGeofences?.map(\.id) == ["g2", "g3", "g4"])
+        }
+
+        @Test("empty delta leaves the stored collections untouched")
+        func emptyDeltaKeepsStorage() {
+            var state: RadarSyncState? = RadarSyncState()
+            state?.syncedGeofences = [makeCircleGeofence(id: "g1", lat: testLat, lng: testLng, radius: 100)]
+            state?.syncedRegionVersion = "v1"
+            let geofences = state?.syncedGeofences ?? []
+
+            var delta = SyncRegionDelta()
+            delta.places.removed = ["p1"]
+            let response = SyncRegionResponse(
+                geofences: nil, places: nil, beacons: nil,
+                regionCenter: RadarCoordinateSwift(latitude: testLat, longitude: testLng), regionRadius: 10_000,
+                version: "v2", delta: delta
+            )
+            RadarSyncManager.apply(response, to: &state)
+
+            #expect(state?.syncedGeofences?.sharesStorage(with: geofences) == true)
+            #expect(state?.syncedPlaces?.isEmpty == true)
+            #expect(state?.syncedRegionVersion == "v2")
+        }
+
+        @Test("a delta without a region keeps the stored center and radius")
+        func deltaKeepsRegion() {
+            var state: RadarSyncState? = RadarSyncState()
+            state?.syncedRegionCenter = RadarCoordinateSwift(latitude: testLat, longitude: testLng)
+            state?.syncedRegionRadius = 10_000
+            state?.syncedRegionVersion = "v1"
+
+            var delta = SyncRegionDelta()
+            delta.geofences.removed = ["g1"]
+            let response = SyncRegionResponse(geofences: nil, places: nil, beacons: nil, regionCenter: nil, regionRadius: nil, version: "v2", delta: delta)
+            RadarSyncManager.apply(response, to: &state)
+
+            #expect(state?.syncedRegionCenter?.latitude == testLat)
+            #expect(state?.syncedRegionRadius == 10_000)
+            #expect(state?.syncedRegionVersion == "v2")
+        }
+
+        @Test("ETag header values are unquoted")
+        func entityTagParsing() {
+            #expect(RadarAPIClient.entityTag("\"abc\"") == "abc")
+            #expect(RadarAPIClient.entityTag("W/\"abc\"") == "abc")
+            #expect(RadarAPIClient.entityTag("abc") == "abc")
+            #expect(RadarAPIClient.entityTag("") == nil)
+            #expect(RadarAPIClient.entityTag(nil) == nil)
+        }
     }
 }
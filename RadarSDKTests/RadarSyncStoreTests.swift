@@ -0,0 +1,221 @@
+//
+//  RadarSyncStoreTests.swift
+//  RadarSDK
+//
+//  Copyright © 2026 Radar Labs, Inc. All rights reserved.
+//
+
+import Foundation
+import Testing
+import XCTest
+
+@testable import RadarSDK
+
+@Suite
+struct RadarSyncStoreTests {
+
+    // MARK: - Helpers
+
+    /// Uniquely named store files so tests running in parallel don't collide.
+    func makeStoreName() -> String {
+        "radar_sync_test_\(UUID().uuidString)"
+    }
+
+    func makeState(geofenceCount: Int, seed: UInt64 = 42) -> RadarSyncState {
+        var generator = SplitMix64(seed: seed)
+        let geofences = (0..<geofenceCount).map { i -> RadarGeofenceSwift in
+            let lat = 40.78382 + Double.random(in: -0.1...0.1, using: &generator)
+            let lng = -73.97536 + Double.random(in: -0.1...0.1, using: &generator)
+            let center = RadarCoordinateSwift(latitude: lat, longitude: lng)
+            let geometry: RadarGeofenceGeometrySwift
+            if i % 2 == 0 {
+                geometry = .circle(center: center, radius: 100)
+            } else {
+                let coords = (0..<24).map { v -> RadarCoordinateSwift in
+                    let angle = Double(v) / 24 * 2 * .pi
+                    return RadarCoordinateSwift(latitude: lat + 0.001 * sin(angle), longitude: lng + 0.001 * cos(angle))
+                }
+                geometry = .polygon(coordinates: coords, center: center, radius: 150)
+            }
+            return RadarGeofenceSwift(
+                id: "geofence\(i)", description: "Geofence \(i) ☕️", tag: i % 3 == 0 ? "store" : nil, externalId: "ext\(i)",
+                geometry: geometry, dwellThreshold: i % 4 == 0 ? 5 : nil, geofenceStopDetection: i % 5 == 0 ? false : nil,
+                metadata: ["name": .string("n\(i)"), "rank": .int(i), "score": .double(0.5), "open": .bool(true)],
+                operatingHours: i % 2 == 0 ? ["Mon": [["09:00", "17:00"]], "Sat": []] : nil
+            )
+        }
+        let places = [
+            RadarPlaceSwift(
+                id: "place1", name: "Cafe", categories: ["food-beverage", "coffee-shop"],
+                location: RadarCoordinateSwift(latitude: 40.7, longitude: -73.9), group: "cafes", geometryRadius: 40),
+            RadarPlaceSwift(id: "place2", name: "", categories: [], location: RadarCoordinateSwift(latitude: 40.71, longitude: -73.91), group: nil),
+        ]
+        let beacons = [
+            RadarBeaconSwift(
+                id: "beacon1", description: "Entrance", tag: nil, externalId: "b1",
+                uuid: "B9407F30-F5F8-466E-AFF9-25556B57FE6D", major: "1", minor: "2",
+                geometry: RadarCoordinateSwift(latitude: 40.7, longitude: -73.9))
+        ]
+
+        var state = RadarSyncState()
+        state.syncedRegionCenter = RadarCoordinateSwift(latitude: 40.78382, longitude: -73.97536)
+        state.syncedRegionRadius = 10_000
+        state.syncedRegionVersion = "v42"
+        state.syncedGeofences = geofences
+        state.syncedPlaces = places
+        state.syncedBeacons = beacons
+        state.lastSyncedGeofenceIds = ["geofence0"]
+        state.geofenceEntryTimestamps = ["geofence0": 1_700_000_000]
+        state.dwellEventsFired = ["geofence0"]
+        return state
+    }
+
+    func expectSameRegion(_ lhs: RadarSyncRegion, _ rhs: RadarSyncRegion) {
+        #expect(lhs.center == rhs.center)
+        #expect(lhs.radius == rhs.radius)
+        #expect(lhs.version == rhs.version)
+        #expect(lhs.geofences == rhs.geofences)
+        for (a, b) in zip(lhs.geofences ?? [], rhs.geofences ?? []) {
+            if case .polygon(let aCoords, _, _) = a.geometry, case .polygon(let bCoords, _, _) = b.geometry {
+                #expect(aCoords == bCoords)
+            }
+        }
+        #expect(lhs.places?.map(\.id) == rhs.places?.map(\.id))
+        #expect(lhs.places?.map(\.categories) == rhs.places?.map(\.categories))
+        #expect(lhs.places?.map(\.group) == rhs.places?.map(\.group))
+        #expect(lhs.places?.map(\.geometryRadius) == rhs.places?.map(\.geometryRadius))
+        #expect(lhs.beacons?.map(\.uuid) == rhs.beacons?.map(\.uuid))
+        #expect(lhs.beacons?.map(\.geometry) == rhs.beacons?.map(\.geometry))
+    }
+
+    // MARK: - Archive
+
+    @Test("region archive round-trips every field")
+    func archiveRoundTrip() throws {
+        let region = makeState(geofenceCount: 20).region
+        let decoded = try RadarSyncRegionArchive.decode(RadarSyncRegionArchive.encode(region))
+
+        expectSameRegion(decoded, region)
+        #expect(decoded.geofences?[0].metadata == region.geofences?[0].metadata)
+        #expect(decoded.geofences?[0].operatingHours == region.geofences?[0].operatingHours)
+        #expect(decoded.geofences?[1].compiledPolygon == region.geofences?[1].compiledPolygon)
+    }
+
+    @Test("region archive keeps missing sections distinct from empty ones")
+    func archiveOptionalSections() throws {
+        let region = RadarSyncRegion(center: nil, radius: nil, version: nil, geofences: [], places: nil, beacons: nil)
+        let decoded = try RadarSyncRegionArchive.decode(RadarSyncRegionArchive.encode(region))
+
+        #expect(decoded.center == nil)
+        #expect(decoded.geofences?.isEmpty == true)
+        #expect(decoded.places == nil)
+        #expect(decoded.beacons == nil)
+    }
+
+    @Test("truncated or foreign archives are rejected")
+    func archiveRejectsBadData() {
+        let data = RadarSyncRegionArchive.encode(makeState(geofenceCount: 4).region)
+
+        #expect(throws: (any Error).self) { try RadarSyncRegionArchive.decode(data.prefix(data.count - 3)) }
+        #expect(throws: (any Error).self) { try RadarSyncRegionArchive.decode(Data("{\"syncedGeofences\":[]}".utf8)) }
+    }
+
+    // MARK: - Store
+
+    @Test("stored state reloads in a fresh store")
+    func reloadsFromDisk() {
+        let name = makeStoreName()
+        let store = RadarSyncStore(name: name)
+        defer { store.clear() }
+        let state = makeState(geofenceCount: 10)
+        store.write(state)
+        store.flush()
+
+        let read = RadarSyncStore(name: name).read()
+        #expect(read != nil)
+        expectSameRegion(read!.region, state.region)
+        #expect(read?.geofenceEntryTimestamps == state.geofenceEntryTimestamps)
+        #expect(read?.dwellEventsFired == state.dwellEventsFired)
+        #expect(read?.lastSyncedGeofenceIds == state.lastSyncedGeofenceIds)
+    }
+
+    @Test("tracking-only changes don't rewrite the region file")
+    func trackingChangesSkipRegion() {
+        let store = RadarSyncStore(name: makeStoreName())
+        defer { store.clear() }
+        store.write(makeState(geofenceCount: 200))
+        #expect(store.writeCounts.region == 1)
+        #expect(store.writeCounts.tracking == 1)
+
+        for i in 0..<10 {
+            store.modify { state in
+                state?.geofenceEntryTimestamps["geofence\(i)"] = Double(i)
+                state?.dwellEventsFired.append("geofence\(i)")
+            }
+        }
+        #expect(store.writeCounts.region == 1)
+        #expect(store.writeCounts.tracking == 11)
+        // the tracking writes above land within one coalescing window
+        #expect(store.trackingWriteStats.requested == 11)
+        #expect(store.trackingWriteStats.performed < 11)
+
+        store.modify { state in
+            state?.syncedGeofences = Array(state?.syncedGeofences?.prefix(10) ?? [])
+        }
+        #expect(store.writeCounts.region == 2)
+        #expect(store.writeCounts.tracking == 12)
+    }
+
+    @Test("legacy JSON state is migrated on first read")
+    func migratesLegacyState() throws {
+        let name = makeStoreName()
+        let store = RadarSyncStore(name: name)
+        defer { store.clear() }
+        let state = makeState(geofenceCount: 6)
+        try JSONEncoder().encode(state).write(to: store.legacyURL)
+
+        let read = store.read()
+        #expect(read != nil)
+        expectSameRegion(read!.region, state.region)
+        #expect(read?.geofenceEntryTimestamps == state.geofenceEntryTimestamps)
+        #expect(!FileManager.default.fileExists(atPath: store.legacyURL.path))
+        #expect(FileManager.default.fileExists(atPath: store.regionURL.path))
+
+        store.flush()
+        let migrated = RadarSyncStore(name: name).read()
+        #expect(migrated?.geofenceEntryTimestamps == state.geofenceEntryTimestamps)
+        #expect(migrated?.syncedGeofences?.count == state.syncedGeofences?.count)
+    }
+
+    @Test("clearing removes the state and its files")
+    func clearRemovesFiles() {
+        let store = RadarSyncStore(name: makeStoreName())
+        store.write(makeState(geofenceCount: 2))
+        store.clear()
+
+        #expect(store.read() == nil)
+        #expect(!FileManager.default.fileExists(atPath: store.regionURL.path))
+        store.flush()
+        #expect(!FileManager.default.fileExists(atPath: store.trackingURL.path))
+        #expect(!FileManager.default.fileExists(atPath: store.trackingURL.path + ".journal"))
+    }
+}
+
+/// Cold decode of a 1,000-geofence sync state, JSON vs the binary region archive.
+final class RadarSyncStoreBenchmarks: XCTestCase {
+    private let state = RadarSyncStoreTests().makeState(geofenceCount: 1_000)
+
+    func testJSONDecode() throws {
+        let json = try JSONEncoder().encode(state)
+        measure(metrics: [XCTClockMetric()]) {
+            XCTAssertNotNil(try? JSONDecoder().decode(RadarSyncState.self, from: json))
+        }
+    }
+
+    func testBinaryDecode() {
+        let binary = RadarSyncRegionArchive.encode(state.region)
+        measure(metrics: [XCTClockMetric()]) {
+            XCTAssertEqual((try? RadarSyncRegionArchive.decode(binary))?.geofences?.count, 1_000)
+        }
+    }
+}
@@ -13,4 +13,6 @@
 @interface RadarSyncTestHelper : NSObject
 + (void)setStopped:(BOOL)stopped;
 + (void)setRadarUser:(RadarUser *)user;
++ (void)setRadarUserObject:(NSDictionary *)userObject;
++ (RadarUser *)radarUser;
 @end
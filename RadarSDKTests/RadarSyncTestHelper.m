@@ -12,4 +12,6 @@
 @implementation RadarSyncTestHelper
 + (void)setStopped:(BOOL)stopped { [RadarState setStopped:stopped]; }
 + (void)setRadarUser:(RadarUser *)user { [RadarState setRadarUser:user]; }
++ (void)setRadarUserObject:(NSDictionary *)userObject { [RadarState setRadarUserObject:userObject]; }
++ (RadarUser *)radarUser { return [RadarState radarUser]; }
 @end
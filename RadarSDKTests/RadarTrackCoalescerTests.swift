@@ -0,0 +1,80 @@
+//
+//  RadarTrackCoalescerTests.swift
+//  RadarSDKTests
+//
+//  Copyright © 2026 Radar Labs, Inc. All rights reserved.
+//
+
+import CoreLocation
+import Foundation
+import Testing
+
+@testable import RadarSDK
+
+@Suite
+struct RadarTrackCoalescerTests {
+
+    let location = CLLocation(latitude: 40.78382, longitude: -73.97536)
+
+    func key(_ location: CLLocation, source: RadarLocationSource = .foregroundLocation, replayed: Bool = false) -> String? {
+        RadarTrackCoalescer.key(for: location, source: source, stopped: false, foreground: true, replayed: replayed, beacons: nil, indoorLocation: nil)
+    }
+
+    @Test func equivalentTracksShareOneRequest() {
+        let coalescer = RadarTrackCoalescer(window: 1)
+        var requests = [RadarTrackAPICompletionHandler]()
+        var statuses = [RadarStatus]()
+
+        for _ in 0..<3 {
+            coalescer.coalesceTrack(withKey: key(location), request: { requests.append($0) }) { status, _, _, _, _, _, _ in
+                statuses.append(status)
+            }
+        }
+
+        #expect(requests.count == 1)
+        #expect(statuses.isEmpty)
+        #expect(coalescer.coalescedCount == 2)
+
+        requests[0](.success, nil, nil, nil, nil, nil, nil)
+        #expect(statuses == [.success, .success, .success])
+
+        // the flight is over, so the next track is sent
+        coalescer.coalesceTrack(withKey: key(location), request: { requests.append($0) }) { _, _, _, _, _, _, _ in }
+        #expect(requests.count == 2)
+    }
+
+    @Test func differentTracksAreNotShared() {
+        let coalescer = RadarTrackCoalescer(window: 1)
+        var requests = 0
+        let moved = CLLocation(latitude: 40.78482, longitude: -73.97536)
+
+        for key in [key(location), key(location, source: .beaconEnter), key(moved), key(location, replayed: true), nil] {
+            coalescer.coalesceTrack(withKey: key, request: { _ in requests += 1 }) { _, _, _, _, _, _, _ in }
+        }
+
+        #expect(requests == 5)
+        #expect(coalescer.coalescedCount == 0)
+        #expect(key(location, replayed: true) == nil)
+        #expect(key(location) == key(CLLocation(latitude: 40.783821, longitude: -73.975361)))
+    }
+
+    @Test func tracksAfterTheWindowAreSentAgain() async throws {
+        let coalescer = RadarTrackCoalescer(window: 0.05)
+        var requests = [RadarTrackAPICompletionHandler]()
+        var statuses = [RadarStatus]()
+
+        coalescer.coalesceTrack(withKey: key(location), request: { requests.append($0) }) { status, _, _, _, _, _, _ in statuses.append(status) }
+        try await Task.sleep(nanoseconds: 100_000_000)
+        coalescer.coalesceTrack(withKey: key(location), request: { requests.append($0) }) { status, _, _, _, _, _, _ in statuses.append(status) }
+
+        #expect(requests.count == 2)
+
+        // the stale flight finishing doesn't end the newer one
+        requests[0](.errorNetwork, nil, nil, nil, nil, nil, nil)
+        coalescer.coalesceTrack(withKey: key(location), request: { requests.append($0) }) { status, _, _, _, _, _, _ in statuses.append(status) }
+        #expect(requests.count == 2)
+
+        requests[1](.success, nil, nil, nil, nil, nil, nil)
+        #expect(statuses == [.errorNetwork, .success, .success])
+    }
+}
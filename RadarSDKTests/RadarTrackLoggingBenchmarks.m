@@ -0,0 +1,130 @@
+//
+//  RadarTrackLoggingBenchmarks.m
+//  RadarSDK
+//
+//  Copyright © 2026 Radar Labs, Inc. All rights reserved.
+//
+
+@import RadarSDK;
+#import <XCTest/XCTest.h>
+
+#import "../RadarSDK/RadarAPIClient.h"
+#import "../RadarSDK/RadarAPIHelper.h"
+#import "../RadarSDK/RadarSettings.h"
+#import "RadarTestUtils.h"
+
+// Answers every request with the track.json fixture, so a track goes through the real
+// RadarAPIHelper request and response logging without leaving the process.
+@interface RadarTrackStubURLProtocol : NSURLProtocol
+@end
+
+@implementation RadarTrackStubURLProtocol
+
+static NSData *trackResponseData;
+
++ (BOOL)canInitWithRequest:(NSURLRequest *)request {
+    return YES;
+}
+
++ (NSURLRequest *)canonicalRequestForRequest:(NSURLRequest *)request {
+    return request;
+}
+
+- (void)startLoading {
+    NSHTTPURLResponse *response = [[NSHTTPURLResponse alloc] initWithURL:self.request.URL
+                                                              statusCode:200
+                                                             HTTPVersion:@"HTTP/1.1"
+                                                            headerFields:@{@"Content-Type": @"application/json"}];
+    [self.client URLProtocol:self didReceiveResponse:response cacheStoragePolicy:NSURLCacheStorageNotAllowed];
+    [self.client URLProtocol:self didLoadData:trackResponseData];
+    [self.client URLProtocolDidFinishLoading:self];
+}
+
+- (void)stopLoading {
+}
+
+@end
+
+@interface RadarTrackLoggingBenchmarks : XCTestCase
+
+@property (strong, nonatomic) RadarAPIHelper *previousAPIHelper;
+@property (assign, nonatomic) RadarLogLevel previousLogLevel;
+
+@end
+
+@implementation RadarTrackLoggingBenchmarks
+
+static NSInteger const kTracksPerIteration = 20;
+
+- (void)setUp {
+    [super setUp];
+    [Radar initializeWithPublishableKey:@"prj_test_pk_0000000000000000000000000000000000000000"];
+    [RadarSettings setTrackingOptions:RadarTrackingOptions.presetResponsive];
+
+    trackResponseData = [NSJSONSerialization dataWithJSONObject:[RadarTestUtils jsonDictionaryFromResource:@"track"] options:0 error:nil];
+
+    NSURLSessionConfiguration *configuration = [NSURLSessionConfiguration ephemeralSessionConfiguration];
+    configuration.protocolClasses = @[[RadarTrackStubURLProtocol class]];
+    RadarAPIHelper *apiHelper = [[RadarAPIHelper alloc] initWithSession:[NSURLSession sessionWithConfiguration:configuration]];
+    apiHelper.requestSpacing = 0;
+
+    self.previousAPIHelper = [RadarAPIClient sharedInstance].apiHelper;
+    self.previousLogLevel = [RadarSettings logLevel];
+    [RadarAPIClient sharedInstance].apiHelper = apiHelper;
+}
+
+- (void)tearDown {
+    [RadarAPIClient sharedInstance].apiHelper = self.previousAPIHelper;
+    [RadarSettings setLogLevel:self.previousLogLevel];
+    [RadarSettings setTrackingOptions:nil];
+    [super tearDown];
+}
+
+// Foreground tracks skip batching, so each one is a full /track request and response.
+- (void)measureTracksWithLogLevel:(RadarLogLevel)level {
+    [RadarSettings setLogLevel:level];
+    CLLocation *location = [[CLLocation alloc] initWithLatitude:40.78382 longitude:-73.97536];
+
+    [self measureWithMetrics:@[[XCTClockMetric new], [XCTCPUMetric new]]
+                       block:^{
+                           for (NSInteger i = 0; i < kTracksPerIteration; i++) {
+                               XCTestExpectation *expectation = [self expectationWithDescription:@"track"];
+                               [[RadarAPIClient sharedInstance] trackWithLocation:location
+                                                                          stopped:NO
+                                                                       foreground:YES
+                                                                           source:RadarLocationSourceForegroundLocation
+                                                                         replayed:NO
+                                                                          beacons:nil
+                                                                   indoorLocation:nil
+                                                                completionHandler:^(RadarStatus status, NSDictionary *_Nullable res, NSArray<RadarEvent *> *_Nullable events,
+                                                                                    RadarTrackResponse *_Nullable response, NSArray<RadarGeofence *> *_Nullable nearbyGeofences, RadarConfig *_Nullable config,
+                                                                                    RadarVerifiedLocationToken *_Nullable token) {
+                                                                    XCTAssertEqual(status, RadarStatusSuccess);
+                                                                    [expectation fulfill];
+                                                                }];
+                               [self waitForExpectations:@[expectation] timeout:5];
+                           }
+                       }];
+}
+
+- (void)test_track_logLevelNone {
+    [self measureTracksWithLogLevel:RadarLogLevelNone];
+}
+
+- (void)test_track_logLevelError {
+    [self measureTracksWithLogLevel:RadarLogLevelError];
+}
+
+- (void)test_track_logLevelWarning {
+    [self measureTracksWithLogLevel:RadarLogLevelWarning];
+}
+
+- (void)test_track_logLevelInfo {
+    [self measureTracksWithLogLevel:RadarLogLevelInfo];
+}
+
+- (void)test_track_logLevelDebug {
+    [self measureTracksWithLogLevel:RadarLogLevelDebug];
+}
+
+@end
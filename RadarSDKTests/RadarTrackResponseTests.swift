@@ -0,0 +1,133 @@
+//
+//  RadarTrackResponseTests.swift
+//  RadarSDKTests
+//
+//  Copyright © 2026 Radar Labs, Inc. All rights reserved.
+//
+
+import Foundation
+import Testing
+import XCTest
+
+@testable import RadarSDK
+
+@Suite
+struct RadarTrackResponseTests {
+
+    private final class Fixtures {}
+
+    private func trackResponse() throws -> NSDictionary {
+        let url = try #require(Bundle(for: Fixtures.self).url(forResource: "track", withExtension: "json"))
+        return try #require(try JSONSerialization.jsonObject(with: Data(contentsOf: url)) as? NSDictionary)
+    }
+
+    @Test("ids match the ones on the built user")
+    func summaryMatchesUser() throws {
+        let res = try trackResponse()
+        let response = RadarTrackResponse(response: res)
+        let user = try #require(RadarUser(object: try #require(res["user"])))
+
+        #expect(response.userId == user._id)
+        #expect(response.geofenceIds == (user.geofences ?? []).map(\._id))
+        #expect(response.placeId == user.place?._id)
+        #expect(response.beaconIds == (user.beacons ?? []).map(\._id))
+        #expect(response.regionIds == [user.country, user.state, user.dma, user.postalCode].compactMap { $0?._id })
+        #expect(response.canExit)
+        #expect(response.summary?.hasTrip == (user.trip != nil))
+        #expect((response.tripObject != nil) == (user.trip != nil))
+        #expect(response.userDebug == user.debug)
+    }
+
+    @Test("the user is built on first read and then kept")
+    func userIsBuiltOnce() throws {
+        let res = try trackResponse()
+        let response = RadarTrackResponse(response: res, locationMetadata: ["motionActivity": "walking"])
+
+        let user = try #require(response.user)
+        #expect(response.user === user)
+        #expect(user._id == response.userId)
+        #expect(user.metadata?["motionActivity"] as? String == "walking")
+        #expect(RadarTrackResponse(response: NSDictionary()).user == nil)
+    }
+
+    @Test("a stored user object reads back as the user")
+    func storedUserObject() throws {
+        let userObject = try #require(try trackResponse()["user"] as? NSDictionary).mutableCopy() as! NSMutableDictionary
+        userObject["description"] = NSNull()
+        defer { RadarSyncTestHelper.setRadarUserObject(nil) }
+
+        RadarSyncTestHelper.setRadarUserObject(userObject)
+        let user = try #require(RadarSyncTestHelper.radarUser())
+        #expect(user._id == userObject["_id"] as? String)
+        #expect((user.geofences ?? []).map(\._id) == RadarTrackResponse(response: ["user": userObject]).geofenceIds)
+    }
+
+    @Test("nothing is read from a response without the objects")
+    func emptyResponse() {
+        let response = RadarTrackResponse(response: NSDictionary(dictionary: ["meta": [String: Any]()]))
+
+        #expect(!response.hasUser)
+        #expect(!response.hasToken)
+        #expect(response.eventCount == 0)
+        #expect(response.eventsObject == nil)
+        #expect(response.geofenceIds.isEmpty)
+        #expect(!response.canExit)
+        #expect(RadarTrackUserSummary(object: ["geofences": [Any]()]) == nil)
+    }
+
+    @Test("a verified token is only flagged when the response has one")
+    func tokenFlag() throws {
+        let res = try #require(try trackResponse().mutableCopy() as? NSMutableDictionary)
+        #expect(!RadarTrackResponse(response: res).hasToken)
+
+        res["token"] = "eyJhbGciOi"
+        #expect(RadarTrackResponse(response: res).hasToken)
+    }
+}
+
+/// Handling the user of 100 /track responses, building and storing a RadarUser vs storing
+/// the response object and reading ids from the summary.
+final class RadarTrackResponseBenchmarks: XCTestCase {
+    private final class Fixtures {}
+
+    private var res: NSDictionary!
+
+    override func setUpWithError() throws {
+        try super.setUpWithError()
+        let url = try XCTUnwrap(Bundle(for: Fixtures.self).url(forResource: "track", withExtension: "json"))
+        res = try XCTUnwrap(try JSONSerialization.jsonObject(with: Data(contentsOf: url)) as? NSDictionary)
+    }
+
+    override func tearDown() {
+        RadarSyncTestHelper.setRadarUserObject(nil)
+        super.tearDown()
+    }
+
+    // before: every /track built the user, stored its dictionaryValue and reconciled from it
+    func testEagerUser() {
+        let res = res!
+        measure(metrics: [XCTClockMetric()]) {
+            for _ in 0..<100 {
+                let response = RadarTrackResponse(response: res)
+                guard let userObject = response.userObject, let user = RadarUser(object: userObject) else {
+                    return XCTFail("track.json has no user")
+                }
+                RadarSyncTestHelper.setRadarUser(user)
+                _ = ((user.geofences ?? []).map(\._id), user.place?._id, (user.beacons ?? []).map(\._id))
+            }
+        }
+    }
+
+    // after: the response object is stored and reconciled from as is; no completion handler or
+    // delegate reads the user, so it is never built
+    func testSummary() {
+        let res = res!
+        measure(metrics: [XCTClockMetric()]) {
+            for _ in 0..<100 {
+                let response = RadarTrackResponse(response: res)
+                RadarSyncTestHelper.setRadarUserObject(response.userObject)
+                _ = (response.geofenceIds, response.placeId, response.beaconIds)
+            }
+        }
+    }
+}
@@ -0,0 +1,88 @@
+//
+//  RadarURLSessionTests.swift
+//  RadarSDKTests
+//
+//  Copyright © 2026 Radar Labs, Inc. All rights reserved.
+//
+
+import Foundation
+import Testing
+
+@testable import RadarSDK
+
+@Suite
+struct RadarURLSessionTests {
+
+    private func metrics(_ path: String) -> RadarRequestMetrics {
+        RadarRequestMetrics(path: path, dns: nil, connect: nil, tls: nil, ttfb: 0.05, total: 0.1, reusedConnection: true, networkProtocol: "h2")
+    }
+
+    @Test("API helpers share one session and set timeouts per request")
+    func helpersShareSession() async throws {
+        #expect((RadarAPIHelper().session as? URLSession) === RadarURLSession.shared.session)
+        #expect(RadarURLSession.shared.session.configuration.timeoutIntervalForResource == RadarURLSession.resourceTimeout)
+
+        let session = MockURLSession()
+        session.on({ _ in true }, Data())
+        let helper = RadarAPIHelper(session: session, timeoutInterval: 25)
+        _ = try await helper.request(method: "GET", url: "https://api.radar.io/v1/config")
+
+        #expect(session.requests.first?.timeoutInterval == 25)
+    }
+
+    @Test("a request still running after its timeout is cancelled")
+    func requestsAreCancelledAtTheirDeadline() async throws {
+        let helper = RadarAPIHelper(session: StalledURLSession(), timeoutInterval: 0.1)
+        let start = Date()
+
+        await #expect(throws: URLError(.timedOut)) {
+            _ = try await helper.request(method: "GET", url: "https://api.radar.io/v1/config")
+        }
+        #expect(Date().timeIntervalSince(start) < 5)
+    }
+
+    @Test("phase durations are only reported when both ends were recorded")
+    func intervalNeedsBothDates() {
+        let start = Date()
+        #expect(RadarRequestMetrics.interval(start, start.addingTimeInterval(0.25)) == 0.25)
+        #expect(RadarRequestMetrics.interval(start, nil) == nil)
+        #expect(RadarRequestMetrics.interval(nil, start) == nil)
+
+        let description = metrics("/v1/track").logDescription
+        #expect(description.contains("path = /v1/track"))
+        #expect(description.contains("dnsMs = -"))
+        #expect(description.contains("ttfbMs = 50"))
+    }
+
+    @Test("only the latest request metrics are kept")
+    func recorderKeepsLatest() {
+        let recorder = RadarURLSession.MetricsRecorder(capacity: 3)
+        for index in 0..<5 {
+            recorder.record(metrics("/v1/\(index)"))
+        }
+        #expect(recorder.recent.map(\.path) == ["/v1/2", "/v1/3", "/v1/4"])
+    }
+
+    @Test("warm-ups are skipped while the connection was used recently")
+    func prewarmIsThrottled() {
+        let recorder = RadarURLSession.MetricsRecorder(capacity: 3)
+        let interval = RadarURLSession.prewarmInterval
+
+        #expect(recorder.claimPrewarm(now: 1000, interval: interval))
+        #expect(!recorder.claimPrewarm(now: 1000 + interval / 2, interval: interval))
+        #expect(recorder.claimPrewarm(now: 1000 + interval, interval: interval))
+
+        // a finished request counts as using the connection
+        recorder.record(metrics("/v1/track"), now: 2000)
+        #expect(!recorder.claimPrewarm(now: 2000 + interval / 2, interval: interval))
+        #expect(recorder.claimPrewarm(now: 2000 + interval, interval: interval))
+    }
+}
+
+/// A session whose requests never finish on their own.
+private struct StalledURLSession: RadarURLSessionProtocol {
+    func data(for request: URLRequest) async throws -> (Data, URLResponse) {
+        try await Task.sleep(nanoseconds: 60 * 1_000_000_000)
+        throw URLError(.unknown)
+    }
+}
@@ -0,0 +1,208 @@
+//
+//  RadarVerifiedTokenCacheTests.swift
+//  RadarSDKTests
+//
+//  Copyright © 2026 Radar Labs, Inc. All rights reserved.
+//
+
+import Foundation
+import Testing
+
+@testable import RadarSDK
+
+@Suite
+struct RadarVerifiedTokenCacheTests {
+
+    private final class Fixtures {}
+
+    private func token(expiresIn: TimeInterval, passed: Bool = true, distanceToBorder: Double = 5000) throws -> RadarVerifiedLocationToken {
+        let url = try #require(Bundle(for: Fixtures.self).url(forResource: "track", withExtension: "json"))
+        let response = try #require(try JSONSerialization.jsonObject(with: Data(contentsOf: url)) as? [String: Any])
+        var user = try #require(response["user"] as? [String: Any])
+        var state = try #require(user["state"] as? [String: Any])
+        state["distanceToBorder"] = distanceToBorder
+        user["state"] = state
+        let object: [String: Any] = [
+            "user": user,
+            "events": response["events"] ?? [Any](),
+            "token": "eyJhbGciOi",
+            "expiresAt": "2030-01-01T00:00:00.000Z",
+            "expiresIn": expiresIn,
+            "passed": passed,
+        ]
+        return try #require(RadarVerifiedLocationToken(object: object))
+    }
+
+    /// A refresh that stores `token` and completes after `delay`, recording whether each call was a background one.
+    private final class Refresher: @unchecked Sendable {
+        let cache: RadarVerifiedTokenCache
+        let token: RadarVerifiedLocationToken
+        let delay: TimeInterval
+        let beacons: Bool
+        private let lock = NSLock()
+        private var _backgrounds = [Bool]()
+
+        init(cache: RadarVerifiedTokenCache, token: RadarVerifiedLocationToken, delay: TimeInterval, beacons: Bool = false) {
+            self.cache = cache
+            self.token = token
+            self.delay = delay
+            self.beacons = beacons
+        }
+
+        var backgrounds: [Bool] {
+            lock.lock()
+            defer { lock.unlock() }
+            return _backgrounds
+        }
+
+        var calls: Int {
+            backgrounds.count
+        }
+
+        func refresh(_ background: Bool, _ completionHandler: @escaping RadarTrackVerifiedCompletionHandler) {
+            lock.lock()
+            _backgrounds.append(background)
+            lock.unlock()
+            DispatchQueue.global().asyncAfter(deadline: .now() + delay) {
+                self.cache.store(self.token, beacons: self.beacons, desiredAccuracy: .medium)
+                completionHandler(.success, self.token)
+            }
+        }
+    }
+
+    private func getToken(
+        _ cache: RadarVerifiedTokenCache, _ refresher: Refresher, beacons: Bool = false, desiredAccuracy: RadarTrackingOptionsDesiredAccuracy = .medium
+    ) async -> (RadarStatus, RadarVerifiedLocationToken?, Bool) {
+        await withCheckedContinuation { continuation in
+            cache.getToken(beacons: beacons, desiredAccuracy: desiredAccuracy, refresh: refresher.refresh) { status, token, cached in
+                continuation.resume(returning: (status, token, cached))
+            }
+        }
+    }
+
+    @Test func missRefreshesThenHitIsServedFromCache() async throws {
+        let cache = RadarVerifiedTokenCache()
+        let refresher = Refresher(cache: cache, token: try token(expiresIn: 600), delay: 0.05)
+
+        let (missStatus, missToken, missCached) = await getToken(cache, refresher)
+        #expect(missStatus == .success)
+        #expect(missToken != nil)
+        #expect(!missCached)
+
+        let (hitStatus, hitToken, hitCached) = await getToken(cache, refresher)
+        #expect(hitStatus == .success)
+        #expect(hitToken === missToken)
+        #expect(hitCached)
+
+        #expect(refresher.calls == 1)
+        #expect(cache.hits == 1)
+        #expect(cache.misses == 1)
+        #expect(cache.refreshes == 1)
+        #expect(cache.lastRefreshLatency >= 0.05)
+    }
+
+    @Test func concurrentMissesShareOneRefresh() async throws {
+        let cache = RadarVerifiedTokenCache()
+        let refresher = Refresher(cache: cache, token: try token(expiresIn: 600), delay: 0.1)
+
+        // whether each caller got the refreshed token
+        let results = await withTaskGroup(of: Bool.self) { group in
+            for _ in 0..<5 {
+                group.addTask { await getToken(refresher.cache, refresher).1 === refresher.token }
+            }
+            return await group.reduce(into: [Bool]()) { $0.append($1) }
+        }
+
+        #expect(results == Array(repeating: true, count: 5))
+        #expect(refresher.calls == 1)
+        #expect(cache.refreshes == 1)
+        #expect(cache.joinedRefreshes == 4)
+        #expect(cache.misses == 5)
+    }
+
+    @Test func expiringTokenIsServedAndRefreshedInBackground() async throws {
+        let cache = RadarVerifiedTokenCache()
+        cache.store(try token(expiresIn: 5), beacons: false, desiredAccuracy: .medium)
+        let refresher = Refresher(cache: cache, token: try token(expiresIn: 600), delay: 0.05)
+
+        let (status, served, cached) = await getToken(cache, refresher)
+        #expect(status == .success)
+        #expect(cached)
+        #expect(served?.expiresIn == 5)
+        #expect(refresher.backgrounds == [true])
+        #expect(cache.refreshing)
+
+        try await Task.sleep(nanoseconds: 200_000_000)
+        #expect(!cache.refreshing)
+        #expect(cache.token?.expiresIn == 600)
+        #expect(!cache.needsRefresh())
+    }
+
+    @Test func missIsNotABackgroundRefresh() async throws {
+        let cache = RadarVerifiedTokenCache()
+        let refresher = Refresher(cache: cache, token: try token(expiresIn: 600), delay: 0.01)
+
+        _ = await getToken(cache, refresher)
+
+        #expect(refresher.backgrounds == [false])
+    }
+
+    @Test func weakerTokensAndRefreshesDontServeStrongerRequests() async throws {
+        let cache = RadarVerifiedTokenCache()
+        cache.store(try token(expiresIn: 600), beacons: false, desiredAccuracy: .medium)
+        #expect(cache.validToken(beacons: false, desiredAccuracy: .low) != nil)
+        #expect(cache.validToken(beacons: true, desiredAccuracy: .medium) == nil)
+        #expect(cache.validToken(beacons: false, desiredAccuracy: .high) == nil)
+        cache.clear()
+
+        let weak = Refresher(cache: cache, token: try token(expiresIn: 600), delay: 0.1)
+        let strong = Refresher(cache: cache, token: try token(expiresIn: 600), delay: 0.1, beacons: true)
+        // the refreshers share the cache and are Sendable, so the calls go through them; each reports which token it got
+        async let medium = getToken(weak.cache, weak).1.map(ObjectIdentifier.init)
+        try await Task.sleep(nanoseconds: 20_000_000)
+        // the medium refresh doesn't range beacons, so this starts its own
+        async let withBeacons = getToken(strong.cache, strong, beacons: true).1.map(ObjectIdentifier.init)
+        try await Task.sleep(nanoseconds: 20_000_000)
+        // either refresh in flight is at least as strong as this one
+        async let low = getToken(weak.cache, weak, desiredAccuracy: .low).1.map(ObjectIdentifier.init)
+
+        let results = await [medium, withBeacons, low]
+        #expect(results == [ObjectIdentifier(weak.token), ObjectIdentifier(strong.token), ObjectIdentifier(weak.token)])
+        #expect(weak.calls == 1)
+        #expect(strong.calls == 1)
+        #expect(cache.refreshes == 2)
+        #expect(cache.joinedRefreshes == 1)
+    }
+
+    @Test func tokensThatFailedOrAreNearABorderAreNotServed() throws {
+        let cache = RadarVerifiedTokenCache()
+        #expect(cache.validToken() == nil)
+        #expect(cache.timeUntilExpiry() == 0)
+
+        cache.store(try token(expiresIn: 600, passed: false), beacons: false, desiredAccuracy: .medium)
+        #expect(cache.validToken() == nil)
+
+        cache.store(try token(expiresIn: 600, distanceToBorder: 1000), beacons: false, desiredAccuracy: .medium)
+        #expect(cache.validToken() == nil)
+
+        cache.store(try token(expiresIn: 600), beacons: true, desiredAccuracy: .medium)
+        #expect(cache.validToken() != nil)
+        #expect(cache.tokenBeacons)
+
+        cache.clear()
+        #expect(cache.validToken() == nil)
+    }
+
+    @Test func leadTimeFollowsRefreshLatency() async throws {
+        let cache = RadarVerifiedTokenCache()
+        cache.minimumRefreshLeadTime = 0.01
+        #expect(cache.refreshLeadTime() == 0.01)
+
+        let refresher = Refresher(cache: cache, token: try token(expiresIn: 600), delay: 0.1)
+        _ = await getToken(cache, refresher)
+
+        #expect(cache.refreshLatency >= 0.1)
+        #expect(cache.refreshLeadTime() == 2 * cache.refreshLatency)
+        #expect(cache.metricsDescription().hasPrefix("hits = 0; misses = 1; refreshes = 1"))
+    }
+}
@@ -0,0 +1,140 @@
+//
+//  SyncRegionResponseTests.swift
+//  RadarSDK
+//
+//  Copyright © 2026 Radar Labs, Inc. All rights reserved.
+//
+
+import Foundation
+import Testing
+import XCTest
+
+@testable import RadarSDK
+
+@Suite
+struct SyncRegionResponseTests {
+
+    // MARK: - Helpers
+
+    /// Synthetic sync/region body: half circles, half 32-vertex polygons, plus places and beacons.
+    func makeResponseBody(geofenceCount: Int, seed: UInt64 = 21) throws -> Data {
+        var generator = SplitMix64(seed: seed)
+        let geofences = (0..<geofenceCount).map { i -> [String: Any] in
+            let lat = 40.78382 + Double.random(in: -0.1...0.1, using: &generator)
+            let lng = -73.97536 + Double.random(in: -0.1...0.1, using: &generator)
+            var geofence: [String: Any] = [
+                "_id": "geofence\(i)", "description": "Geofence \(i)", "tag": "store", "externalId": "ext\(i)",
+                "geometryRadius": 100, "geometryCenter": ["type": "Point", "coordinates": [lng, lat]] as [String: Any],
+                "metadata": ["rank": i, "name": "n\(i)"] as [String: Any],
+            ]
+            if i % 2 == 0 {
+                geofence["type"] = "circle"
+            } else {
+                var ring = (0..<32).map { v -> [Double] in
+                    let angle = Double(v) / 32 * 2 * .pi
+                    return [lng + 0.001 * cos(angle), lat + 0.001 * sin(angle)]
+                }
+                ring.append(ring[0])
+                geofence["type"] = "polygon"
+                geofence["geometry"] = ["type": "Polygon", "coordinates": [ring]] as [String: Any]
+            }
+            return geofence
+        }
+        let places = (0..<geofenceCount / 10).map { i -> [String: Any] in
+            [
+                "_id": "place\(i)", "name": "Place \(i)", "categories": ["food-beverage"],
+                "location": ["type": "Point", "coordinates": [-73.97536, 40.78382]] as [String: Any],
+            ]
+        }
+        let beacons = (0..<geofenceCount / 10).map { i -> [String: Any] in
+            ["_id": "beacon\(i)", "uuid": "B9407F30-F5F8-466E-AFF9-25556B57FE6D", "major": "\(i)", "minor": "1"]
+        }
+        let body: [String: Any] = [
+            "meta": ["code": 200],
+            "region": ["latitude": 40.78382, "longitude": -73.97536, "radius": 10_000] as [String: Any],
+            "geofences": geofences,
+            "places": places,
+            "beacons": beacons,
+        ]
+        return try JSONSerialization.data(withJSONObject: body)
+    }
+
+    /// The previous parse: `JSONSerialization`, then re-serialize and decode each array.
+    func legacyParse(_ data: Data) throws -> (geofences: [RadarGeofenceSwift]?, places: [RadarPlaceSwift]?, beacons: [RadarBeaconSwift]?, intermediateBytes: Int) {
+        guard let res = try JSONSerialization.jsonObject(with: data) as? [String: Any] else {
+            throw URLError(.cannotParseResponse)
+        }
+        let decoder = JSONDecoder()
+        var intermediateBytes = 0
+
+        func decodeArray<T: Decodable>(_ key: String) -> [T]? {
+            guard let arr = res[key] as? [[String: Any]], let jsonData = try? JSONSerialization.data(withJSONObject: arr) else { return nil }
+            intermediateBytes += jsonData.count
+            return try? decoder.decode([T].self, from: jsonData)
+        }
+
+        let geofences: [RadarGeofenceSwift]? = decodeArray("geofences")
+        let places: [RadarPlaceSwift]? = decodeArray("places")
+        let beacons: [RadarBeaconSwift]? = decodeArray("beacons")
+        return (geofences, places, beacons, intermediateBytes)
+    }
+
+    // MARK: - Tests
+
+    @Test("envelope decode matches the previous two-pass parse")
+    func envelopeMatchesLegacyParse() throws {
+        let data = try makeResponseBody(geofenceCount: 200)
+        let legacy = try legacyParse(data)
+        let envelope = try JSONDecoder().decode(SyncRegionEnvelope.self, from: data)
+
+        #expect(envelope.geofences == legacy.geofences)
+        #expect(envelope.geofences?.map(\.metadata) == legacy.geofences?.map(\.metadata))
+        #expect(envelope.places?.map(\.id) == legacy.places?.map(\.id))
+        #expect(envelope.beacons?.map(\.id) == legacy.beacons?.map(\.id))
+        #expect(envelope.regionCenter == RadarCoordinateSwift(latitude: 40.78382, longitude: -73.97536))
+        #expect(envelope.regionRadius == 10_000)
+        #expect(envelope.syncDelta == nil)
+    }
+
+    @Test("a malformed collection doesn't fail the rest of the response")
+    func malformedCollectionIsDropped() throws {
+        let json = """
+            {
+              "region": { "latitude": 40.78, "longitude": -73.97, "radius": 0 },
+              "geofences": [{ "description": "missing id" }],
+              "beacons": [{ "_id": "b1", "uuid": "u", "major": "1", "minor": "2" }],
+              "delta": { "places": { "removed": ["p1"] } }
+            }
+            """
+        let envelope = try JSONDecoder().decode(SyncRegionEnvelope.self, from: Data(json.utf8))
+
+        #expect(envelope.geofences == nil)
+        #expect(envelope.beacons?.map(\.id) == ["b1"])
+        // zero radius means no region, same as before
+        #expect(envelope.regionCenter == nil)
+        #expect(envelope.regionRadius == nil)
+        #expect(envelope.syncDelta?.places.removed == ["p1"])
+        #expect(envelope.syncDelta?.geofences.isEmpty == true)
+    }
+}
+
+/// Parsing a 10,000-geofence sync/region body, decoding each collection separately after
+/// re-serializing it vs one envelope decode.
+final class SyncRegionResponseBenchmarks: XCTestCase {
+    private let fixtures = SyncRegionResponseTests()
+
+    func testTwoPassParse() throws {
+        let fixtures = fixtures
+        let data = try fixtures.makeResponseBody(geofenceCount: 10_000)
+        measure(metrics: [XCTClockMetric(), XCTMemoryMetric()]) {
+            XCTAssertNotNil(try? fixtures.legacyParse(data))
+        }
+    }
+
+    func testEnvelopeParse() throws {
+        let data = try fixtures.makeResponseBody(geofenceCount: 10_000)
+        measure(metrics: [XCTClockMetric(), XCTMemoryMetric()]) {
+            XCTAssertEqual((try? JSONDecoder().decode(SyncRegionEnvelope.self, from: data))?.geofences?.count, 10_000)
+        }
+    }
+}